@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/compute/zlascl.c, normal z -> c, Fri Sep 28 17:38:08 2018
+ * @generated from compute/zlascl.c, normal z -> c, Sat Oct 17 01:56:43 2026
  *
  **/
 
@@ -73,12 +73,13 @@ int plasma_clascl(plasma_enum_t uplo,
     int nb = plasma->nb;
 
     // Create tile matrices.
+    // The tiles are views of the LAPACK array, so no translation is needed.
     plasma_desc_t A;
     int retval;
-    retval = plasma_desc_general_create(PlasmaComplexFloat, nb, nb,
-                                        m, n, 0, 0, m, n, &A);
+    retval = plasma_desc_general_strided_init(PlasmaComplexFloat, pA, lda,
+                                              nb, nb, m, n, &A);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_general_desc_create() failed");
+        plasma_error("plasma_desc_general_strided_init() failed");
         return retval;
     }
 
@@ -94,20 +95,11 @@ int plasma_clascl(plasma_enum_t uplo,
     #pragma omp parallel
     #pragma omp master
     {
-        // Translate to tile layout.
-        plasma_omp_cge2desc(pA, lda, A, &sequence, &request);
-
         // Call tile async function.
         plasma_omp_clascl(uplo, cfrom, cto, A, &sequence, &request);
-
-        // Translate back to LAPACK layout.
-        plasma_omp_cdesc2ge(A, pA, lda, &sequence, &request);
     }
     // implicit synchronization
 
-    // Free matrices in tile layout.
-    plasma_desc_destroy(&A);
-
     // Return status.
     int status = sequence.status;
     return status;
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/compute/zposv.c, normal z -> c, Fri Sep 28 17:38:09 2018
+ * @generated from compute/zposv.c, normal z -> c, Sat Oct 17 04:38:18 2026
  *
  **/
 
@@ -19,6 +19,8 @@
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 
+#include <string.h>
+
 /***************************************************************************//**
  *
  * @ingroup plasma_posv
@@ -159,6 +161,24 @@ int plasma_cposv(plasma_enum_t uplo,
     plasma_request_t request;
     retval = plasma_request_init(&request);
 
+    // Key of the task graph of the call: its shape and parameters,
+    // and the settings of the context that change the tasks submitted.
+    struct {
+        plasma_enum_t uplo;
+        int n, nrhs, nb;
+        int ib, lookahead, nested_tasks, batch;
+    } key;
+    memset(&key, 0, sizeof(key));
+    key.uplo = uplo;
+    key.n = n;
+    key.nrhs = nrhs;
+    key.nb = nb;
+    key.ib = plasma->ib;
+    key.lookahead = plasma->lookahead;
+    key.nested_tasks = plasma->nested_tasks;
+    key.batch = plasma->batch;
+    plasma_desc_t desc[] = {A, B};
+
     // asynchronous block
     #pragma omp parallel
     #pragma omp master
@@ -167,8 +187,25 @@ int plasma_cposv(plasma_enum_t uplo,
         plasma_omp_ctr2desc(pA, lda, A, &sequence, &request);
         plasma_omp_cge2desc(pB, ldb, B, &sequence, &request);
 
+        // Replay the task graph recorded by a previous call of the same
+        // shape, or record it now.
+        plasma_graph_t *graph = NULL;
+        if (plasma->graph_cache == PlasmaEnabled) {
+            graph = plasma_graph_find(plasma->graphs, "cposv",
+                                      &key, sizeof(key));
+            if (graph == NULL) {
+                plasma_graph_capture_begin(desc, 2);
+                plasma_omp_cposv(uplo, A, B, &sequence, &request);
+                graph = plasma_graph_capture_end(&plasma->graphs, "cposv",
+                                                 &key, sizeof(key));
+            }
+        }
+
         // Call the tile async function.
-        plasma_omp_cposv(uplo, A, B, &sequence, &request);
+        if (graph != NULL)
+            plasma_graph_replay(graph, desc, &sequence, &request);
+        else
+            plasma_omp_cposv(uplo, A, B, &sequence, &request);
 
         // Translate back to LAPACK layout.
         plasma_omp_cdesc2tr(A, pA, lda, &sequence, &request);
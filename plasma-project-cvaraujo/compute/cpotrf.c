@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/compute/zpotrf.c, normal z -> c, Fri Sep 28 17:38:02 2018
+ * @generated from compute/zpotrf.c, normal z -> c, Sat Oct 17 01:54:48 2026
  *
  **/
 
@@ -111,11 +111,16 @@ int plasma_cpotrf(plasma_enum_t uplo,
     // Create tile matrix.
     plasma_desc_t A;
     int retval;
-    retval = plasma_desc_triangular_create(PlasmaComplexFloat, uplo, nb, nb,
-                                           n, n, 0, 0, n, n, &A);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
-        return retval;
+    int inplace = plasma->inplace_outplace == PlasmaInplace &&
+        plasma_desc_general_inplace_init(PlasmaComplexFloat, pA, lda,
+                                         nb, nb, n, n, &A) == PlasmaSuccess;
+    if (!inplace) {
+        retval = plasma_desc_triangular_create(PlasmaComplexFloat, uplo,
+                                               nb, nb, n, n, 0, 0, n, n, &A);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_desc_general_create() failed");
+            return retval;
+        }
     }
 
     // Initialize sequence.
@@ -131,18 +136,25 @@ int plasma_cpotrf(plasma_enum_t uplo,
     #pragma omp master
     {
         // Translate to tile layout.
-        plasma_omp_ctr2desc(pA, lda, A, &sequence, &request);
+        if (inplace)
+            plasma_omp_cge2desc_inplace(A, &sequence, &request);
+        else
+            plasma_omp_ctr2desc(pA, lda, A, &sequence, &request);
 
         // Call the tile async function.
         plasma_omp_cpotrf(uplo, A, &sequence, &request);
 
         // Translate back to LAPACK layout.
-        plasma_omp_cdesc2tr(A, pA, lda, &sequence, &request);
+        if (inplace)
+            plasma_omp_cdesc2ge_inplace(A, &sequence, &request);
+        else
+            plasma_omp_cdesc2tr(A, pA, lda, &sequence, &request);
     }
     // implicit synchronization
 
     // Free matrix A in tile layout.
-    plasma_desc_destroy(&A);
+    if (!inplace)
+        plasma_desc_destroy(&A);
 
     // Return status.
     int status = sequence.status;
@@ -0,0 +1,422 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zpotrf_update.c, normal z -> c, Sat Oct 17 03:35:11 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+/******************************************************************************/
+static int plasma_cpotrf_modify(plasma_enum_t uplo, float sigma,
+                                int n, int k,
+                                plasma_complex32_t *pA, int lda,
+                                plasma_complex32_t *pV, int ldv)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+
+    // Check input arguments.
+    if ((uplo != PlasmaUpper) &&
+        (uplo != PlasmaLower)) {
+        plasma_error("illegal value of uplo");
+        return -1;
+    }
+    if (n < 0) {
+        plasma_error("illegal value of n");
+        return -2;
+    }
+    if (k < 0) {
+        plasma_error("illegal value of k");
+        return -3;
+    }
+    if (lda < imax(1, n)) {
+        plasma_error("illegal value of lda");
+        return -5;
+    }
+    if (ldv < imax(1, n)) {
+        plasma_error("illegal value of ldv");
+        return -7;
+    }
+
+    // quick return
+    if (n == 0 || k == 0)
+        return PlasmaSuccess;
+
+    // Set tiling parameters.
+    int nb = plasma->nb;
+
+    // Create tile matrices.
+    plasma_desc_t A;
+    plasma_desc_t V;
+    int retval;
+    retval = plasma_desc_triangular_create(PlasmaComplexFloat, uplo,
+                                           nb, nb, n, n, 0, 0, n, n, &A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_triangular_create() failed");
+        return retval;
+    }
+    retval = plasma_desc_general_create(PlasmaComplexFloat, nb, nb,
+                                        n, k, 0, 0, n, k, &V);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_create() failed");
+        plasma_desc_destroy(&A);
+        return retval;
+    }
+
+    // Initialize sequence.
+    plasma_sequence_t sequence;
+    retval = plasma_sequence_init(&sequence);
+
+    // Initialize request.
+    plasma_request_t request;
+    retval = plasma_request_init(&request);
+
+    // asynchronous block
+    #pragma omp parallel
+    #pragma omp master
+    {
+        // Translate to tile layout.
+        plasma_omp_ctr2desc(pA, lda, A, &sequence, &request);
+        plasma_omp_cge2desc(pV, ldv, V, &sequence, &request);
+
+        // Call the tile async function.
+        if (sigma > 0.0)
+            plasma_omp_cpotrf_update(uplo, A, V, &sequence, &request);
+        else
+            plasma_omp_cpotrf_downdate(uplo, A, V, &sequence, &request);
+
+        // Translate back to LAPACK layout.
+        plasma_omp_cdesc2tr(A, pA, lda, &sequence, &request);
+    }
+    // implicit synchronization
+
+    // Free matrices in tile layout.
+    plasma_desc_destroy(&A);
+    plasma_desc_destroy(&V);
+
+    // Return status.
+    int status = sequence.status;
+    return status;
+}
+
+/******************************************************************************/
+static void plasma_omp_cpotrf_modify(plasma_enum_t uplo, float sigma,
+                                     plasma_desc_t A, plasma_desc_t V,
+                                     plasma_sequence_t *sequence,
+                                     plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_fatal_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if ((uplo != PlasmaUpper) &&
+        (uplo != PlasmaLower)) {
+        plasma_error("illegal value of uplo");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (plasma_desc_check(A) != PlasmaSuccess) {
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        plasma_error("invalid A");
+        return;
+    }
+    if (plasma_desc_check(V) != PlasmaSuccess ||
+        V.m != A.m || V.mb != A.mb) {
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        plasma_error("invalid V");
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_fatal_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_fatal_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (A.m == 0 || V.n == 0)
+        return;
+
+    // Call the parallel function.
+    plasma_pcpotrf_update(uplo, sigma, A, V, sequence, request);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_potrf
+ *
+ *  Updates the Cholesky factorization of a Hermitian positive definite
+ *  matrix A, computed by plasma_cpotrf(), to the Cholesky factorization
+ *  of the rank-k update
+ *
+ *    \f[ A + V \times V^H. \f]
+ *
+ *  The factor is modified by Givens rotations in O(n^2 k) operations,
+ *  instead of the O(n^3) operations of a new factorization.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: A holds the factor U of A = U^H*U;
+ *          - PlasmaLower: A holds the factor L of A = L*L^H.
+ *
+ * @param[in] n
+ *          The order of the matrix A. n >= 0.
+ *
+ * @param[in] k
+ *          The number of columns of the matrix V. k >= 0.
+ *
+ * @param[in,out] pA
+ *          On entry, the factor U or L from the Cholesky factorization
+ *          A = U^H*U or A = L*L^H.
+ *          If uplo = PlasmaUpper, the strictly lower triangular part of A
+ *          is not referenced.
+ *          If uplo = PlasmaLower, the strictly upper triangular part of A
+ *          is not referenced.
+ *          On exit, the factor of the Cholesky factorization of A + V*V^H.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,n).
+ *
+ * @param[in] pV
+ *          The n-by-k matrix V. Not modified.
+ *
+ * @param[in] ldv
+ *          The leading dimension of the array V. ldv >= max(1,n).
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval  < 0 if -i, the i-th argument had an illegal value
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_omp_cpotrf_update
+ * @sa plasma_cpotrf_downdate
+ * @sa plasma_cpotrf
+ * @sa plasma_cpotrf_update
+ * @sa plasma_dpotrf_update
+ * @sa plasma_spotrf_update
+ *
+ ******************************************************************************/
+int plasma_cpotrf_update(plasma_enum_t uplo,
+                         int n, int k,
+                         plasma_complex32_t *pA, int lda,
+                         plasma_complex32_t *pV, int ldv)
+{
+    return plasma_cpotrf_modify(uplo, 1.0, n, k, pA, lda, pV, ldv);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_potrf
+ *
+ *  Downdates the Cholesky factorization of a Hermitian positive definite
+ *  matrix A, computed by plasma_cpotrf(), to the Cholesky factorization
+ *  of the rank-k downdate
+ *
+ *    \f[ A - V \times V^H. \f]
+ *
+ *  The factor is modified by hyperbolic rotations in O(n^2 k) operations,
+ *  instead of the O(n^3) operations of a new factorization.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: A holds the factor U of A = U^H*U;
+ *          - PlasmaLower: A holds the factor L of A = L*L^H.
+ *
+ * @param[in] n
+ *          The order of the matrix A. n >= 0.
+ *
+ * @param[in] k
+ *          The number of columns of the matrix V. k >= 0.
+ *
+ * @param[in,out] pA
+ *          On entry, the factor U or L from the Cholesky factorization
+ *          A = U^H*U or A = L*L^H.
+ *          If uplo = PlasmaUpper, the strictly lower triangular part of A
+ *          is not referenced.
+ *          If uplo = PlasmaLower, the strictly upper triangular part of A
+ *          is not referenced.
+ *          On exit, if return value = 0, the factor of the Cholesky
+ *          factorization of A - V*V^H.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,n).
+ *
+ * @param[in] pV
+ *          The n-by-k matrix V. Not modified.
+ *
+ * @param[in] ldv
+ *          The leading dimension of the array V. ldv >= max(1,n).
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval  < 0 if -i, the i-th argument had an illegal value
+ * @retval  > 0 if i, the leading minor of order i of A - V*V^H is not
+ *          positive definite, so the downdate could not be completed.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_omp_cpotrf_downdate
+ * @sa plasma_cpotrf_update
+ * @sa plasma_cpotrf
+ * @sa plasma_cpotrf_downdate
+ * @sa plasma_dpotrf_downdate
+ * @sa plasma_spotrf_downdate
+ *
+ ******************************************************************************/
+int plasma_cpotrf_downdate(plasma_enum_t uplo,
+                           int n, int k,
+                           plasma_complex32_t *pA, int lda,
+                           plasma_complex32_t *pV, int ldv)
+{
+    return plasma_cpotrf_modify(uplo, -1.0, n, k, pA, lda, pV, ldv);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_potrf
+ *
+ *  Updates the Cholesky factorization of a Hermitian positive definite
+ *  matrix A to that of A + V*V^H.
+ *  Non-blocking tile version of plasma_cpotrf_update().
+ *  May return before the computation is finished.
+ *  Operates on matrices stored by tiles.
+ *  All matrices are passed through descriptors.
+ *  All dimensions are taken from the descriptors.
+ *  Allows for pipelining of operations at runtime.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: A holds the factor U of A = U^H*U;
+ *          - PlasmaLower: A holds the factor L of A = L*L^H.
+ *
+ * @param[in,out] A
+ *          On entry, the factor U or L from the Cholesky factorization
+ *          A = U^H*U or A = L*L^H.
+ *          On exit, the factor of the Cholesky factorization of A + V*V^H.
+ *
+ * @param[in,out] V
+ *          On entry, the n-by-k matrix V, with the same tile rows as A.
+ *          On exit, overwritten by the sines of the rotations.
+ *
+ * @param[in] sequence
+ *          Identifies the sequence of function calls that this call belongs to
+ *          (for completion checks and exception handling purposes).  Check
+ *          the sequence->status for errors.
+ *
+ * @param[out] request
+ *          Identifies this function call (for exception handling purposes).
+ *
+ * @retval void
+ *          Errors are returned by setting sequence->status and
+ *          request->status to error values.  The sequence->status and
+ *          request->status should never be set to PlasmaSuccess (the
+ *          initial values) since another async call may be setting a
+ *          failure value at the same time.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_cpotrf_update
+ * @sa plasma_omp_cpotrf_downdate
+ * @sa plasma_omp_cpotrf_update
+ * @sa plasma_omp_dpotrf_update
+ * @sa plasma_omp_spotrf_update
+ *
+ ******************************************************************************/
+void plasma_omp_cpotrf_update(plasma_enum_t uplo,
+                              plasma_desc_t A, plasma_desc_t V,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request)
+{
+    plasma_omp_cpotrf_modify(uplo, 1.0, A, V, sequence, request);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_potrf
+ *
+ *  Downdates the Cholesky factorization of a Hermitian positive definite
+ *  matrix A to that of A - V*V^H.
+ *  Non-blocking tile version of plasma_cpotrf_downdate().
+ *  May return before the computation is finished.
+ *  Operates on matrices stored by tiles.
+ *  All matrices are passed through descriptors.
+ *  All dimensions are taken from the descriptors.
+ *  Allows for pipelining of operations at runtime.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: A holds the factor U of A = U^H*U;
+ *          - PlasmaLower: A holds the factor L of A = L*L^H.
+ *
+ * @param[in,out] A
+ *          On entry, the factor U or L from the Cholesky factorization
+ *          A = U^H*U or A = L*L^H.
+ *          On exit, if the sequence succeeds, the factor of the Cholesky
+ *          factorization of A - V*V^H.
+ *
+ * @param[in,out] V
+ *          On entry, the n-by-k matrix V, with the same tile rows as A.
+ *          On exit, overwritten by the sines of the rotations.
+ *
+ * @param[in] sequence
+ *          Identifies the sequence of function calls that this call belongs to
+ *          (for completion checks and exception handling purposes).  Check
+ *          the sequence->status for errors.
+ *
+ * @param[out] request
+ *          Identifies this function call (for exception handling purposes).
+ *
+ * @retval void
+ *          Errors are returned by setting sequence->status and
+ *          request->status to error values.  The sequence->status and
+ *          request->status should never be set to PlasmaSuccess (the
+ *          initial values) since another async call may be setting a
+ *          failure value at the same time.
+ *
+ *******************************************************************************
+ *
+ * @sa plasma_cpotrf_downdate
+ * @sa plasma_omp_cpotrf_update
+ * @sa plasma_omp_cpotrf_downdate
+ * @sa plasma_omp_dpotrf_downdate
+ * @sa plasma_omp_spotrf_downdate
+ *
+ ******************************************************************************/
+void plasma_omp_cpotrf_downdate(plasma_enum_t uplo,
+                                plasma_desc_t A, plasma_desc_t V,
+                                plasma_sequence_t *sequence,
+                                plasma_request_t *request)
+{
+    plasma_omp_cpotrf_modify(uplo, -1.0, A, V, sequence, request);
+}
@@ -6,13 +6,14 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/compute/zgbsv.c, normal z -> d, Fri Sep 28 17:38:04 2018
+ * @generated from compute/zgbsv.c, normal z -> d, Sat Oct 17 01:51:31 2026
  *
  **/
 
 #include "plasma.h"
 #include "plasma_async.h"
 #include "plasma_context.h"
+#include "plasma_depend.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
 #include "plasma_tuning.h"
@@ -142,27 +143,53 @@ int plasma_dgbsv(int n, int kl, int ku, int nrhs,
     plasma_request_t request;
     retval = plasma_request_init(&request);
 
-    #pragma omp parallel
-    #pragma omp master
-    {
-        // Translate to tile layout.
-        plasma_omp_dpb2desc(pAB, ldab, AB, &sequence, &request);
-        plasma_omp_dge2desc(pB, ldb, B, &sequence, &request);
-    }
+    if (plasma->fused_driver == PlasmaEnabled) {
+        // Translate, compute and translate back in one task graph,
+        // so that tiles are factored as soon as they are translated.
+        #pragma omp parallel
+        #pragma omp master
+        {
+            // Translate to tile layout.
+            plasma_omp_dpb2desc(pAB, ldab, AB, &sequence, &request);
+            plasma_omp_dge2desc(pB, ldb, B, &sequence, &request);
+            plasma_omp_desc_fence_columns(AB);
+            plasma_omp_desc_fence_columns(B);
+
+            // Call the tile async function.
+            plasma_omp_dgbsv(AB, ipiv, B, &sequence, &request);
 
-    #pragma omp parallel
-    #pragma omp master
-    {
-        // Call the tile async function.
-        plasma_omp_dgbsv(AB, ipiv, B, &sequence, &request);
+            // Translate back to LAPACK layout.
+            plasma_omp_desc_fence_columns(AB);
+            plasma_omp_desc_fence_columns(B);
+            plasma_omp_ddesc2pb(AB, pAB, ldab, &sequence, &request);
+            plasma_omp_ddesc2ge(B, pB, ldb, &sequence, &request);
+        }
+        // implicit synchronization
     }
+    else {
+        #pragma omp parallel
+        #pragma omp master
+        {
+            // Translate to tile layout.
+            plasma_omp_dpb2desc(pAB, ldab, AB, &sequence, &request);
+            plasma_omp_dge2desc(pB, ldb, B, &sequence, &request);
+        }
+
+        #pragma omp parallel
+        #pragma omp master
+        {
+            // Call the tile async function.
+            plasma_omp_dgbsv(AB, ipiv, B, &sequence, &request);
+        }
 
-    #pragma omp parallel
-    #pragma omp master
-    {
-        // Translate back to LAPACK layout.
-        plasma_omp_ddesc2pb(AB, pAB, ldab, &sequence, &request);
-        plasma_omp_ddesc2ge(B, pB, ldb, &sequence, &request);
+        #pragma omp parallel
+        #pragma omp master
+        {
+            // Translate back to LAPACK layout.
+            plasma_omp_ddesc2pb(AB, pAB, ldab, &sequence, &request);
+            plasma_omp_ddesc2ge(B, pB, ldb, &sequence, &request);
+        }
+        // implicit synchronization
     }
 
     // Free matrices  in tile layout.
@@ -0,0 +1,108 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/zge2desc_inplace.c, normal z -> d, Sat Oct 17 01:54:49 2026
+ *
+ **/
+
+#include "plasma.h"
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+/***************************************************************************//**
+    @ingroup plasma_cm2ccrb
+
+    Convert column-major (CM) to tiled (CCRB) matrix layout.
+    In-place. A must be initialized by plasma_desc_general_inplace_init().
+*/
+void plasma_omp_dge2desc_inplace(plasma_desc_t A,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if (plasma_desc_check(A) != PlasmaSuccess ||
+        A.type != PlasmaGeneral || A.i != 0 || A.j != 0 ||
+        A.m%A.mb != 0 || A.n%A.nb != 0) {
+        plasma_error("invalid A");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (A.m == 0 || A.n == 0)
+        return;
+
+    // Call the parallel function.
+    plasma_pdge2desc_inplace(A, sequence, request);
+}
+
+/***************************************************************************//**
+    @ingroup plasma_ccrb2cm
+
+    Convert tiled (CCRB) to column-major (CM) matrix layout.
+    In-place. Reverses plasma_omp_dge2desc_inplace().
+*/
+void plasma_omp_ddesc2ge_inplace(plasma_desc_t A,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request)
+{
+    // Get PLASMA context.
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // Check input arguments.
+    if (plasma_desc_check(A) != PlasmaSuccess ||
+        A.type != PlasmaGeneral || A.i != 0 || A.j != 0 ||
+        A.m%A.mb != 0 || A.n%A.nb != 0) {
+        plasma_error("invalid A");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (sequence == NULL) {
+        plasma_error("NULL sequence");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+    if (request == NULL) {
+        plasma_error("NULL request");
+        plasma_request_fail(sequence, request, PlasmaErrorIllegalValue);
+        return;
+    }
+
+    // quick return
+    if (A.m == 0 || A.n == 0)
+        return;
+
+    // Call the parallel function.
+    plasma_pddesc2ge_inplace(A, sequence, request);
+}
@@ -6,11 +6,12 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/compute/pzgeswp.c, normal z -> c, Fri Sep 28 17:38:11 2018
+ * @generated from compute/pzgeswp.c, normal z -> c, Sat Oct 17 03:21:20 2026
  *
  **/
 
 #include "plasma_async.h"
+#include "plasma_depend.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
 #include "plasma_types.h"
@@ -34,16 +35,10 @@ void plasma_pcgeswp(plasma_enum_t colrow,
             a00 = A(0, n);
             a10 = A(A.mt-1, n);
 
-            // Multidependency of the whole panel on its individual tiles.
-            for (int m = 1; m < A.mt-1; m++) {
-                plasma_complex32_t *amn = A(m, n);
-                #pragma omp task depend (in:amn[0]) \
-                                 depend (inout:a00[0])
-                {
-                    int l = 1;
-                    l++;
-                }
-            }
+            // Dependencies of the whole panel on its individual tiles.
+#ifndef PLASMA_DEPEND_ITERATOR
+            plasma_omp_desc_gather(A, 1, A.mt-1, n, n+1, a00);
+#endif
 
             int ma00 = (A.mt-1)*A.mb;
             int na00 = plasma_tile_nmain(A, n);
@@ -53,6 +48,7 @@ void plasma_pcgeswp(plasma_enum_t colrow,
 
             #pragma omp task depend (in:ipiv[0:A.m]) \
                              depend (inout:a00[0:ma00*na00]) \
+                             PLASMA_DEPEND_TILES(inout, A, 1, A.mt-1, n, n+1) \
                              depend (inout:a10[0:lda10*nva10])
             {
                 int nvan = plasma_tile_nview(A, n);
@@ -60,16 +56,10 @@ void plasma_pcgeswp(plasma_enum_t colrow,
                 plasma_core_cgeswp(colrow, view, 1, A.m, ipiv, incx);
             }
 
-            // Multidependency of individual tiles on the whole panel.
-            for (int m = 1; m < A.mt-1; m++) {
-                plasma_complex32_t *amn = A(m, n);
-                #pragma omp task depend (in:a00[0]) \
-                                 depend (inout:amn[0])
-                {
-                    int l = 1;
-                    l++;
-                }
-            }
+            // Dependencies of individual tiles on the whole panel.
+#ifndef PLASMA_DEPEND_ITERATOR
+            plasma_omp_desc_scatter(A, 1, A.mt-1, n, n+1, a00);
+#endif
         }
     }
     else { // PlasmaColumnwise
@@ -79,19 +69,14 @@ void plasma_pcgeswp(plasma_enum_t colrow,
             a00 = A(m, 0);
             a01 = A(m, A.nt-1);
 
-            // Multidependency of the whole (row) panel on its individual tiles.
-            for (int n = 1; n < A.nt-1; n++) {
-                plasma_complex32_t *amn = A(m, n);
-                #pragma omp task depend (in:amn[0]) \
-                                 depend (inout:a00[0])
-                {
-                    int l = 1;
-                    l++;
-                }
-            }
+            // Dependencies of the whole (row) panel on its individual tiles.
+#ifndef PLASMA_DEPEND_ITERATOR
+            plasma_omp_desc_gather(A, m, m+1, 1, A.nt-1, a00);
+#endif
 
             #pragma omp task depend (in:ipiv[0:A.n]) \
                              depend (inout:a00[0]) \
+                             PLASMA_DEPEND_TILES(inout, A, m, m+1, 1, A.nt-1) \
                              depend (inout:a01[0])
             {
                 int mvam = plasma_tile_mview(A, m);
@@ -99,16 +84,10 @@ void plasma_pcgeswp(plasma_enum_t colrow,
                 plasma_core_cgeswp(colrow, view, 1, A.n, ipiv, incx);
             }
 
-            // Multidependency of individual tiles on the whole (row) panel.
-            for (int n = 1; n < A.nt-1; n++) {
-                plasma_complex32_t *amn = A(m, n);
-                #pragma omp task depend (in:a00[0]) \
-                                 depend (inout:amn[0])
-                {
-                    int l = 1;
-                    l++;
-                }
-            }
+            // Dependencies of individual tiles on the whole (row) panel.
+#ifndef PLASMA_DEPEND_ITERATOR
+            plasma_omp_desc_scatter(A, m, m+1, 1, A.nt-1, a00);
+#endif
         }
     }
 }
@@ -6,192 +6,255 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/compute/pzgetrf.c, normal z -> c, Fri Sep 28 17:38:11 2018
+ * @generated from compute/pzgetrf.c, normal z -> c, Sat Oct 17 04:43:39 2026
  *
  **/
 
 #include "plasma_async.h"
 #include "plasma_context.h"
+#include "plasma_depend.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_nested.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 #include <plasma_core_blas.h>
 
+#include <omp.h>
+
 #define A(m, n) (plasma_complex32_t*)plasma_tile_addr(A, m, n)
 
-/******************************************************************************/
-void plasma_pcgetrf(plasma_desc_t A, int *ipiv,
-                    plasma_sequence_t *sequence, plasma_request_t *request)
+/***************************************************************************//**
+ *  Factors tile column k.
+ *  The panel is split into more ranks than the panel threads set in the
+ *  context when the updates of the previous step leave threads idle.
+ **/
+static void plasma_pcgetrf_panel(plasma_desc_t A, int *ipiv, int k,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request)
 {
-    // Return if failed sequence.
-    if (sequence->status != PlasmaSuccess)
-        return;
-
-    // Read parameters from the context.
     plasma_context_t *plasma = plasma_context_self();
-
-    // Set tiling parameters.
     int ib = plasma->ib;
-
     int minmtnt = imin(A.mt, A.nt);
 
-    for (int k = 0; k < minmtnt; k++) {
-        plasma_complex32_t *a00, *a20;
-        a00 = A(k, k);
-        a20 = A(A.mt-1, k);
+    plasma_complex32_t *a00, *a20;
+    a00 = A(k, k);
+    a20 = A(A.mt-1, k);
 
-        // Create fake dependencies of the whole panel on its individual tiles.
-        // These tasks are inserted to generate a correct DAG rather than
-        // doing any useful work.
-        for (int m = k+1; m < A.mt-1; m++) {
-            plasma_complex32_t *amk = A(m, k);
-            #pragma omp task depend (in:amk[0]) \
-                             depend (inout:a00[0]) \
-                             priority(1)
-            {
-                // Do some funny work here. It appears so that the compiler
-                // might not insert the task if it is completely empty.
-                int l = 1;
-                l++;
-            }
-        }
+    // Dependencies of the whole panel on its individual tiles.
+#ifndef PLASMA_DEPEND_ITERATOR
+    plasma_omp_desc_gather(A, k+1, A.mt-1, k, k+1, a00);
+#endif
 
-        int ma00k = (A.mt-k-1)*A.mb;
-        int na00k = plasma_tile_nmain(A, k);
-        int lda20 = plasma_tile_mmain(A, A.mt-1);
+    int ma00k = (A.mt-k-1)*A.mb;
+    int na00k = plasma_tile_nmain(A, k);
+    int lda20 = plasma_tile_mmain(A, A.mt-1);
 
-        int nvak = plasma_tile_nview(A, k);
-        int mvak = plasma_tile_mview(A, k);
-        int ldak = plasma_tile_mmain(A, k);
-
-        int num_panel_threads = imin(plasma->max_panel_threads,
-                                     minmtnt-k);
-        // panel
-        #pragma omp task depend(inout:a00[0:ma00k*na00k]) \
-                         depend(inout:a20[0:lda20*nvak]) \
-                         depend(out:ipiv[k*A.mb:mvak]) \
-                         priority(1)
-        {
-            volatile int *max_idx = (int*)malloc(num_panel_threads*sizeof(int));
-            if (max_idx == NULL)
-                plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+    int nvak = plasma_tile_nview(A, k);
+    int mvak = plasma_tile_mview(A, k);
 
-            volatile plasma_complex32_t *max_val =
-                (plasma_complex32_t*)malloc(num_panel_threads*sizeof(
-                                            plasma_complex32_t));
-            if (max_val == NULL)
-                plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+    // Besides the panel threads set in the context, the panel is split
+    // among the threads left idle by the gemms of the previous step.
+    // Its ranks synchronize through a barrier, so they must all run at once,
+    // hence never outnumber the threads of the team running them, which
+    // may be fewer than at plasma_init(), e.g., in a caller's parallel region.
+    int ready_estimate = (A.mt-k)*(A.nt-k-1);
+    int num_panel_threads = imax(plasma->max_panel_threads,
+                                 plasma_nested_tasks(plasma, A.nb,
+                                                     ready_estimate, 1));
+    num_panel_threads = imin(num_panel_threads, omp_get_num_threads());
+    num_panel_threads = imin(num_panel_threads, minmtnt-k);
+    int recursive = plasma->getrf_panel == PlasmaPanelRecursive;
+    // panel
+    #pragma omp task depend(inout:a00[0:ma00k*na00k]) \
+                     depend(inout:a20[0:lda20*nvak]) \
+                     PLASMA_DEPEND_TILES(inout, A, k+1, A.mt-1, k, k+1) \
+                     depend(out:ipiv[k*A.mb:mvak]) \
+                     priority(1)
+    {
+        volatile int *max_idx = (int*)malloc(num_panel_threads*sizeof(int));
+        if (max_idx == NULL)
+            plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
 
-            volatile int info = 0;
+        volatile plasma_complex32_t *max_val =
+            (plasma_complex32_t*)malloc(num_panel_threads*sizeof(
+                                        plasma_complex32_t));
+        if (max_val == NULL)
+            plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
 
-            plasma_barrier_t barrier;
-            plasma_barrier_init(&barrier);
+        volatile int info = 0;
 
-            if (sequence->status == PlasmaSuccess) {
-                // If nesting would not be expensive on architectures such as
-                // KNL, this would resolve the issue with deadlocks caused by
-                // tasks expected to run are in fact not launched.
-                //#pragma omp parallel for shared(barrier)
-                //                         schedule(dynamic,1)
-                //                         num_threads(num_panel_threads)
-                #pragma omp taskloop untied shared(barrier) \
-                                     num_tasks(num_panel_threads) \
-                                     priority(2)
-                for (int rank = 0; rank < num_panel_threads; rank++) {
-                    {
-                        plasma_desc_t view =
-                            plasma_desc_view(A,
-                                             k*A.mb, k*A.nb,
-                                             A.m-k*A.mb, nvak);
+        plasma_barrier_t barrier;
+        plasma_barrier_init(&barrier);
 
+        plasma_time_t start = plasma_stats_start();
+        if (sequence->status == PlasmaSuccess) {
+            // If nesting would not be expensive on architectures such as
+            // KNL, this would resolve the issue with deadlocks caused by
+            // tasks expected to run are in fact not launched.
+            //#pragma omp parallel for shared(barrier)
+            //                         schedule(dynamic,1)
+            //                         num_threads(num_panel_threads)
+            #pragma omp taskloop untied shared(barrier) \
+                                 num_tasks(num_panel_threads) \
+                                 priority(plasma_task_priority_nested())
+            for (int rank = 0; rank < num_panel_threads; rank++) {
+                {
+                    plasma_desc_t view =
+                        plasma_desc_view(A,
+                                         k*A.mb, k*A.nb,
+                                         A.m-k*A.mb, nvak);
+
+                    if (recursive)
+                        plasma_core_cgetrf_recursive(
+                            view, &ipiv[k*A.mb], ib,
+                            rank, num_panel_threads,
+                            max_idx, max_val, &info,
+                            &barrier);
+                    else
                         plasma_core_cgetrf(view, &ipiv[k*A.mb], ib,
                                     rank, num_panel_threads,
                                     max_idx, max_val, &info,
                                     &barrier);
 
-                        if (info != 0)
-                            plasma_request_fail(sequence, request, k*A.mb+info);
-                    }
+                    if (info != 0)
+                        plasma_request_fail(sequence, request, k*A.mb+info);
                 }
             }
-            #pragma omp taskwait
+        }
+        #pragma omp taskwait
+        plasma_trace_tiles("www", (const void*[]){a00, a20, ipiv});
+        plasma_stats_stop(PlasmaStatsGetrf, PlasmaComplexFloat, start,
+                          1.0*(A.m-k*A.mb)*nvak*nvak-1.0*nvak*nvak*nvak/3.0,
+                          2.0*(A.m-k*A.mb)*nvak);
 
-            free((void*)max_idx);
-            free((void*)max_val);
+        free((void*)max_idx);
+        free((void*)max_val);
 
-            for (int i = k*A.mb+1; i <= imin(A.m, k*A.mb+nvak); i++)
-                ipiv[i-1] += k*A.mb;
-        }
+        for (int i = k*A.mb+1; i <= imin(A.m, k*A.mb+nvak); i++)
+            ipiv[i-1] += k*A.mb;
+    }
+}
 
-        // update
-        for (int n = k+1; n < A.nt; n++) {
-            plasma_complex32_t *a01, *a11, *a21;
-            a01 = A(k, n);
-            a11 = A(k+1, n);
-            a21 = A(A.mt-1, n);
-
-            int ma11k = (A.mt-k-2)*A.mb;
-            int na11n = plasma_tile_nmain(A, n);
-            int lda21 = plasma_tile_mmain(A, A.mt-1);
-
-            int nvan = plasma_tile_nview(A, n);
-
-            #pragma omp task depend(in:a00[0:ma00k*na00k]) \
-                             depend(in:a20[0:lda20*nvak]) \
-                             depend(in:ipiv[k*A.mb:mvak]) \
-                             depend(inout:a01[0:ldak*nvan]) \
-                             depend(inout:a11[0:ma11k*na11n]) \
-                             depend(inout:a21[0:lda21*nvan]) \
-                             priority(n == k+1)
-            {
-                if (sequence->status == PlasmaSuccess) {
-                    // geswp
-                    int k1 = k*A.mb+1;
-                    int k2 = imin(k*A.mb+A.mb, A.m);
-                    plasma_desc_t view =
-                        plasma_desc_view(A, 0, n*A.nb, A.m, nvan);
-                    plasma_core_cgeswp(PlasmaRowwise, view, k1, k2, ipiv, 1);
-
-                    // trsm
-                    plasma_core_ctrsm(PlasmaLeft, PlasmaLower,
-                               PlasmaNoTrans, PlasmaUnit,
-                               mvak, nvan,
-                               1.0, A(k, k), ldak,
-                                    A(k, n), ldak);
-                    // gemm
-                    for (int m = k+1; m < A.mt; m++) {
-                        int mvam = plasma_tile_mview(A, m);
-                        int ldam = plasma_tile_mmain(A, m);
-
-                        #pragma omp task priority(n == k+1)
-                        {
-                            plasma_core_cgemm(
-                                PlasmaNoTrans, PlasmaNoTrans,
-                                mvam, nvan, A.nb,
-                                -1.0, A(m, k), ldam,
-                                      A(k, n), ldak,
-                                1.0,  A(m, n), ldam);
-                        }
-                    }
+/***************************************************************************//**
+ *  Applies the pivoting and the factor of tile column k to tile column n.
+ **/
+static void plasma_pcgetrf_update(plasma_desc_t A, int *ipiv, int k, int n,
+                                  int priority,
+                                  plasma_sequence_t *sequence,
+                                  plasma_request_t *request)
+{
+    plasma_complex32_t *a00, *a20;
+    a00 = A(k, k);
+    a20 = A(A.mt-1, k);
+
+    int ma00k = (A.mt-k-1)*A.mb;
+    int na00k = plasma_tile_nmain(A, k);
+    int lda20 = plasma_tile_mmain(A, A.mt-1);
+
+    int nvak = plasma_tile_nview(A, k);
+    int mvak = plasma_tile_mview(A, k);
+    int ldak = plasma_tile_mmain(A, k);
+
+    plasma_complex32_t *a01, *a11, *a21;
+    a01 = A(k, n);
+    a11 = A(k+1, n);
+    a21 = A(A.mt-1, n);
+
+    int ma11k = (A.mt-k-2)*A.mb;
+    int na11n = plasma_tile_nmain(A, n);
+    int lda21 = plasma_tile_mmain(A, A.mt-1);
+
+    int nvan = plasma_tile_nview(A, n);
+
+    #pragma omp task depend(in:a00[0:ma00k*na00k]) \
+                     depend(in:a20[0:lda20*nvak]) \
+                     depend(in:ipiv[k*A.mb:mvak]) \
+                     depend(inout:a01[0:ldak*nvan]) \
+                     depend(inout:a11[0:ma11k*na11n]) \
+                     depend(inout:a21[0:lda21*nvan]) \
+                     priority(priority)
+    {
+        if (sequence->status == PlasmaSuccess) {
+            // geswp
+            int k1 = k*A.mb+1;
+            int k2 = imin(k*A.mb+A.mb, A.m);
+            plasma_desc_t view =
+                plasma_desc_view(A, 0, n*A.nb, A.m, nvan);
+            plasma_core_cgeswp(PlasmaRowwise, view, k1, k2, ipiv, 1);
+
+            // trsm
+            plasma_core_ctrsm(PlasmaLeft, PlasmaLower,
+                       PlasmaNoTrans, PlasmaUnit,
+                       mvak, nvan,
+                       1.0, A(k, k), ldak,
+                            A(k, n), ldak);
+            // gemm
+            for (int m = k+1; m < A.mt; m++) {
+                int mvam = plasma_tile_mview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+
+                #pragma omp task priority(priority)
+                {
+                    plasma_core_cgemm(
+                        PlasmaNoTrans, PlasmaNoTrans,
+                        mvam, nvan, A.nb,
+                        -1.0, A(m, k), ldam,
+                              A(k, n), ldak,
+                        1.0,  A(m, n), ldam);
                 }
-                #pragma omp taskwait
             }
         }
+        #pragma omp taskwait
     }
+}
 
-    // Multidependency of the whole ipiv on the individual chunks
-    // corresponding to tiles.
-    for (int m = 0; m < minmtnt; m++) {
-        // insert dummy task
-        #pragma omp task depend (in:ipiv[m*A.mb]) \
-                         depend (inout:ipiv[0])
-        {
-            int l = 1;
-            l++;
+/***************************************************************************//**
+ *  With a lookahead of d, the panels up to k+d are inserted before the rest
+ *  of the update of step k, each one as soon as its column is updated,
+ *  and the updates of their columns are prioritized.
+ **/
+void plasma_pcgetrf(plasma_desc_t A, int *ipiv,
+                    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    // Read parameters from the context.
+    plasma_context_t *plasma = plasma_context_self();
+
+    if (plasma->getrf_panel == PlasmaPanelTournament) {
+        plasma_pcgetrf_calu(A, ipiv, sequence, request);
+        return;
+    }
+
+    int lookahead = plasma->lookahead;
+
+    int minmtnt = imin(A.mt, A.nt);
+
+    // last panel inserted
+    int last = -1;
+    for (int k = 0; k < minmtnt; k++) {
+        // panels up to k+lookahead, after the updates of their columns
+        while (last < imin(k+lookahead, minmtnt-1)) {
+            last++;
+            for (int j = k; j < last; j++)
+                plasma_pcgetrf_update(A, ipiv, j, last, 1, sequence, request);
+            plasma_pcgetrf_panel(A, ipiv, last, sequence, request);
         }
+
+        // update of the other columns
+        for (int n = last+1; n < A.nt; n++)
+            plasma_pcgetrf_update(A, ipiv, k, n, n == k+1, sequence, request);
     }
 
+    // Dependencies of the whole ipiv on the individual chunks
+    // corresponding to tiles.
+#ifndef PLASMA_DEPEND_ITERATOR
+    plasma_omp_chunks_gather(ipiv, minmtnt, sizeof(int)*A.mb);
+#endif
+
     // pivoting to the left
     for (int k = 0; k < minmtnt-1; k++) {
         plasma_complex32_t *a10, *a20;
@@ -205,7 +268,9 @@ void plasma_pcgetrf(plasma_desc_t A, int *ipiv,
         int nvak = plasma_tile_nview(A, k);
 
         #pragma omp task depend(in:ipiv[0:imin(A.m,A.n)]) \
+                         PLASMA_DEPEND_CHUNKS(in, ipiv, 1, minmtnt, A.mb) \
                          depend(inout:a10[0:ma10k*na00k]) \
+                         PLASMA_DEPEND_TILES(inout, A, k+2, A.mt-1, k, k+1) \
                          depend(inout:a20[0:lda20*nvak])
         {
             if (sequence->status == PlasmaSuccess) {
@@ -217,17 +282,9 @@ void plasma_pcgetrf(plasma_desc_t A, int *ipiv,
             }
         }
 
-        // Multidependency of individual tiles on the whole panel.
-        for (int m = k+2; m < A.mt-1; m++) {
-            plasma_complex32_t *amk = A(m, k);
-            #pragma omp task depend (in:a10[0]) \
-                             depend (inout:amk[0])
-            {
-                // Do some funny work here. It appears so that the compiler
-                // might not insert the task if it is completely empty.
-                int l = 1;
-                l++;
-            }
-        }
+        // Dependencies of individual tiles on the whole panel.
+#ifndef PLASMA_DEPEND_ITERATOR
+        plasma_omp_desc_scatter(A, k+2, A.mt-1, k, k+1, a10);
+#endif
     }
 }
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/compute/pzhetrf_aasen.c, normal z -> c, Fri Sep 28 17:38:12 2018
+ * @generated from compute/pzhetrf_aasen.c, normal z -> c, Sat Oct 17 03:07:10 2026
  *
  **/
 #include <math.h>
@@ -15,6 +15,7 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_tile_cache.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 #include <plasma_core_blas.h>
@@ -60,6 +61,11 @@ void plasma_pchetrf_aasen(plasma_enum_t uplo,
     int ib = plasma->ib;
     int wmt = W.mt-(1+4*A.mt);
 
+    // Run the offloaded tasks on the devices owning the tiles they write.
+    // The other tasks access the tiles on the host, so the tiles do not
+    // stay on the devices.
+    plasma_tile_cache_begin((plasma_desc_t[]){A, T, W}, 3, 0);
+
     // Creaet views for the workspaces
     plasma_desc_t W2
          = plasma_desc_view(W, A.mb,            0,   A.mt*A.mb, A.nb);
@@ -629,4 +635,5 @@ void plasma_pchetrf_aasen(plasma_enum_t uplo,
     else {
         // TODO: Upper
     }
+    plasma_tile_cache_end();
 }
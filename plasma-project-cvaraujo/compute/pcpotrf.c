@@ -6,22 +6,186 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/compute/pzpotrf.c, normal z -> c, Fri Sep 28 17:38:13 2018
+ * @generated from compute/pzpotrf.c, normal z -> c, Sat Oct 17 04:43:40 2026
  *
  **/
 
 #include "plasma_async.h"
+#include "plasma_batch.h"
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_nested.h"
+#include "plasma_tile_cache.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 #include <plasma_core_blas.h>
 
 #define A(m, n) (plasma_complex32_t*)plasma_tile_addr(A, m, n)
 
+/***************************************************************************//**
+ *  Factors tile column k of the lower triangle.
+ *  The diagonal tile and the tiles below it are split into nested tasks
+ *  when the updates of the previous step leave threads idle.
+ **/
+static void plasma_pcpotrf_panel_lower(plasma_desc_t A, int k,
+                                       plasma_sequence_t *sequence,
+                                       plasma_request_t *request)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    // Estimated by the trailing tiles updated by the previous step,
+    // although not all of their updates are ready yet.
+    int ready_estimate = (A.mt-k)*(A.mt-k-1)/2;
+
+    int mvak = plasma_tile_mview(A, k);
+    int ldak = plasma_tile_mmain(A, k);
+    plasma_core_omp_cnested_potrf(
+        PlasmaLower, mvak,
+        A(k, k), ldak,
+        plasma->ib, plasma_nested_tasks(plasma, A.nb, ready_estimate, 1),
+        A.nb*k,
+        sequence, request);
+
+    int num_tasks = plasma_nested_tasks(plasma, A.nb, ready_estimate,
+                                        A.mt-k-1);
+    for (int m = k+1; m < A.mt; m++) {
+        int mvam = plasma_tile_mview(A, m);
+        int ldam = plasma_tile_mmain(A, m);
+        plasma_core_omp_cnested_trsm(
+            PlasmaRight, PlasmaLower,
+            PlasmaConjTrans, PlasmaNonUnit,
+            mvam, A.mb,
+            1.0, A(k, k), ldak,
+                 A(m, k), ldam,
+            num_tasks,
+            sequence, request);
+    }
+}
+
+/***************************************************************************//**
+ *  Factors tile row k of the upper triangle.
+ *  The diagonal tile and the tiles right of it are split into nested tasks
+ *  when the updates of the previous step leave threads idle.
+ **/
+static void plasma_pcpotrf_panel_upper(plasma_desc_t A, int k,
+                                       plasma_sequence_t *sequence,
+                                       plasma_request_t *request)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    // Estimated by the trailing tiles updated by the previous step,
+    // although not all of their updates are ready yet.
+    int ready_estimate = (A.nt-k)*(A.nt-k-1)/2;
+
+    int nvak = plasma_tile_nview(A, k);
+    int ldak = plasma_tile_mmain(A, k);
+    plasma_core_omp_cnested_potrf(
+        PlasmaUpper, nvak,
+        A(k, k), ldak,
+        plasma->ib, plasma_nested_tasks(plasma, A.nb, ready_estimate, 1),
+        A.nb*k,
+        sequence, request);
+
+    int num_tasks = plasma_nested_tasks(plasma, A.nb, ready_estimate,
+                                        A.nt-k-1);
+    for (int m = k+1; m < A.nt; m++) {
+        int nvam = plasma_tile_nview(A, m);
+        plasma_core_omp_cnested_trsm(
+            PlasmaLeft, PlasmaUpper,
+            PlasmaConjTrans, PlasmaNonUnit,
+            A.nb, nvam,
+            1.0, A(k, k), ldak,
+                 A(k, m), ldak,
+            num_tasks,
+            sequence, request);
+    }
+}
+
+/***************************************************************************//**
+ *  Applies tile column k of the lower triangle to tile column n.
+ **/
+static void plasma_pcpotrf_update_lower(plasma_desc_t A, int k, int n,
+                                        plasma_sequence_t *sequence,
+                                        plasma_request_t *request)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    plasma_batch_t batch;
+
+    // Submit the updates of up to nbatch tiles of the column per task.
+    int nbatch = plasma_batch_size(plasma, A.nb, (A.mt-k-1)*(A.mt-k-2)/2);
+
+    int mvan = plasma_tile_mview(A, n);
+    int ldan = plasma_tile_mmain(A, n);
+    plasma_core_omp_cherk(
+        PlasmaLower, PlasmaNoTrans,
+        mvan, A.mb,
+        -1.0, A(n, k), ldan,
+         1.0, A(n, n), ldan,
+        sequence, request);
+
+    for (int m0 = n+1; m0 < A.mt; m0 += nbatch) {
+        plasma_batch_init(&batch);
+        for (int m = m0; m < imin(m0+nbatch, A.mt); m++) {
+            int mvam = plasma_tile_mview(A, m);
+            int ldam = plasma_tile_mmain(A, m);
+            plasma_batch_add(&batch, mvam, A.mb, A.mb,
+                             A(m, k), ldam,
+                             A(n, k), ldan,
+                             A(m, n), ldam);
+        }
+        plasma_core_omp_cgemm_batch(
+            PlasmaNoTrans, PlasmaConjTrans,
+            -1.0, &batch,
+             1.0,
+            sequence, request);
+    }
+}
+
+/***************************************************************************//**
+ *  Applies tile row k of the upper triangle to tile row n.
+ **/
+static void plasma_pcpotrf_update_upper(plasma_desc_t A, int k, int n,
+                                        plasma_sequence_t *sequence,
+                                        plasma_request_t *request)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    plasma_batch_t batch;
+
+    // Submit the updates of up to nbatch tiles of the row per task.
+    int nbatch = plasma_batch_size(plasma, A.nb, (A.nt-k-1)*(A.nt-k-2)/2);
+
+    int ldak = plasma_tile_mmain(A, k);
+    int nvan = plasma_tile_nview(A, n);
+    int ldan = plasma_tile_mmain(A, n);
+    plasma_core_omp_cherk(
+        PlasmaUpper, PlasmaConjTrans,
+        nvan, A.mb,
+        -1.0, A(k, n), ldak,
+         1.0, A(n, n), ldan,
+        sequence, request);
+
+    for (int m0 = n+1; m0 < A.nt; m0 += nbatch) {
+        plasma_batch_init(&batch);
+        for (int m = m0; m < imin(m0+nbatch, A.nt); m++) {
+            int nvam = plasma_tile_nview(A, m);
+            plasma_batch_add(&batch, A.mb, nvam, A.mb,
+                             A(k, n), ldak,
+                             A(k, m), ldak,
+                             A(n, m), ldan);
+        }
+        plasma_core_omp_cgemm_batch(
+            PlasmaConjTrans, PlasmaNoTrans,
+            -1.0, &batch,
+             1.0,
+            sequence, request);
+    }
+}
+
 /***************************************************************************//**
  *  Parallel tile Cholesky factorization.
+ *  The trailing matrix is updated one tile column (row) at a time, so that
+ *  with a lookahead of d the panels up to k+d are inserted before the rest
+ *  of the update of step k, each one as soon as its column is updated.
+ *  The panels and the updates of their columns are prioritized.
  * @see plasma_omp_cpotrf
  ******************************************************************************/
 void plasma_pcpotrf(plasma_enum_t uplo, plasma_desc_t A,
@@ -31,51 +195,35 @@ void plasma_pcpotrf(plasma_enum_t uplo, plasma_desc_t A,
     if (sequence->status != PlasmaSuccess)
         return;
 
+    // Run the offloaded tasks on the devices owning the tiles of A,
+    // and keep the offloaded tiles on the devices until the end.
+    plasma_tile_cache_begin(&A, 1, 1);
+
+    // Read parameters from the context.
+    plasma_context_t *plasma = plasma_context_self();
+    int lookahead = plasma->lookahead;
+
+    // last panel inserted
+    int last = -1;
+
     //==============
     // PlasmaLower
     //==============
     if (uplo == PlasmaLower) {
         for (int k = 0; k < A.mt; k++) {
-            int mvak = plasma_tile_mview(A, k);
-            int ldak = plasma_tile_mmain(A, k);
-            plasma_core_omp_cpotrf(
-                PlasmaLower, mvak,
-                A(k, k), ldak,
-                A.nb*k,
-                sequence, request);
-
-            for (int m = k+1; m < A.mt; m++) {
-                int mvam = plasma_tile_mview(A, m);
-                int ldam = plasma_tile_mmain(A, m);
-                plasma_core_omp_ctrsm(
-                    PlasmaRight, PlasmaLower,
-                    PlasmaConjTrans, PlasmaNonUnit,
-                    mvam, A.mb,
-                    1.0, A(k, k), ldak,
-                         A(m, k), ldam,
-                    sequence, request);
-            }
-            for (int m = k+1; m < A.mt; m++) {
-                int mvam = plasma_tile_mview(A, m);
-                int ldam = plasma_tile_mmain(A, m);
-                plasma_core_omp_cherk(
-                    PlasmaLower, PlasmaNoTrans,
-                    mvam, A.mb,
-                    -1.0, A(m, k), ldam,
-                     1.0, A(m, m), ldam,
-                    sequence, request);
-
-                for (int n = k+1; n < m; n++) {
-                    int ldan = plasma_tile_mmain(A, n);
-                    plasma_core_omp_cgemm(
-                        PlasmaNoTrans, PlasmaConjTrans,
-                        mvam, A.mb, A.mb,
-                        -1.0, A(m, k), ldam,
-                              A(n, k), ldan,
-                         1.0, A(m, n), ldam,
-                        sequence, request);
-                }
+            // panels up to k+lookahead, after the updates of their columns
+            plasma_task_priority_set(lookahead > 0);
+            while (last < imin(k+lookahead, A.mt-1)) {
+                last++;
+                for (int j = k; j < last; j++)
+                    plasma_pcpotrf_update_lower(A, j, last, sequence, request);
+                plasma_pcpotrf_panel_lower(A, last, sequence, request);
             }
+
+            // update of the other columns
+            plasma_task_priority_set(0);
+            for (int n = last+1; n < A.mt; n++)
+                plasma_pcpotrf_update_lower(A, k, n, sequence, request);
         }
     }
     //==============
@@ -83,45 +231,21 @@ void plasma_pcpotrf(plasma_enum_t uplo, plasma_desc_t A,
     //==============
     else {
         for (int k = 0; k < A.nt; k++) {
-            int nvak = plasma_tile_nview(A, k);
-            int ldak = plasma_tile_mmain(A, k);
-            plasma_core_omp_cpotrf(
-                PlasmaUpper, nvak,
-                A(k, k), ldak,
-                A.nb*k,
-                sequence, request);
-
-            for (int m = k+1; m < A.nt; m++) {
-                int nvam = plasma_tile_nview(A, m);
-                plasma_core_omp_ctrsm(
-                    PlasmaLeft, PlasmaUpper,
-                    PlasmaConjTrans, PlasmaNonUnit,
-                    A.nb, nvam,
-                    1.0, A(k, k), ldak,
-                         A(k, m), ldak,
-                    sequence, request);
-            }
-            for (int m = k+1; m < A.nt; m++) {
-                int nvam = plasma_tile_nview(A, m);
-                int ldam = plasma_tile_mmain(A, m);
-                plasma_core_omp_cherk(
-                    PlasmaUpper, PlasmaConjTrans,
-                    nvam, A.mb,
-                    -1.0, A(k, m), ldak,
-                     1.0, A(m, m), ldam,
-                    sequence, request);
-
-                for (int n = k+1; n < m; n++) {
-                    int ldan = plasma_tile_mmain(A, n);
-                    plasma_core_omp_cgemm(
-                        PlasmaConjTrans, PlasmaNoTrans,
-                        A.mb, nvam, A.mb,
-                        -1.0, A(k, n), ldak,
-                              A(k, m), ldak,
-                         1.0, A(n, m), ldan,
-                        sequence, request);
-                }
+            // panels up to k+lookahead, after the updates of their rows
+            plasma_task_priority_set(lookahead > 0);
+            while (last < imin(k+lookahead, A.nt-1)) {
+                last++;
+                for (int j = k; j < last; j++)
+                    plasma_pcpotrf_update_upper(A, j, last, sequence, request);
+                plasma_pcpotrf_panel_upper(A, last, sequence, request);
             }
+
+            // update of the other rows
+            plasma_task_priority_set(0);
+            for (int n = last+1; n < A.nt; n++)
+                plasma_pcpotrf_update_upper(A, k, n, sequence, request);
         }
     }
+    plasma_task_priority_set(0);
+    plasma_tile_cache_end();
 }
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/compute/pztrsm.c, normal z -> c, Fri Sep 28 17:38:15 2018
+ * @generated from compute/pztrsm.c, normal z -> c, Sat Oct 17 03:07:09 2026
  *
  **/
 
@@ -14,6 +14,7 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_tile_cache.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 #include <plasma_core_blas.h>
@@ -35,6 +36,10 @@ void plasma_pctrsm(plasma_enum_t side, plasma_enum_t uplo,
     if (sequence->status != PlasmaSuccess)
         return;
 
+    // Run the offloaded tasks on the devices owning the tiles of B,
+    // and keep the offloaded tiles on the devices until the end.
+    plasma_tile_cache_begin(&B, 1, 1);
+
     if (side == PlasmaLeft) {
         if (uplo == PlasmaUpper) {
             //===========================================
@@ -308,4 +313,5 @@ void plasma_pctrsm(plasma_enum_t side, plasma_enum_t uplo,
             }
         }
     }
+    plasma_tile_cache_end();
 }
@@ -0,0 +1,56 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pzge2desc_inplace.c, normal z -> d, Sat Oct 17 04:31:32 2026
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_depend.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include <plasma_core_blas.h>
+
+/***************************************************************************//**
+ *  Parallel in-place translation from LAPACK to tile layout.
+ *  A is a descriptor initialized by plasma_desc_general_inplace_init(),
+ *  so that each tile column occupies the same memory in both layouts
+ *  and the tile columns are translated independently.
+ *  The translation of a tile column is a single task keyed on its first
+ *  tile, followed by a fence releasing the individual tiles.
+ *  The translation runs whatever the status of the sequence, as does its
+ *  inverse, so that the caller's array always gets back to LAPACK layout.
+ **/
+void plasma_pdge2desc_inplace(plasma_desc_t A,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request)
+{
+    for (int n = 0; n < A.nt; n++) {
+        double *a0n = (double*)plasma_tile_addr(A, 0, n);
+        plasma_core_omp_dgetmi_always(A.mt, A.nb, A.mb, a0n);
+        plasma_omp_desc_fence_column(A, n);
+    }
+}
+
+/***************************************************************************//**
+ *  Parallel in-place translation from tile to LAPACK layout.
+ *  Reverses plasma_pdge2desc_inplace(), also after a failed computation,
+ *  leaving the partial results in the caller's array.
+ **/
+void plasma_pddesc2ge_inplace(plasma_desc_t A,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request)
+{
+    for (int n = 0; n < A.nt; n++) {
+        double *a0n = (double*)plasma_tile_addr(A, 0, n);
+        plasma_omp_desc_fence_column(A, n);
+        plasma_core_omp_dgetmi_always(A.nb, A.mt, A.mb, a0n);
+    }
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/compute/pzgeqrf.c, normal z -> d, Fri Sep 28 17:38:11 2018
+ * @generated from compute/pzgeqrf.c, normal z -> d, Sat Oct 17 04:43:40 2026
  *
  **/
 
@@ -14,6 +14,7 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_nested.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 #include <plasma_core_blas.h>
@@ -21,8 +22,91 @@
 #define A(m, n) (double*)plasma_tile_addr(A, m, n)
 #define T(m, n) (double*)plasma_tile_addr(T, m, n)
 
+/***************************************************************************//**
+ *  Factors tile column k.
+ *  The diagonal tile is split into nested tasks when the updates of the
+ *  previous step leave threads idle.
+ **/
+static void plasma_pdgeqrf_panel(plasma_desc_t A, plasma_desc_t T, int k,
+                                 plasma_workspace_t work,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    int ib = T.mb;
+
+    // Estimated by the columns updated by the previous step,
+    // each one a chain of tsmqr.
+    int ready_estimate = A.nt-k-1;
+
+    int mvak = plasma_tile_mview(A, k);
+    int nvak = plasma_tile_nview(A, k);
+    int ldak = plasma_tile_mmain(A, k);
+    plasma_core_omp_dnested_geqrt(
+        mvak, nvak, ib,
+        A(k, k), ldak,
+        T(k, k), T.mb,
+        work,
+        plasma_nested_tasks(plasma, A.nb, ready_estimate, 1),
+        sequence, request);
+
+    for (int m = k+1; m < A.mt; m++) {
+        int mvam = plasma_tile_mview(A, m);
+        int ldam = plasma_tile_mmain(A, m);
+        plasma_core_omp_dtsqrt(
+            mvam, nvak, ib,
+            A(k, k), ldak,
+            A(m, k), ldam,
+            T(m, k), T.mb,
+            work,
+            sequence, request);
+    }
+}
+
+/***************************************************************************//**
+ *  Applies the reflectors of tile column k to tile column n.
+ **/
+static void plasma_pdgeqrf_update(plasma_desc_t A, plasma_desc_t T,
+                                  int k, int n,
+                                  plasma_workspace_t work,
+                                  plasma_sequence_t *sequence,
+                                  plasma_request_t *request)
+{
+    int ib = T.mb;
+
+    int mvak = plasma_tile_mview(A, k);
+    int nvak = plasma_tile_nview(A, k);
+    int ldak = plasma_tile_mmain(A, k);
+    int nvan = plasma_tile_nview(A, n);
+    plasma_core_omp_dormqr(
+        PlasmaLeft, PlasmaTrans,
+        mvak, nvan, imin(mvak, nvak), ib,
+        A(k, k), ldak,
+        T(k, k), T.mb,
+        A(k, n), ldak,
+        work,
+        sequence, request);
+
+    for (int m = k+1; m < A.mt; m++) {
+        int mvam = plasma_tile_mview(A, m);
+        int ldam = plasma_tile_mmain(A, m);
+        plasma_core_omp_dtsmqr(
+            PlasmaLeft, PlasmaTrans,
+            A.mb, nvan, mvam, nvan, nvak, ib,
+            A(k, n), ldak,
+            A(m, n), ldam,
+            A(m, k), ldam,
+            T(m, k), T.mb,
+            work,
+            sequence, request);
+    }
+}
+
 /***************************************************************************//**
  *  Parallel tile QR factorization - dynamic scheduling
+ *  With a lookahead of d, the trailing matrix is updated column by column,
+ *  the panels up to k+d are inserted before the rest of the update of step k,
+ *  each one as soon as its column is updated, and their tasks are prioritized.
  * @see plasma_omp_dgeqrf
  **/
 void plasma_pdgeqrf(plasma_desc_t A, plasma_desc_t T,
@@ -33,6 +117,34 @@ void plasma_pdgeqrf(plasma_desc_t A, plasma_desc_t T,
     if (sequence->status != PlasmaSuccess)
         return;
 
+    // Read parameters from the context.
+    plasma_context_t *plasma = plasma_context_self();
+    int lookahead = plasma->lookahead;
+
+    if (lookahead > 0) {
+        int minmtnt = imin(A.mt, A.nt);
+        // last panel inserted
+        int last = -1;
+        for (int k = 0; k < minmtnt; k++) {
+            // panels up to k+lookahead, after the updates of their columns
+            plasma_task_priority_set(1);
+            while (last < imin(k+lookahead, minmtnt-1)) {
+                last++;
+                for (int j = k; j < last; j++)
+                    plasma_pdgeqrf_update(A, T, j, last, work,
+                                          sequence, request);
+                plasma_pdgeqrf_panel(A, T, last, work, sequence, request);
+            }
+
+            // update of the other columns
+            plasma_task_priority_set(0);
+            for (int n = last+1; n < A.nt; n++)
+                plasma_pdgeqrf_update(A, T, k, n, work, sequence, request);
+        }
+        plasma_task_priority_set(0);
+        return;
+    }
+
     // Set inner blocking from the T tile row-dimension.
     int ib = T.mb;
 
@@ -40,11 +152,12 @@ void plasma_pdgeqrf(plasma_desc_t A, plasma_desc_t T,
         int mvak = plasma_tile_mview(A, k);
         int nvak = plasma_tile_nview(A, k);
         int ldak = plasma_tile_mmain(A, k);
-        plasma_core_omp_dgeqrt(
+        plasma_core_omp_dnested_geqrt(
             mvak, nvak, ib,
             A(k, k), ldak,
             T(k, k), T.mb,
             work,
+            plasma_nested_tasks(plasma, A.nb, A.nt-k-1, 1),
             sequence, request);
 
         for (int n = k+1; n < A.nt; n++) {
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/compute/pzlag2c.c, mixed zc -> ds, Fri Sep 28 17:38:17 2018
+ * @generated from compute/pzlag2c.c, mixed zc -> ds, Sat Oct 17 01:56:43 2026
  *
  **/
 
@@ -50,7 +50,8 @@ void plasma_pdlag2s(plasma_desc_t A, plasma_desc_t As,
     // Return if failed sequence.
     if (sequence->status != PlasmaSuccess)
         return;
-    if (A.type == PlasmaGeneral && As.type == PlasmaGeneral) {
+    if ((A.type  == PlasmaGeneral || A.type  == PlasmaGeneralStrided) &&
+        (As.type == PlasmaGeneral || As.type == PlasmaGeneralStrided)) {
         for (int m = 0; m < A.mt; m++) {
             int am  = plasma_tile_mview(A,  m);
             int lda = plasma_tile_mmain(A,  m);
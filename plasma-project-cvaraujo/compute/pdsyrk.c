@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/compute/pzsyrk.c, normal z -> d, Fri Sep 28 17:38:14 2018
+ * @generated from compute/pzsyrk.c, normal z -> d, Sat Oct 17 03:07:09 2026
  *
  **/
 
@@ -14,6 +14,7 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_tile_cache.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 #include <plasma_core_blas.h>
@@ -34,6 +35,10 @@ void plasma_pdsyrk(plasma_enum_t uplo, plasma_enum_t trans,
     if (sequence->status != PlasmaSuccess)
         return;
 
+    // Run the offloaded tasks on the devices owning the tiles of C,
+    // and keep the offloaded tiles on the devices until the end.
+    plasma_tile_cache_begin(&C, 1, 1);
+
     for (int n = 0; n < C.nt; n++) {
         int nvcn = plasma_tile_nview(C, n);
         int ldan = plasma_tile_mmain(A, n);
@@ -152,4 +157,5 @@ void plasma_pdsyrk(plasma_enum_t uplo, plasma_enum_t trans,
             }
         }
     }
+    plasma_tile_cache_end();
 }
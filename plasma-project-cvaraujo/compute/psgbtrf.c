@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/compute/pzgbtrf.c, normal z -> s, Fri Sep 28 17:38:10 2018
+ * @generated from compute/pzgbtrf.c, normal z -> s, Sat Oct 17 02:49:18 2026
  *
  **/
 
@@ -72,6 +72,7 @@ void plasma_psgbtrf(plasma_desc_t A, int *ipiv,
             plasma_barrier_t barrier;
             plasma_barrier_init(&barrier);
 
+            plasma_time_t start = plasma_stats_start();
             if (sequence->status == PlasmaSuccess) {
                 for (int rank = 0; rank < num_panel_threads; rank++) {
                     #pragma omp task shared(barrier) priority(1)
@@ -92,6 +93,10 @@ void plasma_psgbtrf(plasma_desc_t A, int *ipiv,
                 }
             }
             #pragma omp taskwait
+            plasma_trace_tiles("ww", (const void*[]){a00, ipivk});
+            plasma_stats_stop(PlasmaStatsGetrf, PlasmaRealFloat, start,
+                              1.0*mak*nvak*nvak-1.0*nvak*nvak*nvak/3.0,
+                              2.0*mak*nvak);
 
             free((void*)max_idx);
             free((void*)max_val);
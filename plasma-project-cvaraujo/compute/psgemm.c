@@ -6,14 +6,16 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/compute/pzgemm.c, normal z -> s, Fri Sep 28 17:38:11 2018
+ * @generated from compute/pzgemm.c, normal z -> s, Sat Oct 17 03:16:56 2026
  *
  **/
 
 #include "plasma_async.h"
+#include "plasma_batch.h"
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_tile_cache.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 #include <plasma_core_blas.h>
@@ -37,12 +39,22 @@ void plasma_psgemm(plasma_enum_t transa, plasma_enum_t transb,
     // Return if failed sequence.
     if (sequence->status != PlasmaSuccess)
         return;
-    if (A.type == PlasmaGeneral) {
+
+    // Run the offloaded tasks on the devices owning the tiles of C,
+    // and keep the offloaded tiles on the devices until the end.
+    plasma_tile_cache_begin(&C, 1, 1);
+
+    if (A.type == PlasmaGeneral || A.type == PlasmaGeneralStrided) {
+        // Submit the updates of up to nbatch tiles of a row of C per task.
+        plasma_context_t *plasma = plasma_context_self();
+        int nbatch = plasma_batch_size(plasma, C.nb, C.mt*C.nt);
+        plasma_batch_t batch;
+
         for (int m = 0; m < C.mt; m++) {
             int mvcm = plasma_tile_mview(C, m);
             int ldcm = plasma_tile_mmain(C, m);
-            for (int n = 0; n < C.nt; n++) {
-                int nvcn = plasma_tile_nview(C, n);
+            for (int n0 = 0; n0 < C.nt; n0 += nbatch) {
+                int n1 = imin(n0+nbatch, C.nt);
                 //=========================================
                 // alpha*A*B does not contribute; scale C
                 //=========================================
@@ -50,12 +62,18 @@ void plasma_psgemm(plasma_enum_t transa, plasma_enum_t transb,
                 if (alpha == 0.0 || inner_k == 0) {
                     int ldam = imax(1, plasma_tile_mmain(A, 0));
                     int ldbk = imax(1, plasma_tile_mmain(B, 0));
-                    plasma_core_omp_sgemm(
+                    plasma_batch_init(&batch);
+                    for (int n = n0; n < n1; n++) {
+                        int nvcn = plasma_tile_nview(C, n);
+                        plasma_batch_add(&batch, mvcm, nvcn, 0,
+                                         A(0, 0), ldam,
+                                         B(0, 0), ldbk,
+                                         C(m, n), ldcm);
+                    }
+                    plasma_core_omp_sgemm_batch(
                         transa, transb,
-                        mvcm, nvcn, 0,
-                        alpha, A(0, 0), ldam,
-                        B(0, 0), ldbk,
-                        beta,  C(m, n), ldcm,
+                        alpha, &batch,
+                        beta,
                         sequence, request);
                 }
                 else if (transa == PlasmaNoTrans) {
@@ -68,12 +86,18 @@ void plasma_psgemm(plasma_enum_t transa, plasma_enum_t transb,
                             int nvak = plasma_tile_nview(A, k);
                             int ldbk = plasma_tile_mmain(B, k);
                             float zbeta = k == 0 ? beta : 1.0;
-                            plasma_core_omp_sgemm(
+                            plasma_batch_init(&batch);
+                            for (int n = n0; n < n1; n++) {
+                                int nvcn = plasma_tile_nview(C, n);
+                                plasma_batch_add(&batch, mvcm, nvcn, nvak,
+                                                 A(m, k), ldam,
+                                                 B(k, n), ldbk,
+                                                 C(m, n), ldcm);
+                            }
+                            plasma_core_omp_sgemm_batch(
                                 transa, transb,
-                                mvcm, nvcn, nvak,
-                                alpha, A(m, k), ldam,
-                                B(k, n), ldbk,
-                                zbeta, C(m, n), ldcm,
+                                alpha, &batch,
+                                zbeta,
                                 sequence, request);
                         }
                     }
@@ -81,16 +105,22 @@ void plasma_psgemm(plasma_enum_t transa, plasma_enum_t transb,
                     // PlasmaNoTrans / Plasma[_Conj]Trans
                     //=====================================
                     else {
-                        int ldbn = plasma_tile_mmain(B, n);
                         for (int k = 0; k < A.nt; k++) {
                             int nvak = plasma_tile_nview(A, k);
                             float zbeta = k == 0 ? beta : 1.0;
-                            plasma_core_omp_sgemm(
+                            plasma_batch_init(&batch);
+                            for (int n = n0; n < n1; n++) {
+                                int nvcn = plasma_tile_nview(C, n);
+                                int ldbn = plasma_tile_mmain(B, n);
+                                plasma_batch_add(&batch, mvcm, nvcn, nvak,
+                                                 A(m, k), ldam,
+                                                 B(n, k), ldbn,
+                                                 C(m, n), ldcm);
+                            }
+                            plasma_core_omp_sgemm_batch(
                                 transa, transb,
-                                mvcm, nvcn, nvak,
-                                alpha, A(m, k), ldam,
-                                B(n, k), ldbn,
-                                zbeta, C(m, n), ldcm,
+                                alpha, &batch,
+                                zbeta,
                                 sequence, request);
                         }
                     }
@@ -105,12 +135,18 @@ void plasma_psgemm(plasma_enum_t transa, plasma_enum_t transb,
                             int ldak = plasma_tile_mmain(A, k);
                             int ldbk = plasma_tile_mmain(B, k);
                             float zbeta = k == 0 ? beta : 1.0;
-                            plasma_core_omp_sgemm(
+                            plasma_batch_init(&batch);
+                            for (int n = n0; n < n1; n++) {
+                                int nvcn = plasma_tile_nview(C, n);
+                                plasma_batch_add(&batch, mvcm, nvcn, mvak,
+                                                 A(k, m), ldak,
+                                                 B(k, n), ldbk,
+                                                 C(m, n), ldcm);
+                            }
+                            plasma_core_omp_sgemm_batch(
                                 transa, transb,
-                                mvcm, nvcn, mvak,
-                                alpha, A(k, m), ldak,
-                                B(k, n), ldbk,
-                                zbeta, C(m, n), ldcm,
+                                alpha, &batch,
+                                zbeta,
                                 sequence, request);
                         }
                     }
@@ -118,17 +154,23 @@ void plasma_psgemm(plasma_enum_t transa, plasma_enum_t transb,
                     // Plasma[_Conj]Trans / Plasma[_Conj]Trans
                     //==========================================
                     else {
-                        int ldbn = plasma_tile_mmain(B, n);
                         for (int k = 0; k < A.mt; k++) {
                             int mvak = plasma_tile_mview(A, k);
                             int ldak = plasma_tile_mmain(A, k);
                             float zbeta = k == 0 ? beta : 1.0;
-                            plasma_core_omp_sgemm(
+                            plasma_batch_init(&batch);
+                            for (int n = n0; n < n1; n++) {
+                                int nvcn = plasma_tile_nview(C, n);
+                                int ldbn = plasma_tile_mmain(B, n);
+                                plasma_batch_add(&batch, mvcm, nvcn, mvak,
+                                                 A(k, m), ldak,
+                                                 B(n, k), ldbn,
+                                                 C(m, n), ldcm);
+                            }
+                            plasma_core_omp_sgemm_batch(
                                 transa, transb,
-                                mvcm, nvcn, mvak,
-                                alpha, A(k, m), ldak,
-                                B(n, k), ldbn,
-                                zbeta, C(m, n), ldcm,
+                                alpha, &batch,
+                                zbeta,
                                 sequence, request);
                         }
                     }
@@ -205,4 +247,5 @@ void plasma_psgemm(plasma_enum_t transa, plasma_enum_t transb,
             }
         }
     }
+    plasma_tile_cache_end();
 }
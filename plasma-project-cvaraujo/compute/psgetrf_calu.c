@@ -0,0 +1,381 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from compute/pzgetrf_calu.c, normal z -> s, Sat Oct 17 04:43:40 2026
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_depend.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include <plasma_core_blas.h>
+
+#include <string.h>
+
+#define A(m, n) (float*)plasma_tile_addr(A, m, n)
+#define W(m) (&work[(size_t)(m)*ldw*A.nb])
+#define IW(m) (&iwork[(size_t)(m)*ldw])
+
+/***************************************************************************//**
+ *  Factors tile column k by tournament pivoting.
+ **/
+static void plasma_psgetrf_calu_panel(plasma_desc_t A, int *ipiv, int k,
+                                      float *work,
+                                      int *iwork, int *count, int ldw,
+                                      plasma_sequence_t *sequence,
+                                      plasma_request_t *request)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    int ib = plasma->ib;
+
+    float *a00, *wk;
+    a00 = A(k, k);
+    wk = W(k);
+    int *ik = IW(k);
+    int *ck = &count[k];
+
+    int nvak = plasma_tile_nview(A, k);
+    int mvak = plasma_tile_mview(A, k);
+    int ldak = plasma_tile_mmain(A, k);
+    int mpk = A.m-k*A.mb;
+
+    // local pivoting of each tile
+    // The tiles below the diagonal are updated within the task
+    // updating the diagonal tile, hence the dependency on a00.
+    for (int m = k; m < A.mt; m++) {
+        float *amk = A(m, k);
+        float *wm = W(m);
+        int *im = IW(m);
+        int *cm = &count[m];
+        int mvam = plasma_tile_mview(A, m);
+        int ldam = plasma_tile_mmain(A, m);
+
+        #pragma omp task depend(in:a00[0]) \
+                         depend(in:amk[0]) \
+                         depend(out:wm[0]) \
+                         priority(1)
+        {
+            if (sequence->status == PlasmaSuccess) {
+                plasma_time_t start = plasma_stats_start();
+                plasma_core_slacpy(PlasmaGeneral, PlasmaNoTrans,
+                                   mvam, nvak,
+                                   amk, ldam,
+                                   wm, ldw);
+                for (int i = 0; i < mvam; i++)
+                    im[i] = (m-k)*A.mb+i;
+                *cm = imin(mvam, nvak);
+
+                int retval = plasma_core_sgetrf_tntpiv(mvam, nvak,
+                                                       wm, ldw, im);
+                if (retval != PlasmaSuccess)
+                    plasma_request_fail(sequence, request, retval);
+                plasma_trace_tiles("rrw", (const void*[]){a00, amk, wm});
+                plasma_stats_stop(PlasmaStatsGetrf, PlasmaRealFloat, start,
+                                  1.0*mvam*nvak*nvak, 2.0*mvam*nvak);
+            }
+        }
+    }
+
+    // tournament over a binary tree
+    for (int s = 1; s < A.mt-k; s *= 2) {
+        for (int m = k; m+s < A.mt; m += 2*s) {
+            float *wm = W(m);
+            float *wl = W(m+s);
+            int *im = IW(m);
+            int *il = IW(m+s);
+            int *cm = &count[m];
+            int *cl = &count[m+s];
+
+            #pragma omp task depend(inout:wm[0]) \
+                             depend(in:wl[0]) \
+                             priority(1)
+            {
+                if (sequence->status == PlasmaSuccess) {
+                    plasma_time_t start = plasma_stats_start();
+                    plasma_core_slacpy(PlasmaGeneral, PlasmaNoTrans,
+                                       *cl, nvak,
+                                       wl, ldw,
+                                       &wm[*cm], ldw);
+                    memcpy(&im[*cm], il, *cl*sizeof(int));
+
+                    int mc = *cm+*cl;
+                    *cm = imin(mc, nvak);
+
+                    int retval = plasma_core_sgetrf_tntpiv(mc, nvak,
+                                                           wm, ldw, im);
+                    if (retval != PlasmaSuccess)
+                        plasma_request_fail(sequence, request, retval);
+                    plasma_trace_tiles("wr", (const void*[]){wm, wl});
+                    plasma_stats_stop(PlasmaStatsGetrf, PlasmaRealFloat,
+                                      start, 1.0*mc*nvak*nvak,
+                                      2.0*mc*nvak);
+                }
+            }
+        }
+    }
+
+    // diagonal tile
+    #pragma omp task depend(inout:wk[0]) \
+                     depend(inout:a00[0]) \
+                     depend(out:ipiv[k*A.mb:mvak]) \
+                     priority(1)
+    {
+        if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
+            int info = 0;
+            int retval = plasma_core_sgetrf_tntpiv_diag(
+                mpk, mvak, nvak, ib, *ck, ik,
+                wk, ldw, &ipiv[k*A.mb],
+                a00, ldak, &info);
+
+            if (retval != PlasmaSuccess)
+                plasma_request_fail(sequence, request, retval);
+            else if (info != 0)
+                plasma_request_fail(sequence, request, k*A.mb+info);
+
+            for (int i = 0; i < *ck; i++)
+                ipiv[k*A.mb+i] += k*A.mb;
+            plasma_trace_tiles("www", (const void*[]){wk, a00, ipiv});
+            plasma_stats_stop(PlasmaStatsGetrf, PlasmaRealFloat, start,
+                              1.0*mvak*nvak*nvak-1.0*nvak*nvak*nvak/3.0,
+                              2.0*mvak*nvak);
+        }
+    }
+
+    // tiles below the diagonal
+    for (int m = k+1; m < A.mt; m++) {
+        float *amk = A(m, k);
+        int mvam = plasma_tile_mview(A, m);
+        int ldam = plasma_tile_mmain(A, m);
+
+        #pragma omp task depend(in:wk[0]) \
+                         depend(in:a00[0]) \
+                         depend(inout:amk[0]) \
+                         priority(1)
+        {
+            if (sequence->status == PlasmaSuccess) {
+                plasma_time_t start = plasma_stats_start();
+                plasma_core_sgetrf_tntpiv_apply(mvam, nvak,
+                                                (m-k)*A.mb, *ck, ik,
+                                                wk, ldw,
+                                                amk, ldam);
+                plasma_core_strsm(PlasmaRight, PlasmaUpper,
+                                  PlasmaNoTrans, PlasmaNonUnit,
+                                  mvam, nvak,
+                                  1.0, a00, ldak,
+                                       amk, ldam);
+                plasma_trace_tiles("rrw", (const void*[]){wk, a00, amk});
+                plasma_stats_stop(PlasmaStatsGetrf, PlasmaRealFloat, start,
+                                  1.0*mvam*nvak*nvak,
+                                  1.0*nvak*nvak+2.0*mvam*nvak);
+            }
+        }
+    }
+
+    // Dependency of the whole panel on its individual tiles.
+#ifndef PLASMA_DEPEND_ITERATOR
+    plasma_omp_desc_gather(A, k+1, A.mt-1, k, k+1, a00);
+#endif
+}
+
+/***************************************************************************//**
+ *  Applies the pivoting and the factor of tile column k to tile column n.
+ **/
+static void plasma_psgetrf_calu_update(plasma_desc_t A, int *ipiv,
+                                       int k, int n, int priority,
+                                       plasma_sequence_t *sequence,
+                                       plasma_request_t *request)
+{
+    float *a00, *a20;
+    a00 = A(k, k);
+    a20 = A(A.mt-1, k);
+
+    int ma00k = (A.mt-k-1)*A.mb;
+    int na00k = plasma_tile_nmain(A, k);
+    int lda20 = plasma_tile_mmain(A, A.mt-1);
+
+    int nvak = plasma_tile_nview(A, k);
+    int mvak = plasma_tile_mview(A, k);
+    int ldak = plasma_tile_mmain(A, k);
+
+    float *a01, *a11, *a21;
+    a01 = A(k, n);
+    a11 = A(k+1, n);
+    a21 = A(A.mt-1, n);
+
+    int ma11k = (A.mt-k-2)*A.mb;
+    int na11n = plasma_tile_nmain(A, n);
+    int lda21 = plasma_tile_mmain(A, A.mt-1);
+
+    int nvan = plasma_tile_nview(A, n);
+
+    #pragma omp task depend(in:a00[0:ma00k*na00k]) \
+                     depend(in:a20[0:lda20*nvak]) \
+                     PLASMA_DEPEND_TILES(in, A, k+1, A.mt-1, k, k+1) \
+                     depend(in:ipiv[k*A.mb:mvak]) \
+                     depend(inout:a01[0:ldak*nvan]) \
+                     depend(inout:a11[0:ma11k*na11n]) \
+                     depend(inout:a21[0:lda21*nvan]) \
+                     priority(priority)
+    {
+        if (sequence->status == PlasmaSuccess) {
+            // geswp
+            int k1 = k*A.mb+1;
+            int k2 = imin(k*A.mb+A.mb, A.m);
+            plasma_desc_t view =
+                plasma_desc_view(A, 0, n*A.nb, A.m, nvan);
+            plasma_core_sgeswp(PlasmaRowwise, view, k1, k2, ipiv, 1);
+
+            // trsm
+            plasma_core_strsm(PlasmaLeft, PlasmaLower,
+                       PlasmaNoTrans, PlasmaUnit,
+                       mvak, nvan,
+                       1.0, A(k, k), ldak,
+                            A(k, n), ldak);
+            // gemm
+            for (int m = k+1; m < A.mt; m++) {
+                int mvam = plasma_tile_mview(A, m);
+                int ldam = plasma_tile_mmain(A, m);
+
+                #pragma omp task priority(priority)
+                {
+                    plasma_core_sgemm(
+                        PlasmaNoTrans, PlasmaNoTrans,
+                        mvam, nvan, A.nb,
+                        -1.0, A(m, k), ldam,
+                              A(k, n), ldak,
+                        1.0,  A(m, n), ldam);
+                }
+            }
+        }
+        #pragma omp taskwait
+    }
+}
+
+/***************************************************************************//**
+ *  Parallel tile LU factorization with tournament pivoting (CALU).
+ *  Each tile of the panel selects its candidate pivot rows in a separate task,
+ *  and the candidates are reduced by a binary tree of tasks, each selecting
+ *  pivot rows among those of two subtrees. The rows winning the tournament
+ *  are moved to the diagonal tile, which is factored without pivoting,
+ *  and the tiles below the diagonal are solved in separate tasks.
+ *  Tiles are square, as in all LU factorizations.
+ *  The trailing matrix update and the pivoting to the left are the same
+ *  as in plasma_psgetrf(), including the lookahead.
+ **/
+void plasma_psgetrf_calu(plasma_desc_t A, int *ipiv,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    // Read parameters from the context.
+    plasma_context_t *plasma = plasma_context_self();
+
+    int lookahead = plasma->lookahead;
+
+    int minmtnt = imin(A.mt, A.nt);
+
+    // Candidate rows of each tile row, with their panel indices and count.
+    // Two sets of candidates are stacked in a round of the tournament.
+    int ldw = 2*A.mb;
+    float *work = (float*)malloc(
+        (size_t)A.mt*ldw*A.nb*sizeof(float));
+    int *iwork = (int*)malloc((size_t)A.mt*ldw*sizeof(int));
+    int *count = (int*)malloc(A.mt*sizeof(int));
+    if (work == NULL || iwork == NULL || count == NULL) {
+        free(work);
+        free(iwork);
+        free(count);
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        return;
+    }
+
+    // last panel inserted
+    int last = -1;
+    for (int k = 0; k < minmtnt; k++) {
+        // panels up to k+lookahead, after the updates of their columns
+        while (last < imin(k+lookahead, minmtnt-1)) {
+            last++;
+            for (int j = k; j < last; j++)
+                plasma_psgetrf_calu_update(A, ipiv, j, last, 1,
+                                           sequence, request);
+            plasma_psgetrf_calu_panel(A, ipiv, last, work, iwork, count, ldw,
+                                      sequence, request);
+        }
+
+        // update of the other columns
+        for (int n = last+1; n < A.nt; n++)
+            plasma_psgetrf_calu_update(A, ipiv, k, n, n == k+1,
+                                       sequence, request);
+    }
+
+    // Dependencies of the whole ipiv on the individual chunks
+    // corresponding to tiles.
+#ifndef PLASMA_DEPEND_ITERATOR
+    plasma_omp_chunks_gather(ipiv, minmtnt, sizeof(int)*A.mb);
+#endif
+
+    // pivoting to the left
+    for (int k = 0; k < minmtnt-1; k++) {
+        float *a10, *a20;
+        a10 = A(k+1, k);
+        a20 = A(A.mt-1, k);
+
+        int ma10k = (A.mt-k-2)*A.mb;
+        int na00k = plasma_tile_nmain(A, k);
+        int lda20 = plasma_tile_mmain(A, A.mt-1);
+
+        int nvak = plasma_tile_nview(A, k);
+
+        #pragma omp task depend(in:ipiv[0:imin(A.m,A.n)]) \
+                         PLASMA_DEPEND_CHUNKS(in, ipiv, 1, minmtnt, A.mb) \
+                         depend(inout:a10[0:ma10k*na00k]) \
+                         PLASMA_DEPEND_TILES(inout, A, k+2, A.mt-1, k, k+1) \
+                         depend(inout:a20[0:lda20*nvak])
+        {
+            if (sequence->status == PlasmaSuccess) {
+                plasma_desc_t view =
+                    plasma_desc_view(A, 0, k*A.nb, A.m, A.nb);
+                int k1 = (k+1)*A.mb+1;
+                int k2 = imin(A.m, A.n);
+                plasma_core_sgeswp(PlasmaRowwise, view, k1, k2, ipiv, 1);
+            }
+        }
+
+        // Dependencies of individual tiles on the whole panel.
+#ifndef PLASMA_DEPEND_ITERATOR
+        plasma_omp_desc_scatter(A, k+2, A.mt-1, k, k+1, a10);
+#endif
+    }
+
+    // Release the candidates once every task using them has completed.
+#ifndef PLASMA_DEPEND_ITERATOR
+    for (int m = 1; m < A.mt; m++) {
+        float *wm = W(m);
+        #pragma omp task depend (inout:wm[0]) \
+                         depend (inout:work[0])
+        {
+            int l = 1;
+            l++;
+        }
+    }
+#endif
+    #pragma omp task depend (inout:work[0]) \
+                     PLASMA_DEPEND_CHUNKS(inout, work, 1, A.mt, ldw*A.nb)
+    {
+        free(work);
+        free(iwork);
+        free(count);
+    }
+}
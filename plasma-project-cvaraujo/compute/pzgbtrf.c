@@ -72,6 +72,7 @@ void plasma_pzgbtrf(plasma_desc_t A, int *ipiv,
             plasma_barrier_t barrier;
             plasma_barrier_init(&barrier);
 
+            plasma_time_t start = plasma_stats_start();
             if (sequence->status == PlasmaSuccess) {
                 for (int rank = 0; rank < num_panel_threads; rank++) {
                     #pragma omp task shared(barrier) priority(1)
@@ -92,6 +93,10 @@ void plasma_pzgbtrf(plasma_desc_t A, int *ipiv,
                 }
             }
             #pragma omp taskwait
+            plasma_trace_tiles("ww", (const void*[]){a00, ipivk});
+            plasma_stats_stop(PlasmaStatsGetrf, PlasmaComplexDouble, start,
+                              1.0*mak*nvak*nvak-1.0*nvak*nvak*nvak/3.0,
+                              2.0*mak*nvak);
 
             free((void*)max_idx);
             free((void*)max_val);
@@ -50,7 +50,8 @@ void plasma_pzlag2c(plasma_desc_t A, plasma_desc_t As,
     // Return if failed sequence.
     if (sequence->status != PlasmaSuccess)
         return;
-    if (A.type == PlasmaGeneral && As.type == PlasmaGeneral) {
+    if ((A.type  == PlasmaGeneral || A.type  == PlasmaGeneralStrided) &&
+        (As.type == PlasmaGeneral || As.type == PlasmaGeneralStrided)) {
         for (int m = 0; m < A.mt; m++) {
             int am  = plasma_tile_mview(A,  m);
             int lda = plasma_tile_mmain(A,  m);
@@ -0,0 +1,80 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> s d c
+ *
+ **/
+
+#include "plasma_async.h"
+#include "plasma_context.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+#include <plasma_core_blas.h>
+
+#define A(m, n) (plasma_complex64_t*)plasma_tile_addr(A, m, n)
+#define V(m, n) (plasma_complex64_t*)plasma_tile_addr(V, m, n)
+
+/***************************************************************************//**
+ *  Parallel tile rank-k update or downdate of a Cholesky factorization.
+ *  Each tile column of V is swept down the tile columns (rows) of the
+ *  factor, one diagonal tile after the other, the rotations of each
+ *  diagonal tile being applied to the tiles below (right of) it in parallel.
+ *  The sweeps of consecutive tile columns of V are pipelined.
+ * @see plasma_omp_zpotrf_update
+ * @see plasma_omp_zpotrf_downdate
+ ******************************************************************************/
+void plasma_pzpotrf_update(plasma_enum_t uplo, double sigma,
+                           plasma_desc_t A, plasma_desc_t V,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request)
+{
+    // Return if failed sequence.
+    if (sequence->status != PlasmaSuccess)
+        return;
+
+    for (int q = 0; q < V.nt; q++) {
+        int nvvq = plasma_tile_nview(V, q);
+        for (int j = 0; j < A.mt; j++) {
+            int mvaj = plasma_tile_mview(A, j);
+            int ldaj = plasma_tile_mmain(A, j);
+            int ldvj = plasma_tile_mmain(V, j);
+            plasma_core_omp_zpotrf_update(
+                uplo, sigma,
+                mvaj, nvvq,
+                A(j, j), ldaj,
+                V(j, q), ldvj,
+                A.nb*j,
+                sequence, request);
+
+            for (int i = j+1; i < A.mt; i++) {
+                int mvai = plasma_tile_mview(A, i);
+                int ldai = plasma_tile_mmain(A, i);
+                int ldvi = plasma_tile_mmain(V, i);
+                if (uplo == PlasmaLower) {
+                    plasma_core_omp_zpotrf_update_apply(
+                        uplo, sigma,
+                        mvai, mvaj, nvvq,
+                        A(i, j), ldai,
+                        V(j, q), ldvj,
+                        V(i, q), ldvi,
+                        sequence, request);
+                }
+                else {
+                    plasma_core_omp_zpotrf_update_apply(
+                        uplo, sigma,
+                        mvai, mvaj, nvvq,
+                        A(j, i), ldaj,
+                        V(j, q), ldvj,
+                        V(i, q), ldvi,
+                        sequence, request);
+                }
+            }
+        }
+    }
+}
@@ -14,6 +14,7 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_tile_cache.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 #include <plasma_core_blas.h>
@@ -35,6 +36,10 @@ void plasma_pztrsm(plasma_enum_t side, plasma_enum_t uplo,
     if (sequence->status != PlasmaSuccess)
         return;
 
+    // Run the offloaded tasks on the devices owning the tiles of B,
+    // and keep the offloaded tiles on the devices until the end.
+    plasma_tile_cache_begin(&B, 1, 1);
+
     if (side == PlasmaLeft) {
         if (uplo == PlasmaUpper) {
             //===========================================
@@ -308,4 +313,5 @@ void plasma_pztrsm(plasma_enum_t side, plasma_enum_t uplo,
             }
         }
     }
+    plasma_tile_cache_end();
 }
@@ -14,6 +14,7 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_nested.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 #include <plasma_core_blas.h>
@@ -22,6 +23,8 @@
 
 /***************************************************************************//**
  * Parallel tile triangular inversion.
+ * The diagonal tiles are split into nested tasks when the gemms of the same
+ * step leave threads idle.
  * @see plasma_omp_ztrtri
  ******************************************************************************/
 void plasma_pztrtri(plasma_enum_t uplo, plasma_enum_t diag,
@@ -32,6 +35,8 @@ void plasma_pztrtri(plasma_enum_t uplo, plasma_enum_t diag,
     if (sequence->status != PlasmaSuccess)
         return;
 
+    plasma_context_t *plasma = plasma_context_self();
+
     //==============
     // PlasmaLower
     //==============
@@ -73,10 +78,12 @@ void plasma_pztrtri(plasma_enum_t uplo, plasma_enum_t diag,
                          A(k, n), ldak,
                     sequence, request);
             }
-            plasma_core_omp_ztrtri(
+            plasma_core_omp_znested_trtri(
                 uplo, diag,
                 nvak,
                 A(k, k), ldak,
+                plasma->ib,
+                plasma_nested_tasks(plasma, A.nb, (A.mt-k-1)*k, 1),
                 A.nb*k,
                 sequence, request);
         }
@@ -118,10 +125,12 @@ void plasma_pztrtri(plasma_enum_t uplo, plasma_enum_t diag,
                          A(m, k), ldam,
                     sequence, request);
             }
-            plasma_core_omp_ztrtri(
+            plasma_core_omp_znested_trtri(
                 uplo, diag,
                 mvak,
                 A(k, k), ldak,
+                plasma->ib,
+                plasma_nested_tasks(plasma, A.nb, k*(A.nt-k-1), 1),
                 A.nb*k,
                 sequence, request);
         }
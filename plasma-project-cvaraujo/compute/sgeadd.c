@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/compute/zgeadd.c, normal z -> s, Fri Sep 28 17:38:05 2018
+ * @generated from compute/zgeadd.c, normal z -> s, Sat Oct 17 01:56:43 2026
  *
  **/
 
@@ -156,20 +156,20 @@ int plasma_sgeadd(plasma_enum_t transa,
     int nb = plasma->nb;
 
     // Create tile matrices.
+    // The tiles are views of the LAPACK arrays, so no translation is needed.
     plasma_desc_t A;
     plasma_desc_t B;
     int retval;
-    retval = plasma_desc_general_create(PlasmaRealFloat, nb, nb,
-                                        am, an, 0, 0, am, an, &A);
+    retval = plasma_desc_general_strided_init(PlasmaRealFloat, pA, lda,
+                                              nb, nb, am, an, &A);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_strided_init() failed");
         return retval;
     }
-    retval = plasma_desc_general_create(PlasmaRealFloat, nb, nb,
-                                        bm, bn, 0, 0, bm, bn, &B);
+    retval = plasma_desc_general_strided_init(PlasmaRealFloat, pB, ldb,
+                                              nb, nb, bm, bn, &B);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
-        plasma_desc_destroy(&A);
+        plasma_error("plasma_desc_general_strided_init() failed");
         return retval;
     }
 
@@ -185,26 +185,14 @@ int plasma_sgeadd(plasma_enum_t transa,
     #pragma omp parallel
     #pragma omp master
     {
-        // Translate to tile layout.
-        plasma_omp_sge2desc(pA, lda, A, &sequence, &request);
-        plasma_omp_sge2desc(pB, ldb, B, &sequence, &request);
-
         // Call tile async function.
         plasma_omp_sgeadd(transa,
                           alpha,     A,
                           beta,      B,
                           &sequence, &request);
-
-        // Translate back to LAPACK layout.
-        plasma_omp_sdesc2ge(A, pA, lda, &sequence, &request);
-        plasma_omp_sdesc2ge(B, pB, ldb, &sequence, &request);
     }
     // implicit synchronization
 
-    // Free matrices in tile layout.
-    plasma_desc_destroy(&A);
-    plasma_desc_destroy(&B);
-
     // Return status.
     int status = sequence.status;
     return status;
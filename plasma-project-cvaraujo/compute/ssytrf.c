@@ -6,13 +6,14 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/compute/zhetrf.c, normal z -> s, Fri Sep 28 17:38:07 2018
+ * @generated from compute/zhetrf.c, normal z -> s, Sat Oct 17 02:05:06 2026
  *
  **/
 
 #include "plasma.h"
 #include "plasma_async.h"
 #include "plasma_context.h"
+#include "plasma_depend.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
 #include "plasma_tuning.h"
@@ -176,35 +177,63 @@ int plasma_ssytrf(plasma_enum_t uplo,
 
     // Initialize data.
     memset(T.matrix, 0, ldt*n*sizeof(float));
-    memset(W.matrix, 0, ldw*nb*sizeof(float));
+    for (int m = 0; m < W.mt; m++) {
+        memset(plasma_tile_addr(W, m, 0), 0,
+               (size_t)nb*nb*sizeof(float));
+    }
     for (int i = 0; i < nb; i++) ipiv[i] = 1+i;
 
-    // asynchronous block
-    #pragma omp parallel
-    #pragma omp master
-    {
-        // Translate to tile layout.
-        plasma_omp_str2desc(pA, lda, A, &sequence, &request);
-    }
-    // implicit synchronization
+    if (plasma->fused_driver == PlasmaEnabled) {
+        // Translate, compute and translate back in one task graph,
+        // so that tiles are factored as soon as they are translated.
+        #pragma omp parallel
+        #pragma omp master
+        {
+            // Translate to tile layout.
+            // Symmetric swaps in hetrf touch the whole trailing matrix,
+            // so A is fenced as a whole rather than by columns.
+            plasma_omp_str2desc(pA, lda, A, &sequence, &request);
+            plasma_omp_desc_fence(A);
 
-    #pragma omp parallel
-    #pragma omp master
-    {
-        // Call the tile async function to compute LTL^T factor of A,
-        // where T is a band matrix
-        plasma_omp_ssytrf(uplo, A, ipiv, T, ipiv2, W, &sequence, &request);
+            // Call the tile async function to compute LTL^T factor of A,
+            // where T is a band matrix
+            plasma_omp_ssytrf(uplo, A, ipiv, T, ipiv2, W, &sequence, &request);
+
+            // Translate back to LAPACK layout.
+            plasma_omp_desc_fence(A);
+            plasma_omp_desc_fence_columns(T);
+            plasma_omp_sdesc2tr(A, pA, lda, &sequence, &request);
+            plasma_omp_sdesc2pb(T, pT, ldt, &sequence, &request);
+        }
+        // implicit synchronization
     }
-    // implicit synchronization
+    else {
+        #pragma omp parallel
+        #pragma omp master
+        {
+            // Translate to tile layout.
+            plasma_omp_str2desc(pA, lda, A, &sequence, &request);
+        }
+        // implicit synchronization
+
+        #pragma omp parallel
+        #pragma omp master
+        {
+            // Call the tile async function to compute LTL^T factor of A,
+            // where T is a band matrix
+            plasma_omp_ssytrf(uplo, A, ipiv, T, ipiv2, W, &sequence, &request);
+        }
+        // implicit synchronization
 
-    #pragma omp parallel
-    #pragma omp master
-    {
-        // Translate back to LAPACK layout.
-        plasma_omp_sdesc2tr(A, pA, lda, &sequence, &request);
-        plasma_omp_sdesc2pb(T, pT, ldt, &sequence, &request);
+        #pragma omp parallel
+        #pragma omp master
+        {
+            // Translate back to LAPACK layout.
+            plasma_omp_sdesc2tr(A, pA, lda, &sequence, &request);
+            plasma_omp_sdesc2pb(T, pT, ldt, &sequence, &request);
+        }
+        // implicit synchronization
     }
-    // implicit synchronization
 
     // Free matrices in tile layout.
     plasma_desc_destroy(&A);
@@ -13,6 +13,7 @@
 #include "plasma.h"
 #include "plasma_async.h"
 #include "plasma_context.h"
+#include "plasma_depend.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
 #include "plasma_tuning.h"
@@ -119,25 +120,47 @@ int plasma_zgbtrf(int m, int n, int kl, int ku,
     plasma_request_t request;
     retval = plasma_request_init(&request);
 
-    #pragma omp parallel
-    #pragma omp master
-    {
-        // Translate to tile layout.
-        plasma_omp_zpb2desc(pAB, ldab, AB, &sequence, &request);
+    if (plasma->fused_driver == PlasmaEnabled) {
+        // Translate, compute and translate back in one task graph,
+        // so that tiles are factored as soon as they are translated.
+        #pragma omp parallel
+        #pragma omp master
+        {
+            // Translate to tile layout.
+            plasma_omp_zpb2desc(pAB, ldab, AB, &sequence, &request);
+            plasma_omp_desc_fence_columns(AB);
+
+            // Call the tile async function.
+            plasma_omp_zgbtrf(AB, ipiv, &sequence, &request);
+
+            // Translate back to LAPACK layout.
+            plasma_omp_desc_fence_columns(AB);
+            plasma_omp_zdesc2pb(AB, pAB, ldab, &sequence, &request);
+        }
+        // implicit synchronization
     }
-
-    #pragma omp parallel
-    #pragma omp master
-    {
-        // Call the tile async function.
-        plasma_omp_zgbtrf(AB, ipiv, &sequence, &request);
-    }
-
-    #pragma omp parallel
-    #pragma omp master
-    {
-        // Translate back to LAPACK layout.
-        plasma_omp_zdesc2pb(AB, pAB, ldab, &sequence, &request);
+    else {
+        #pragma omp parallel
+        #pragma omp master
+        {
+            // Translate to tile layout.
+            plasma_omp_zpb2desc(pAB, ldab, AB, &sequence, &request);
+        }
+
+        #pragma omp parallel
+        #pragma omp master
+        {
+            // Call the tile async function.
+            plasma_omp_zgbtrf(AB, ipiv, &sequence, &request);
+        }
+
+        #pragma omp parallel
+        #pragma omp master
+        {
+            // Translate back to LAPACK layout.
+            plasma_omp_zdesc2pb(AB, pAB, ldab, &sequence, &request);
+        }
+        // implicit synchronization
     }
 
     // Free matrix A in tile layout.
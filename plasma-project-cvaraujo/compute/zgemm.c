@@ -19,6 +19,8 @@
 #include "plasma_types.h"
 #include "plasma_workspace.h"
 
+#include <string.h>
+
 /***************************************************************************//**
  *
  * @ingroup plasma_gemm
@@ -189,26 +191,46 @@ int plasma_zgemm(plasma_enum_t transa, plasma_enum_t transb,
     plasma_desc_t B;
     plasma_desc_t C;
     int retval;
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        am, an, 0, 0, am, an, &A);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
-        return retval;
-    }
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        bm, bn, 0, 0, bm, bn, &B);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
-        plasma_desc_destroy(&A);
-        return retval;
+    // In-place mode uses views of the LAPACK arrays instead of tile copies.
+    int strided = plasma->inplace_outplace == PlasmaInplace;
+    if (strided) {
+        retval = plasma_desc_general_strided_init(PlasmaComplexDouble, pA, lda,
+                                                  nb, nb, am, an, &A);
+        if (retval == PlasmaSuccess)
+            retval = plasma_desc_general_strided_init(PlasmaComplexDouble,
+                                                      pB, ldb,
+                                                      nb, nb, bm, bn, &B);
+        if (retval == PlasmaSuccess)
+            retval = plasma_desc_general_strided_init(PlasmaComplexDouble,
+                                                      pC, ldc,
+                                                      nb, nb, m, n, &C);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_desc_general_strided_init() failed");
+            return retval;
+        }
     }
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        m, n, 0, 0, m, n, &C);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
-        plasma_desc_destroy(&A);
-        plasma_desc_destroy(&B);
-        return retval;
+    else {
+        retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                            am, an, 0, 0, am, an, &A);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_desc_general_create() failed");
+            return retval;
+        }
+        retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                            bm, bn, 0, 0, bm, bn, &B);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_desc_general_create() failed");
+            plasma_desc_destroy(&A);
+            return retval;
+        }
+        retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                            m, n, 0, 0, m, n, &C);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_desc_general_create() failed");
+            plasma_desc_destroy(&A);
+            plasma_desc_destroy(&B);
+            return retval;
+        }
     }
 
     // Initialize sequence.
@@ -219,31 +241,84 @@ int plasma_zgemm(plasma_enum_t transa, plasma_enum_t transb,
     plasma_request_t request;
     retval = plasma_request_init(&request);
 
+    // Key of the task graph of the call: its shape and parameters,
+    // and the settings of the context that change the tasks submitted.
+    struct {
+        plasma_enum_t transa, transb;
+        int m, n, k, lda, ldb, ldc, nb, strided;
+        int ib, lookahead, nested_tasks, batch;
+        plasma_complex64_t alpha, beta;
+    } key;
+    memset(&key, 0, sizeof(key));
+    key.transa = transa;
+    key.transb = transb;
+    key.m = m;
+    key.n = n;
+    key.k = k;
+    key.lda = lda;
+    key.ldb = ldb;
+    key.ldc = ldc;
+    key.nb = nb;
+    key.ib = plasma->ib;
+    key.lookahead = plasma->lookahead;
+    key.nested_tasks = plasma->nested_tasks;
+    key.batch = plasma->batch;
+    key.strided = strided;
+    key.alpha = alpha;
+    key.beta = beta;
+    plasma_desc_t desc[] = {A, B, C};
+
     // asynchronous block
     #pragma omp parallel
     #pragma omp master
     {
         // Translate to tile layout.
-        plasma_omp_zge2desc(pA, lda, A, &sequence, &request);
-        plasma_omp_zge2desc(pB, ldb, B, &sequence, &request);
-        plasma_omp_zge2desc(pC, ldc, C, &sequence, &request);
+        if (!strided) {
+            plasma_omp_zge2desc(pA, lda, A, &sequence, &request);
+            plasma_omp_zge2desc(pB, ldb, B, &sequence, &request);
+            plasma_omp_zge2desc(pC, ldc, C, &sequence, &request);
+        }
+
+        // Replay the task graph recorded by a previous call of the same
+        // shape, or record it now.
+        plasma_graph_t *graph = NULL;
+        if (plasma->graph_cache == PlasmaEnabled) {
+            graph = plasma_graph_find(plasma->graphs, "zgemm",
+                                      &key, sizeof(key));
+            if (graph == NULL) {
+                plasma_graph_capture_begin(desc, 3);
+                plasma_omp_zgemm(transa, transb,
+                                 alpha, A,
+                                        B,
+                                 beta,  C,
+                                 &sequence, &request);
+                graph = plasma_graph_capture_end(&plasma->graphs, "zgemm",
+                                                 &key, sizeof(key));
+            }
+        }
 
         // Call the tile async function.
-        plasma_omp_zgemm(transa, transb,
-                         alpha, A,
-                                B,
-                         beta,  C,
-                         &sequence, &request);
+        if (graph != NULL)
+            plasma_graph_replay(graph, desc, &sequence, &request);
+        else
+            plasma_omp_zgemm(transa, transb,
+                             alpha, A,
+                                    B,
+                             beta,  C,
+                             &sequence, &request);
 
         // Translate back to LAPACK layout.
-        plasma_omp_zdesc2ge(C, pC, ldc, &sequence, &request);
+        if (!strided)
+            plasma_omp_zdesc2ge(C, pC, ldc, &sequence, &request);
     }
     // implicit synchronization
 
     // Free matrices in tile layout.
-    plasma_desc_destroy(&A);
-    plasma_desc_destroy(&B);
-    plasma_desc_destroy(&C);
+    if (!strided) {
+        plasma_desc_destroy(&A);
+        plasma_desc_destroy(&B);
+        plasma_desc_destroy(&C);
+    }
 
     // Return status.
     int status = sequence.status;
@@ -111,11 +111,16 @@ int plasma_zgeqrf(int m, int n,
     // Create tile matrix.
     plasma_desc_t A;
     int retval;
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        m, n, 0, 0, m, n, &A);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
-        return retval;
+    int inplace = plasma->inplace_outplace == PlasmaInplace &&
+        plasma_desc_general_inplace_init(PlasmaComplexDouble, pA, lda,
+                                         nb, nb, m, n, &A) == PlasmaSuccess;
+    if (!inplace) {
+        retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
+                                            m, n, 0, 0, m, n, &A);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_desc_general_create() failed");
+            return retval;
+        }
     }
 
     // Prepare descriptor T.
@@ -147,20 +152,27 @@ int plasma_zgeqrf(int m, int n,
     #pragma omp master
     {
         // Translate to tile layout.
-        plasma_omp_zge2desc(pA, lda, A, &sequence, &request);
+        if (inplace)
+            plasma_omp_zge2desc_inplace(A, &sequence, &request);
+        else
+            plasma_omp_zge2desc(pA, lda, A, &sequence, &request);
 
         // Call the tile async function.
         plasma_omp_zgeqrf(A, *T, work, &sequence, &request);
 
         // Translate back to LAPACK layout.
-        plasma_omp_zdesc2ge(A, pA, lda, &sequence, &request);
+        if (inplace)
+            plasma_omp_zdesc2ge_inplace(A, &sequence, &request);
+        else
+            plasma_omp_zdesc2ge(A, pA, lda, &sequence, &request);
     }
     // implicit synchronization
 
     plasma_workspace_destroy(&work);
 
     // Free matrix A in tile layout.
-    plasma_desc_destroy(&A);
+    if (!inplace)
+        plasma_desc_destroy(&A);
 
     // Return status.
     int status = sequence.status;
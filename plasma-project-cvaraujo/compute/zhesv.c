@@ -13,6 +13,7 @@
 #include "plasma.h"
 #include "plasma_async.h"
 #include "plasma_context.h"
+#include "plasma_depend.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
 #include "plasma_tuning.h"
@@ -154,11 +155,16 @@ int plasma_zhesv(plasma_enum_t uplo, int n, int nrhs,
                                // this could fill the last tile of the panel,
                                // and we need extra NB space on the bottom
     int retval;
-    retval = plasma_desc_triangular_create(PlasmaComplexDouble, uplo, nb, nb,
-                                           n, n, 0, 0, n, n, &A);
-    if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
-        return retval;
+    int inplace = plasma->inplace_outplace == PlasmaInplace &&
+        plasma_desc_general_inplace_init(PlasmaComplexDouble, pA, lda,
+                                         nb, nb, n, n, &A) == PlasmaSuccess;
+    if (!inplace) {
+        retval = plasma_desc_triangular_create(PlasmaComplexDouble, uplo,
+                                               nb, nb, n, n, 0, 0, n, n, &A);
+        if (retval != PlasmaSuccess) {
+            plasma_error("plasma_desc_general_create() failed");
+            return retval;
+        }
     }
     retval = plasma_desc_general_band_create(PlasmaComplexDouble, PlasmaGeneral,
                                              nb, nb, lm, n, 0, 0, n, n, nb, nb,
@@ -171,7 +177,8 @@ int plasma_zhesv(plasma_enum_t uplo, int n, int nrhs,
                                         n, nrhs, 0, 0, n, nrhs, &B);
     if (retval != PlasmaSuccess) {
         plasma_error("plasma_desc_general_create() failed");
-        plasma_desc_destroy(&A);
+        if (!inplace)
+            plasma_desc_destroy(&A);
         return retval;
     }
 
@@ -196,38 +203,84 @@ int plasma_zhesv(plasma_enum_t uplo, int n, int nrhs,
 
     // Initialize data.
     memset(T.matrix, 0, ldt*n*sizeof(plasma_complex64_t));
-    memset(W.matrix, 0, ldw*nb*sizeof(plasma_complex64_t));
+    for (int m = 0; m < W.mt; m++) {
+        memset(plasma_tile_addr(W, m, 0), 0,
+               (size_t)nb*nb*sizeof(plasma_complex64_t));
+    }
     for (int i = 0; i < nb; i++) ipiv[i] = 1+i;
 
-    // asynchronous block
-    #pragma omp parallel
-    #pragma omp master
-    {
-        // Translate to tile layout.
-        plasma_omp_ztr2desc(pA, lda, A, &sequence, &request);
-        plasma_omp_zpb2desc(pT, ldt, T, &sequence, &request);
-        plasma_omp_zge2desc(pB, ldb, B, &sequence, &request);
-    }
-    // implicit synchronization
+    if (plasma->fused_driver == PlasmaEnabled) {
+        // Translate, compute and translate back in one task graph,
+        // so that tiles are factored as soon as they are translated.
+        #pragma omp parallel
+        #pragma omp master
+        {
+            // Translate to tile layout.
+            // Symmetric swaps in hetrf touch the whole trailing matrix,
+            // so A is fenced as a whole rather than by columns.
+            if (inplace)
+                plasma_omp_zge2desc_inplace(A, &sequence, &request);
+            else
+                plasma_omp_ztr2desc(pA, lda, A, &sequence, &request);
+            plasma_omp_zpb2desc(pT, ldt, T, &sequence, &request);
+            plasma_omp_zge2desc(pB, ldb, B, &sequence, &request);
+            plasma_omp_desc_fence(A);
+            plasma_omp_desc_fence_columns(T);
+            plasma_omp_desc_fence_columns(B);
+
+            // Call the tile async function.
+            plasma_omp_zhesv(uplo, A, ipiv, T, ipiv2, B, W, &sequence, &request);
 
-    #pragma omp parallel
-    #pragma omp master
-    {
-        // Call the tile async function.
-        plasma_omp_zhesv(uplo, A, ipiv, T, ipiv2, B, W, &sequence, &request);
+            // Translate back to LAPACK layout.
+            // In-place A holds the factors in tile layout and is translated
+            // back as well.
+            if (inplace) {
+                plasma_omp_desc_fence(A);
+                plasma_omp_zdesc2ge_inplace(A, &sequence, &request);
+            }
+            plasma_omp_desc_fence_columns(B);
+            plasma_omp_zdesc2ge(B, pB, ldb, &sequence, &request);
+        }
+        // implicit synchronization
     }
-    // implicit synchronization
+    else {
+        #pragma omp parallel
+        #pragma omp master
+        {
+            // Translate to tile layout.
+            if (inplace)
+                plasma_omp_zge2desc_inplace(A, &sequence, &request);
+            else
+                plasma_omp_ztr2desc(pA, lda, A, &sequence, &request);
+            plasma_omp_zpb2desc(pT, ldt, T, &sequence, &request);
+            plasma_omp_zge2desc(pB, ldb, B, &sequence, &request);
+        }
+        // implicit synchronization
 
-    #pragma omp parallel
-    #pragma omp master
-    {
-        // Translate back to LAPACK layout.
-        plasma_omp_zdesc2ge(B, pB, ldb, &sequence, &request);
+        #pragma omp parallel
+        #pragma omp master
+        {
+            // Call the tile async function.
+            plasma_omp_zhesv(uplo, A, ipiv, T, ipiv2, B, W, &sequence, &request);
+        }
+        // implicit synchronization
+
+        #pragma omp parallel
+        #pragma omp master
+        {
+            // Translate back to LAPACK layout.
+            // In-place A holds the factors in tile layout and is translated
+            // back as well.
+            if (inplace)
+                plasma_omp_zdesc2ge_inplace(A, &sequence, &request);
+            plasma_omp_zdesc2ge(B, pB, ldb, &sequence, &request);
+        }
+        // implicit synchronization
     }
-    // implicit synchronization
 
     // Free matrix A in tile layout.
-    plasma_desc_destroy(&A);
+    if (!inplace)
+        plasma_desc_destroy(&A);
     plasma_desc_destroy(&T);
     plasma_desc_destroy(&B);
     plasma_desc_destroy(&W);
@@ -13,6 +13,7 @@
 #include "plasma.h"
 #include "plasma_async.h"
 #include "plasma_context.h"
+#include "plasma_depend.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
 #include "plasma_tuning.h"
@@ -170,30 +171,54 @@ int plasma_zhetrs(plasma_enum_t uplo, int n, int nrhs,
     plasma_request_t request;
     retval = plasma_request_init(&request);
 
-    // asynchronous block
-    #pragma omp parallel
-    #pragma omp master
-    {
-        // Translate to tile layout.
-        plasma_omp_ztr2desc(pA, lda, A, &sequence, &request);
-        plasma_omp_zpb2desc(pT, ldt, T, &sequence, &request);
-        plasma_omp_zge2desc(pB, ldb, B, &sequence, &request);
-    }
+    if (plasma->fused_driver == PlasmaEnabled) {
+        // Translate, compute and translate back in one task graph,
+        // so that tiles are factored as soon as they are translated.
+        #pragma omp parallel
+        #pragma omp master
+        {
+            // Translate to tile layout.
+            plasma_omp_ztr2desc(pA, lda, A, &sequence, &request);
+            plasma_omp_zpb2desc(pT, ldt, T, &sequence, &request);
+            plasma_omp_zge2desc(pB, ldb, B, &sequence, &request);
+            plasma_omp_desc_fence_columns(A);
+            plasma_omp_desc_fence_columns(T);
+            plasma_omp_desc_fence_columns(B);
+
+            // Call the tile async function.
+            plasma_omp_zhetrs(uplo, A, ipiv, T, ipiv2, B, &sequence, &request);
 
-    #pragma omp parallel
-    #pragma omp master
-    {
-        // Call the tile async function.
-        plasma_omp_zhetrs(uplo, A, ipiv, T, ipiv2, B, &sequence, &request);
+            // Translate back to LAPACK layout.
+            plasma_omp_desc_fence_columns(B);
+            plasma_omp_zdesc2ge(B, pB, ldb, &sequence, &request);
+        }
+        // implicit synchronization
     }
+    else {
+        #pragma omp parallel
+        #pragma omp master
+        {
+            // Translate to tile layout.
+            plasma_omp_ztr2desc(pA, lda, A, &sequence, &request);
+            plasma_omp_zpb2desc(pT, ldt, T, &sequence, &request);
+            plasma_omp_zge2desc(pB, ldb, B, &sequence, &request);
+        }
+
+        #pragma omp parallel
+        #pragma omp master
+        {
+            // Call the tile async function.
+            plasma_omp_zhetrs(uplo, A, ipiv, T, ipiv2, B, &sequence, &request);
+        }
 
-    #pragma omp parallel
-    #pragma omp master
-    {
-        // Translate back to LAPACK layout.
-        plasma_omp_zdesc2ge(B, pB, ldb, &sequence, &request);
+        #pragma omp parallel
+        #pragma omp master
+        {
+            // Translate back to LAPACK layout.
+            plasma_omp_zdesc2ge(B, pB, ldb, &sequence, &request);
+        }
+        // implicit synchronization
     }
-    // implicit synchronization
 
     // Free matrix A in tile layout.
     plasma_desc_destroy(&A);
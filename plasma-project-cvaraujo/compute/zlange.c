@@ -116,12 +116,13 @@ double plasma_zlange(plasma_enum_t norm,
     int nb = plasma->nb;
 
     // Create tile matrices.
+    // The tiles are views of the LAPACK array, so no translation is needed.
     plasma_desc_t A;
     int retval;
-    retval = plasma_desc_general_create(PlasmaComplexDouble, nb, nb,
-                                        m, n, 0, 0, m, n, &A);
+    retval = plasma_desc_general_strided_init(PlasmaComplexDouble, pA, lda,
+                                              nb, nb, m, n, &A);
     if (retval != PlasmaSuccess) {
-        plasma_error("plasma_desc_general_create() failed");
+        plasma_error("plasma_desc_general_strided_init() failed");
         return retval;
     }
 
@@ -160,9 +161,6 @@ double plasma_zlange(plasma_enum_t norm,
     #pragma omp parallel
     #pragma omp master
     {
-        // Translate to tile layout.
-        plasma_omp_zge2desc(pA, lda, A, &sequence, &request);
-
         // Call tile async function.
         plasma_omp_zlange(norm, A, work, &value, &sequence, &request);
     }
@@ -170,9 +168,6 @@ double plasma_zlange(plasma_enum_t norm,
 
     free(work);
 
-    // Free matrix in tile layout.
-    plasma_desc_destroy(&A);
-
     // Return the norm.
     return value;
 }
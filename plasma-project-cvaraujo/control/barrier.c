@@ -8,23 +8,101 @@
  *
  **/
 
+// syscall() is not in C99.
+#define _GNU_SOURCE
+
 #include "plasma_barrier.h"
 
+#include <limits.h>
+#include <sched.h>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/******************************************************************************/
+static inline void plasma_barrier_pause()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#elif defined(__powerpc__) || defined(__powerpc64__)
+    __asm__ __volatile__("or 27,27,27");
+#endif
+}
+
+/***************************************************************************//**
+ *
+ *  Sleeps while the sense of the barrier equals sense.
+ *
+ */
+static void plasma_barrier_sleep(plasma_barrier_t *barrier, int sense)
+{
+#ifdef __linux__
+    syscall(SYS_futex, &barrier->sense, FUTEX_WAIT_PRIVATE, sense,
+            NULL, NULL, 0);
+#else
+    if (barrier->sense == sense)
+        sched_yield();
+#endif
+}
+
+/******************************************************************************/
+static void plasma_barrier_wake(plasma_barrier_t *barrier)
+{
+#ifdef __linux__
+    syscall(SYS_futex, &barrier->sense, FUTEX_WAKE_PRIVATE, INT_MAX,
+            NULL, NULL, 0);
+#endif
+}
+
 /******************************************************************************/
 void plasma_barrier_init(plasma_barrier_t *barrier)
 {
     barrier->count = 0;
-    barrier->passed = 0;
+    barrier->sense = 0;
+    barrier->sleepers = 0;
 }
 
-/******************************************************************************/
+/***************************************************************************//**
+ *
+ *  Waits for size threads to arrive at the barrier.
+ *  The last thread to arrive resets the count and flips the sense,
+ *  which releases the others. Waiting threads spin with exponentially
+ *  growing pauses for a bounded time, so that they do not steal cycles
+ *  from the threads still working when there are fewer cores than
+ *  threads, and then sleep on a futex until the sense flips.
+ *
+ */
 void plasma_barrier_wait(plasma_barrier_t *barrier, int size)
 {
-    int passed_old = barrier->passed;
+    int sense = barrier->sense;
+
+    if (__sync_add_and_fetch(&barrier->count, 1) == size) {
+        barrier->count = 0;
+        __sync_fetch_and_xor(&barrier->sense, 1);
+        // Full barrier above: either a sleeper is seen here,
+        // or it sees the new sense before sleeping.
+        if (barrier->sleepers > 0)
+            plasma_barrier_wake(barrier);
+        return;
+    }
+
+    int pause = 1;
+    for (int round = 0; round < PLASMA_BARRIER_SPIN_ROUNDS; round++) {
+        if (barrier->sense != sense)
+            return;
+        for (int i = 0; i < pause; i++)
+            plasma_barrier_pause();
+        if (pause < PLASMA_BARRIER_MAX_PAUSE)
+            pause *= 2;
+    }
 
-    __sync_fetch_and_add(&barrier->count, 1);
-    if (__sync_bool_compare_and_swap(&barrier->count, size, 0))
-        barrier->passed++;
-    else
-        while (barrier->passed == passed_old);
+    __sync_fetch_and_add(&barrier->sleepers, 1);
+    while (barrier->sense == sense)
+        plasma_barrier_sleep(barrier, sense);
+    __sync_fetch_and_sub(&barrier->sleepers, 1);
 }
@@ -9,17 +9,32 @@
  **/
 
 #include "plasma_context.h"
+#include "plasma_core_simd.h"
 #include "plasma_internal.h"
+#include "plasma_trace.h"
 #include "plasma_tuning.h"
 
+#include <stdbool.h>
+#include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <omp.h>
 
-static int max_contexts = 1024;
-static int num_contexts = 0;
+// Registry of the contexts of all attached threads.
+// It is a list of chunks of slots, which are only ever appended and never
+// moved, so that it is read and updated without a lock. A slot is taken
+// by setting its used flag, and published by setting its context last.
+#define PLASMA_CONTEXT_MAP_CHUNK 1024
 
-plasma_context_map_t *context_map = NULL;
-pthread_mutex_t context_map_lock = PTHREAD_MUTEX_INITIALIZER;
+typedef struct plasma_context_chunk_s {
+    plasma_context_map_t slot[PLASMA_CONTEXT_MAP_CHUNK];
+    struct plasma_context_chunk_s *next;
+} plasma_context_chunk_t;
+
+static plasma_context_chunk_t context_map;
+
+// Context of the calling thread, set by plasma_context_attach().
+static __thread plasma_context_t *context_self = NULL;
 
 /***************************************************************************//**
     @ingroup plasma_init
@@ -27,23 +42,7 @@ pthread_mutex_t context_map_lock = PTHREAD_MUTEX_INITIALIZER;
 */
 int plasma_init()
 {
-    pthread_mutex_lock(&context_map_lock);
-
-    // Allocate context map if NULL.
-    if (context_map == NULL) {
-        context_map =
-            (plasma_context_map_t*)calloc(max_contexts,
-                                          sizeof(plasma_context_map_t));
-        if (context_map == NULL) {
-            pthread_mutex_unlock(&context_map_lock);
-            plasma_error("calloc() failed");
-            return PlasmaErrorOutOfMemory;
-        }
-    }
-    pthread_mutex_unlock(&context_map_lock);
-
-    plasma_context_attach();
-    return PlasmaSuccess;
+    return plasma_context_attach();
 }
 
 /***************************************************************************//**
@@ -52,8 +51,7 @@ int plasma_init()
 */
 int plasma_finalize()
 {
-    plasma_context_detach();
-    return PlasmaSuccess;
+    return plasma_context_detach();
 }
 
 /******************************************************************************/
@@ -88,6 +86,13 @@ int plasma_set(plasma_enum_t param, int value)
         }
         plasma->ib = value;
         break;
+    case PlasmaInplaceOutplace:
+        if (value != PlasmaInplace && value != PlasmaOutplace) {
+            plasma_error("invalid layout translation mode");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->inplace_outplace = value;
+        break;
     case PlasmaNumPanelThreads:
         if (value <= 0) {
             plasma_error("invalid number of panel threads");
@@ -102,6 +107,69 @@ int plasma_set(plasma_enum_t param, int value)
         }
         plasma->householder_mode = value;
         break;
+    case PlasmaFusedDriver:
+        if (value != PlasmaEnabled && value != PlasmaDisabled) {
+            plasma_error("invalid fused driver flag");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->fused_driver = value;
+        break;
+    case PlasmaDistribution:
+        if (value != PlasmaDistributionNone &&
+            value != PlasmaDistributionBlockCyclic) {
+            plasma_error("invalid tile distribution");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->distribution = value;
+        break;
+    case PlasmaGetrfPanel:
+        if (value != PlasmaPanelIterative &&
+            value != PlasmaPanelRecursive &&
+            value != PlasmaPanelTournament) {
+            plasma_error("invalid LU panel variant");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->getrf_panel = value;
+        break;
+    case PlasmaLookahead:
+        if (value < 0) {
+            plasma_error("invalid lookahead depth");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->lookahead = value;
+        break;
+    case PlasmaGraphCache:
+        if (value != PlasmaEnabled && value != PlasmaDisabled) {
+            plasma_error("invalid graph cache flag");
+            return PlasmaErrorIllegalValue;
+        }
+        if (value == PlasmaDisabled)
+            plasma_graph_cache_clear(&plasma->graphs);
+        plasma->graph_cache = value;
+        break;
+    case PlasmaNestedTasks:
+        if (value < 0) {
+            plasma_error("invalid number of nested tasks");
+            return PlasmaErrorIllegalValue;
+        }
+        plasma->nested_tasks = value;
+        break;
+    case PlasmaHugePages:
+        if (value != PlasmaHugePagesNone &&
+            value != PlasmaHugePagesTransparent &&
+            value != PlasmaHugePagesExplicit) {
+            plasma_error("invalid huge pages mode");
+            return PlasmaErrorIllegalValue;
+        }
+        // Drop the cached memory backed by the previous kind of pages.
+        // The mode is only written here, so it is read without the lock.
+        if (value != plasma->pool.huge_pages) {
+            pthread_mutex_lock(&plasma->pool.lock);
+            plasma->pool.huge_pages = value;
+            pthread_mutex_unlock(&plasma->pool.lock);
+            plasma_pool_release_all(&plasma->pool);
+        }
+        break;
     default:
         plasma_error("unknown parameter");
         return PlasmaErrorIllegalValue;
@@ -129,12 +197,36 @@ int plasma_get(plasma_enum_t param, int *value)
     case PlasmaIb:
         *value = plasma->ib;
         return PlasmaSuccess;
+    case PlasmaInplaceOutplace:
+        *value = plasma->inplace_outplace;
+        return PlasmaSuccess;
     case PlasmaNumPanelThreads:
         *value = plasma->max_panel_threads;
         return PlasmaSuccess;
     case PlasmaHouseholderMode:
         *value = plasma->householder_mode;
         return PlasmaSuccess;
+    case PlasmaFusedDriver:
+        *value = plasma->fused_driver;
+        return PlasmaSuccess;
+    case PlasmaDistribution:
+        *value = plasma->distribution;
+        return PlasmaSuccess;
+    case PlasmaGetrfPanel:
+        *value = plasma->getrf_panel;
+        return PlasmaSuccess;
+    case PlasmaLookahead:
+        *value = plasma->lookahead;
+        return PlasmaSuccess;
+    case PlasmaGraphCache:
+        *value = plasma->graph_cache;
+        return PlasmaSuccess;
+    case PlasmaNestedTasks:
+        *value = plasma->nested_tasks;
+        return PlasmaSuccess;
+    case PlasmaHugePages:
+        *value = plasma->pool.huge_pages;
+        return PlasmaSuccess;
     default:
         plasma_error("Unknown parameter");
         return PlasmaErrorIllegalValue;
@@ -142,87 +234,125 @@ int plasma_get(plasma_enum_t param, int *value)
     return PlasmaSuccess;
 }
 
+/***************************************************************************//**
+ *
+ *  Takes a free slot in the registry, appending a chunk if all are taken.
+ *
+ */
+static plasma_context_map_t *plasma_context_map_take()
+{
+    plasma_context_chunk_t *chunk = &context_map;
+    while (true) {
+        for (int i = 0; i < PLASMA_CONTEXT_MAP_CHUNK; i++) {
+            plasma_context_map_t *slot = &chunk->slot[i];
+            if (__atomic_load_n(&slot->used, __ATOMIC_RELAXED) == 0 &&
+                __sync_bool_compare_and_swap(&slot->used, 0, 1)) {
+                return slot;
+            }
+        }
+        plasma_context_chunk_t *next =
+            __atomic_load_n(&chunk->next, __ATOMIC_ACQUIRE);
+        if (next == NULL) {
+            next = (plasma_context_chunk_t*)calloc(
+                1, sizeof(plasma_context_chunk_t));
+            if (next == NULL)
+                return NULL;
+            // Another thread may have appended a chunk meanwhile.
+            if (!__sync_bool_compare_and_swap(&chunk->next, NULL, next)) {
+                free(next);
+                next = __atomic_load_n(&chunk->next, __ATOMIC_ACQUIRE);
+            }
+        }
+        chunk = next;
+    }
+}
+
 /******************************************************************************/
 int plasma_context_attach()
 {
-    pthread_mutex_lock(&context_map_lock);
-
-    // Reallocate context map if out of space.
-    if (num_contexts == max_contexts-1) {
-        max_contexts *= 2;
-        context_map = (plasma_context_map_t*) realloc(
-            &context_map, max_contexts*sizeof(plasma_context_map_t));
-        if (context_map == NULL) {
-            pthread_mutex_unlock(&context_map_lock);
-            plasma_error("realloc() failed");
-            return PlasmaErrorOutOfMemory;
-        }
+    if (context_self != NULL) {
+        plasma_error("context already attached");
+        return PlasmaErrorIllegalValue;
     }
     // Create the context.
     plasma_context_t *context;
     context = (plasma_context_t*)malloc(sizeof(plasma_context_t));
     if (context == NULL) {
-        pthread_mutex_unlock(&context_map_lock);
         plasma_error("malloc() failed");
         return PlasmaErrorOutOfMemory;
     }
     // Initialize the context.
     plasma_context_init(context);
 
-    // Find and empty slot and insert the context.
-    for (int i = 0; i < max_contexts; i++) {
-        if (context_map[i].context == NULL) {
-            context_map[i].context = context;
-            context_map[i].thread_id = pthread_self();
-            num_contexts++;
-            pthread_mutex_unlock(&context_map_lock);
-            return PlasmaSuccess;
-        }
+    // Register the context.
+    plasma_context_map_t *slot = plasma_context_map_take();
+    if (slot == NULL) {
+        plasma_context_finalize(context);
+        free(context);
+        plasma_error("calloc() failed");
+        return PlasmaErrorOutOfMemory;
     }
-    // This should never happen.
-    pthread_mutex_unlock(&context_map_lock);
-    plasma_error("empty slot not found");
-    return PlasmaErrorInternal;
+    slot->thread_id = pthread_self();
+    __atomic_store_n(&slot->context, context, __ATOMIC_RELEASE);
+
+    context_self = context;
+    return PlasmaSuccess;
 }
 
 /******************************************************************************/
 int plasma_context_detach()
 {
-    pthread_mutex_lock(&context_map_lock);
-
-    // Find the thread and remove its context.
-    for (int i = 0; i < max_contexts; i++) {
-        if (context_map[i].context != NULL &&
-            pthread_equal(context_map[i].thread_id, pthread_self())) {
+    plasma_context_t *context = context_self;
+    if (context == NULL) {
+        plasma_error("context not found");
+        return PlasmaErrorInternal;
+    }
+    // Find the slot of the context and release it.
+    for (plasma_context_chunk_t *chunk = &context_map; chunk != NULL;
+         chunk = __atomic_load_n(&chunk->next, __ATOMIC_ACQUIRE)) {
+        for (int i = 0; i < PLASMA_CONTEXT_MAP_CHUNK; i++) {
+            plasma_context_map_t *slot = &chunk->slot[i];
+            if (__atomic_load_n(&slot->context, __ATOMIC_ACQUIRE) == context) {
+                __atomic_store_n(&slot->context, NULL, __ATOMIC_RELAXED);
+                __atomic_store_n(&slot->used, 0, __ATOMIC_RELEASE);
 
-            plasma_context_finalize(context_map[i].context);
-            free(context_map[i].context);
-            context_map[i].context = NULL;
-            num_contexts--;
-            pthread_mutex_unlock(&context_map_lock);
-            return PlasmaSuccess;
+                context_self = NULL;
+                plasma_context_finalize(context);
+                free(context);
+                return PlasmaSuccess;
+            }
         }
     }
-    pthread_mutex_unlock(&context_map_lock);
     plasma_error("context not found");
     return PlasmaErrorInternal;
 }
 
-/******************************************************************************/
+/***************************************************************************//**
+ *
+ *  Returns the context of the calling thread. This is a thread-local
+ *  lookup; the registry is only searched for threads without one,
+ *  which is an error.
+ *
+ */
 plasma_context_t *plasma_context_self()
 {
-    pthread_mutex_lock(&context_map_lock);
-
-    // Find the thread and return its context.
-    for (int i = 0; i < max_contexts; i++) {
-        if (context_map[i].context != NULL &&
-            pthread_equal(context_map[i].thread_id, pthread_self())) {
+    plasma_context_t *context = context_self;
+    if (context != NULL)
+        return context;
 
-            pthread_mutex_unlock(&context_map_lock);
-            return context_map[i].context;
+    // Find the thread in the registry.
+    pthread_t self = pthread_self();
+    for (plasma_context_chunk_t *chunk = &context_map; chunk != NULL;
+         chunk = __atomic_load_n(&chunk->next, __ATOMIC_ACQUIRE)) {
+        for (int i = 0; i < PLASMA_CONTEXT_MAP_CHUNK; i++) {
+            plasma_context_map_t *slot = &chunk->slot[i];
+            context = __atomic_load_n(&slot->context, __ATOMIC_ACQUIRE);
+            if (context != NULL && pthread_equal(slot->thread_id, self)) {
+                context_self = context;
+                return context;
+            }
         }
     }
-    pthread_mutex_unlock(&context_map_lock);
     plasma_error("context not found");
     return NULL;
 }
@@ -238,12 +368,112 @@ void plasma_context_init(plasma_context_t *context)
     context->max_threads = omp_get_max_threads();
     context->max_panel_threads = 1;
     context->householder_mode = PlasmaFlatHouseholder;
+    context->fused_driver = PlasmaDisabled;
+    context->distribution = PlasmaDistributionNone;
+    context->getrf_panel = PlasmaPanelIterative;
+    context->lookahead = 1;
+    context->batch = 0;
+    context->nested_tasks = 0;
+    context->graph_cache = PlasmaDisabled;
+    context->graphs = NULL;
 
+    plasma_pool_init(&context->pool);
     plasma_tuning_init(context);
+
+    // Back large allocations with huge pages if PLASMA_HUGE_PAGES is set.
+    char *huge_pages = getenv("PLASMA_HUGE_PAGES");
+    if (huge_pages != NULL) {
+        if (strcmp(huge_pages, "transparent") == 0)
+            context->pool.huge_pages = PlasmaHugePagesTransparent;
+        else if (strcmp(huge_pages, "explicit") == 0)
+            context->pool.huge_pages = PlasmaHugePagesExplicit;
+        else if (strcmp(huge_pages, "none") != 0)
+            plasma_error("invalid PLASMA_HUGE_PAGES");
+    }
+
+    // Distribute the tiles across the devices in the p-by-q grid set by
+    // PLASMA_DEVICE_GRID, e.g., 2x4, by default in a grid of all the devices
+    // as close to square as possible when offloading.
+    context->device_p = 0;
+    context->device_q = 0;
+    int num_devices = omp_get_num_devices();
+    char *device_grid = getenv("PLASMA_DEVICE_GRID");
+    if (device_grid != NULL) {
+        int p, q;
+        char x;
+        if (sscanf(device_grid, "%d%c%d", &p, &x, &q) == 3 &&
+            (x == 'x' || x == 'X') && p > 0 && q > 0 &&
+            p*q <= num_devices) {
+            context->device_p = p;
+            context->device_q = q;
+        }
+        else if (strcmp(device_grid, "none") != 0) {
+            plasma_error("invalid PLASMA_DEVICE_GRID");
+        }
+    }
+#if defined(USE_OFFLOAD)
+    else if (num_devices > 1) {
+        int p = 1;
+        for (int d = 1; d*d <= num_devices; d++)
+            if (num_devices%d == 0)
+                p = d;
+        context->device_p = p;
+        context->device_q = num_devices/p;
+    }
+#endif
+
+    // Batch the small tile operations by PLASMA_BATCH per task, 1 disabling
+    // batching, otherwise by a number adapted to the tile size and threads.
+    char *batch = getenv("PLASMA_BATCH");
+    if (batch != NULL) {
+        char *end;
+        long size = strtol(batch, &end, 10);
+        if (*batch != '\0' && *end == '\0' && size >= 1)
+            context->batch = (int)size;
+        else if (strcmp(batch, "auto") != 0)
+            plasma_error("invalid PLASMA_BATCH");
+    }
+
+    // Split the critical-path kernels into PLASMA_NESTED nested tasks,
+    // 1 disabling nesting, otherwise (0 or auto) among the idle threads
+    // for large tiles, as with plasma_set().
+    char *nested = getenv("PLASMA_NESTED");
+    if (nested != NULL) {
+        char *end;
+        long tasks = strtol(nested, &end, 10);
+        if (*nested != '\0' && *end == '\0' && tasks >= 0)
+            context->nested_tasks = (int)tasks;
+        else if (strcmp(nested, "auto") != 0)
+            plasma_error("invalid PLASMA_NESTED");
+    }
+
+    // Cap the instruction set of the SIMD tile kernels by PLASMA_SIMD,
+    // otherwise detected from the CPU.
+    char *simd = getenv("PLASMA_SIMD");
+    if (simd != NULL) {
+        if (strcmp(simd, "none") == 0)
+            plasma_core_simd_set_isa(PlasmaSimdNone);
+        else if (strcmp(simd, "avx2") == 0)
+            plasma_core_simd_set_isa(PlasmaSimdAvx2);
+        else if (strcmp(simd, "avx512") == 0)
+            plasma_core_simd_set_isa(PlasmaSimdAvx512);
+        else
+            plasma_error("invalid PLASMA_SIMD");
+    }
+
+    // Trace the tasks to the file named by PLASMA_TRACE, if set.
+    if (getenv("PLASMA_TRACE") != NULL)
+        plasma_trace_start();
 }
 
 /******************************************************************************/
 void plasma_context_finalize(plasma_context_t *context)
 {
+    char *trace = getenv("PLASMA_TRACE");
+    if (trace != NULL)
+        plasma_trace_stop(trace);
+
     plasma_tuning_finalize(context);
+    plasma_graph_cache_clear(&context->graphs);
+    plasma_pool_finalize(&context->pool);
 }
@@ -0,0 +1,275 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_depend.h"
+#include "plasma_descriptor.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+/***************************************************************************//**
+ *
+ *  Returns the range [m_start, m_end) of tile rows stored in tile column n.
+ *
+ */
+static void plasma_desc_column_tiles(plasma_desc_t A, int n,
+                                     int *m_start, int *m_end)
+{
+    if (A.type == PlasmaGeneralBand) {
+        if (A.uplo == PlasmaGeneral) {
+            *m_start = (imax(0, n*A.nb-A.ku-A.kl)) / A.nb;
+            *m_end = (imin(A.m-1, (n+1)*A.nb+A.kl-1)) / A.nb + 1;
+        }
+        else if (A.uplo == PlasmaUpper) {
+            *m_start = (imax(0, n*A.nb-A.ku)) / A.nb;
+            *m_end = (imin(A.m-1, (n+1)*A.nb-1)) / A.nb + 1;
+        }
+        else {
+            *m_start = (imax(0, n*A.nb)) / A.nb;
+            *m_end = (imin(A.m-1, (n+1)*A.nb+A.kl-1)) / A.nb + 1;
+        }
+    }
+    else if (A.type == PlasmaUpper) {
+        *m_start = 0;
+        *m_end = imin(n+1, A.mt);
+    }
+    else if (A.type == PlasmaLower) {
+        *m_start = n;
+        *m_end = A.mt;
+    }
+    else {
+        *m_start = 0;
+        *m_end = A.mt;
+    }
+}
+
+#ifdef PLASMA_DEPEND_ITERATOR
+/***************************************************************************//**
+ *
+ *  Returns tile (m, n) of A if it is stored, and a0 otherwise, so that
+ *  a depend iterator over all the tile positions only addresses stored
+ *  tiles.
+ *
+ */
+static void *plasma_desc_stored_tile(plasma_desc_t A, int m, int n, void *a0)
+{
+    int m_start, m_end;
+    plasma_desc_column_tiles(A, n, &m_start, &m_end);
+    if (m < m_start || m >= m_end)
+        return a0;
+    return plasma_tile_addr(A, m, n);
+}
+#endif
+
+/***************************************************************************//**
+ *
+ *  Makes the element whole depend on the tiles (m, n) of A,
+ *  for m in [m_start, m_end) and n in [n_start, n_end), which must not
+ *  include whole. Once the gather is submitted, every task depending on
+ *  whole is ordered after every previously submitted task writing any of
+ *  the tiles.
+ *
+ */
+void plasma_omp_desc_gather(plasma_desc_t A,
+                            int m_start, int m_end, int n_start, int n_end,
+                            const void *whole)
+{
+    if (m_end <= m_start || n_end <= n_start)
+        return;
+
+#ifdef PLASMA_DEPEND_ITERATOR
+    #pragma omp task PLASMA_DEPEND_TILES(in, A, m_start, m_end, \
+                                         n_start, n_end) \
+                     depend (inout:((const char*)whole)[0])
+    {
+    }
+#else
+    const char *w = (const char*)whole;
+    for (int n = n_start; n < n_end; n++) {
+        for (int m = m_start; m < m_end; m++) {
+            char *amn = (char*)plasma_tile_addr(A, m, n);
+            #pragma omp task depend (in:amn[0]) \
+                             depend (inout:w[0])
+            {
+                int l = 1;
+                l++;
+            }
+        }
+    }
+#endif
+}
+
+/***************************************************************************//**
+ *
+ *  Makes the tiles (m, n) of A depend on the element whole,
+ *  for m in [m_start, m_end) and n in [n_start, n_end), which must not
+ *  include whole. Once the scatter is submitted, every task depending on
+ *  any of the tiles is ordered after every previously submitted task
+ *  writing whole.
+ *
+ */
+void plasma_omp_desc_scatter(plasma_desc_t A,
+                             int m_start, int m_end, int n_start, int n_end,
+                             const void *whole)
+{
+    if (m_end <= m_start || n_end <= n_start)
+        return;
+
+#ifdef PLASMA_DEPEND_ITERATOR
+    #pragma omp task depend (in:((const char*)whole)[0]) \
+                     PLASMA_DEPEND_TILES(inout, A, m_start, m_end, \
+                                         n_start, n_end)
+    {
+    }
+#else
+    const char *w = (const char*)whole;
+    for (int n = n_start; n < n_end; n++) {
+        for (int m = m_start; m < m_end; m++) {
+            char *amn = (char*)plasma_tile_addr(A, m, n);
+            #pragma omp task depend (in:w[0]) \
+                             depend (inout:amn[0])
+            {
+                int l = 1;
+                l++;
+            }
+        }
+    }
+#endif
+}
+
+/***************************************************************************//**
+ *
+ *  Makes the first of count chunks of x, stride bytes apart, depend on
+ *  the others, e.g., the whole pivot vector on the chunks of its tiles.
+ *
+ */
+void plasma_omp_chunks_gather(const void *x, int count, size_t stride)
+{
+    if (count < 2)
+        return;
+
+    const char *x0 = (const char*)x;
+#ifdef PLASMA_DEPEND_ITERATOR
+    #pragma omp task PLASMA_DEPEND_CHUNKS(in, x0, 1, count, stride) \
+                     depend (inout:x0[0])
+    {
+    }
+#else
+    for (int i = 1; i < count; i++) {
+        const char *xi = &x0[(size_t)i*stride];
+        #pragma omp task depend (in:xi[0]) \
+                         depend (inout:x0[0])
+        {
+            int l = 1;
+            l++;
+        }
+    }
+#endif
+}
+
+/***************************************************************************//**
+ *
+ *  Inserts a dependency fence on tile column n of A.
+ *  Once the fence is submitted, every task depending on any tile of
+ *  the column is ordered after every previously submitted task depending on
+ *  any tile of the column. This allows tasks addressing a whole column
+ *  through its first tile to follow tasks addressing individual tiles,
+ *  and the other way around, without joining the whole task graph.
+ *  With depend iterators, the fence is a single task.
+ *
+ */
+void plasma_omp_desc_fence_column(plasma_desc_t A, int n)
+{
+    int m_start, m_end;
+    plasma_desc_column_tiles(A, n, &m_start, &m_end);
+    if (m_end-m_start < 2)
+        return;
+
+#ifdef PLASMA_DEPEND_ITERATOR
+    #pragma omp task PLASMA_DEPEND_TILES(inout, A, m_start, m_end, n, n+1)
+    {
+    }
+#else
+    char *a0 = (char*)plasma_tile_addr(A, m_start, n);
+
+    // Multidependency of the whole column on its individual tiles.
+    plasma_omp_desc_gather(A, m_start+1, m_end, n, n+1, a0);
+
+    // Multidependency of individual tiles on the whole column.
+    plasma_omp_desc_scatter(A, m_start+1, m_end, n, n+1, a0);
+#endif
+}
+
+/******************************************************************************/
+void plasma_omp_desc_fence_columns(plasma_desc_t A)
+{
+    for (int n = 0; n < A.nt; n++)
+        plasma_omp_desc_fence_column(A, n);
+}
+
+/***************************************************************************//**
+ *
+ *  Inserts a dependency fence on the whole matrix A.
+ *  Needed instead of column fences when tasks addressing one tile column
+ *  access tiles of other columns, e.g., symmetric swaps in hetrf.
+ *
+ */
+void plasma_omp_desc_fence(plasma_desc_t A)
+{
+    if (A.nt == 0)
+        return;
+
+    int m_start, m_end;
+    plasma_desc_column_tiles(A, 0, &m_start, &m_end);
+    if (m_end-m_start < 1)
+        return;
+
+    char *a0 = (char*)plasma_tile_addr(A, m_start, 0);
+
+#ifdef PLASMA_DEPEND_ITERATOR
+    // The tile positions outside the stored columns map to a0.
+    #pragma omp task depend(iterator(int n = 0:A.nt, int m = 0:A.mt), \
+                            inout:((char*)plasma_desc_stored_tile( \
+                                A, m, n, a0))[0])
+    {
+    }
+#else
+    // Multidependency of the whole matrix on its individual tiles.
+    for (int n = 0; n < A.nt; n++) {
+        plasma_desc_column_tiles(A, n, &m_start, &m_end);
+        for (int m = m_start; m < m_end; m++) {
+            char *amn = (char*)plasma_tile_addr(A, m, n);
+            if (amn == a0)
+                continue;
+            #pragma omp task depend (in:amn[0]) \
+                             depend (inout:a0[0])
+            {
+                int l = 1;
+                l++;
+            }
+        }
+    }
+
+    // Multidependency of individual tiles on the whole matrix.
+    for (int n = 0; n < A.nt; n++) {
+        plasma_desc_column_tiles(A, n, &m_start, &m_end);
+        for (int m = m_start; m < m_end; m++) {
+            char *amn = (char*)plasma_tile_addr(A, m, n);
+            if (amn == a0)
+                continue;
+            #pragma omp task depend (in:a0[0]) \
+                             depend (inout:amn[0])
+            {
+                int l = 1;
+                l++;
+            }
+        }
+    }
+#endif
+}
@@ -11,6 +11,255 @@
 #include "plasma_context.h"
 #include "plasma_descriptor.h"
 #include "plasma_internal.h"
+#include "plasma_trace.h"
+
+#include <stdint.h>
+#include <string.h>
+#include <omp.h>
+
+/***************************************************************************//**
+ *
+ *  Adds shift to the offset of a tile of the given size, and increases
+ *  shift as needed for the tile not to straddle a huge page boundary.
+ *  Tiles larger than a huge page are left unaligned.
+ *
+ */
+static void plasma_desc_tile_shift(void **tile, size_t bytes, size_t *shift)
+{
+    size_t page = PLASMA_POOL_HUGE_PAGE_SIZE;
+    size_t offset = (uintptr_t)*tile + *shift;
+    if (bytes <= page && offset/page != (offset+bytes-1)/page)
+        *shift += page - offset%page;
+
+    *tile = (void*)((uintptr_t)*tile + *shift);
+}
+
+/***************************************************************************//**
+ *
+ *  Moves the tiles of the general matrix G, given by their offsets in
+ *  the table, so that none straddles a huge page boundary.
+ *  The tiles are visited in the order of storage: the full tiles by
+ *  columns, then the bottom row, the right column and the corner tile.
+ *  Returns the number of bytes added to the storage.
+ *
+ */
+static size_t plasma_desc_tiles_pack(plasma_desc_t G, void **tiles)
+{
+    size_t eltsize = plasma_element_size(G.precision);
+    int lm1 = G.gm/G.mb;
+    int ln1 = G.gn/G.nb;
+    size_t shift = 0;
+
+    for (int n = 0; n < ln1; n++)
+        for (int m = 0; m < lm1; m++)
+            plasma_desc_tile_shift(&tiles[m + (size_t)G.gmt*n],
+                                   eltsize*G.mb*G.nb, &shift);
+    if (lm1 < G.gmt)
+        for (int n = 0; n < ln1; n++)
+            plasma_desc_tile_shift(&tiles[lm1 + (size_t)G.gmt*n],
+                                   eltsize*(G.gm%G.mb)*G.nb, &shift);
+    if (ln1 < G.gnt)
+        for (int m = 0; m < lm1; m++)
+            plasma_desc_tile_shift(&tiles[m + (size_t)G.gmt*ln1],
+                                   eltsize*G.mb*(G.gn%G.nb), &shift);
+    if (lm1 < G.gmt && ln1 < G.gnt)
+        plasma_desc_tile_shift(&tiles[lm1 + (size_t)G.gmt*ln1],
+                               eltsize*(G.gm%G.mb)*(G.gn%G.nb), &shift);
+    return shift;
+}
+
+/***************************************************************************//**
+ *
+ *  Builds the table of tile addresses and tile leading dimensions of A,
+ *  so that plasma_tile_addr() and plasma_tile_mmain() become lookups.
+ *  The table covers the entire matrix and views point into it.
+ *  The addresses are offsets from the start of the storage until
+ *  plasma_desc_tiles_rebase() is called with the allocated matrix.
+ *  With huge pages, general matrices are laid out for no tile to straddle
+ *  a page boundary, and size is increased by the padding.
+ *
+ */
+static int plasma_desc_tiles_create(plasma_context_t *plasma, plasma_desc_t *A,
+                                    size_t *size)
+{
+    size_t ntiles = (size_t)A->gmt*A->gnt;
+    if (ntiles == 0)
+        return PlasmaSuccess;
+
+    void **tiles = (void**)plasma_pool_malloc(
+        &plasma->pool, ntiles*sizeof(void*) + A->gmt*sizeof(int));
+    if (tiles == NULL) {
+        plasma_error("plasma_pool_malloc() failed");
+        return PlasmaErrorOutOfMemory;
+    }
+    int *tile_ld = (int*)(tiles+ntiles);
+
+    // Band tiles are looked up by their storage position.
+    plasma_desc_t G = *A;
+    G.matrix = NULL;
+    G.i = 0;
+    G.j = 0;
+    if (G.type == PlasmaGeneralBand)
+        G.type = PlasmaGeneral;
+
+    for (int n = 0; n < G.gnt; n++)
+        for (int m = 0; m < G.gmt; m++)
+            tiles[m + (size_t)G.gmt*n] = plasma_tile_addr(G, m, n);
+
+    if (A->type == PlasmaGeneral &&
+        plasma->pool.huge_pages != PlasmaHugePagesNone &&
+        *size >= PLASMA_POOL_HUGE_PAGE_SIZE) {
+        *size += plasma_desc_tiles_pack(G, tiles);
+    }
+
+    for (int m = 0; m < G.gmt; m++)
+        tile_ld[m] = plasma_tile_mmain(G, m);
+
+    A->tiles = tiles + A->i/A->mb + (size_t)A->gmt*(A->j/A->nb);
+    A->tile_ld = tile_ld + A->i/A->mb;
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+static void plasma_desc_tiles_rebase(plasma_desc_t *A)
+{
+    void **tiles = A->tiles - A->i/A->mb - (size_t)A->gmt*(A->j/A->nb);
+    for (size_t k = 0; k < (size_t)A->gmt*A->gnt; k++)
+        tiles[k] = (char*)A->matrix + (uintptr_t)tiles[k];
+}
+
+/***************************************************************************//**
+ *
+ *  Sets the distribution of the tiles of a general matrix A across
+ *  the devices, in the grid of the context, set by PLASMA_DEVICE_GRID.
+ *
+ */
+static void plasma_desc_distribute_devices(plasma_context_t *plasma,
+                                           plasma_desc_t *A)
+{
+    A->dev_p = 0;
+    A->dev_q = 0;
+    if (plasma == NULL || plasma->device_p == 0 ||
+        (A->type != PlasmaGeneral && A->type != PlasmaGeneralStrided)) {
+        return;
+    }
+    A->dev_p = plasma->device_p;
+    A->dev_q = plasma->device_q;
+}
+
+/***************************************************************************//**
+ *
+ *  Sets the distribution of the tiles of A across NUMA domains.
+ *  The domains are the OpenMP places, e.g., OMP_PLACES=sockets,
+ *  and are arranged in a p-by-q grid as close to square as possible.
+ *  Band matrices are not distributed.
+ *
+ */
+static void plasma_desc_distribute(plasma_context_t *plasma, plasma_desc_t *A)
+{
+    plasma_desc_distribute_devices(plasma, A);
+
+    A->distribution = PlasmaDistributionNone;
+    A->dist_p = 1;
+    A->dist_q = 1;
+
+    int nplaces = omp_get_num_places();
+    if (plasma->distribution != PlasmaDistributionBlockCyclic ||
+        A->type == PlasmaGeneralBand ||
+        omp_get_proc_bind() == omp_proc_bind_false ||
+        nplaces < 2) {
+        return;
+    }
+    int p = 1;
+    for (int d = 1; d*d <= nplaces; d++)
+        if (nplaces%d == 0)
+            p = d;
+
+    A->distribution = PlasmaDistributionBlockCyclic;
+    A->dist_p = p;
+    A->dist_q = nplaces/p;
+}
+
+/***************************************************************************//**
+ *
+ *  Touches each tile of A first from a thread running on the tile's home
+ *  domain, so that the operating system places its pages there.
+ *  The threads sharing a domain split its tiles among themselves.
+ *
+ */
+static void plasma_desc_first_touch(plasma_desc_t *A)
+{
+    int nhomes = A->dist_p*A->dist_q;
+    int nthreads[nhomes];
+    for (int home = 0; home < nhomes; home++)
+        nthreads[home] = 0;
+
+    size_t eltsize = plasma_element_size(A->precision);
+
+    #pragma omp parallel
+    {
+        int home = imax(0, omp_get_place_num())%nhomes;
+        int rank;
+        #pragma omp atomic capture
+        rank = nthreads[home]++;
+        #pragma omp barrier
+
+        int k = 0;
+        for (int n = 0; n < A->gnt; n++) {
+            int m_start = A->type == PlasmaLower ? n : 0;
+            int m_end = A->type == PlasmaUpper ? imin(n+1, A->gmt) : A->gmt;
+            for (int m = m_start; m < m_end; m++) {
+                if (plasma_tile_home(*A, m, n) != home)
+                    continue;
+                if (k++%nthreads[home] != rank)
+                    continue;
+                memset(plasma_tile_addr(*A, m, n), 0,
+                       eltsize*plasma_tile_mmain(*A, m)*
+                               plasma_tile_nmain(*A, n));
+            }
+        }
+    }
+}
+
+/***************************************************************************//**
+ *
+ *  Allocates size bytes of tile storage for A, plus the padding of the
+ *  huge page layout if any, and builds its tile table.
+ *  Distributed matrices take fresh memory, not reused from the pool,
+ *  for their pages to be placed by the first touch.
+ *
+ */
+static int plasma_desc_matrix_create(plasma_context_t *plasma,
+                                     plasma_desc_t *A, size_t size)
+{
+    plasma_desc_distribute(plasma, A);
+
+    // Build the tile table.
+    int retval = plasma_desc_tiles_create(plasma, A, &size);
+    if (retval != PlasmaSuccess)
+        return retval;
+
+    if (A->distribution == PlasmaDistributionBlockCyclic)
+        A->matrix = plasma_pool_malloc_fresh(&plasma->pool, size);
+    else
+        A->matrix = plasma_pool_malloc(&plasma->pool, size);
+    if (A->matrix == NULL) {
+        plasma_error("plasma_pool_malloc() failed");
+        if (A->tiles != NULL) {
+            plasma_pool_free(&plasma->pool, A->tiles - A->i/A->mb -
+                                            (size_t)A->gmt*(A->j/A->nb));
+        }
+        return PlasmaErrorOutOfMemory;
+    }
+    if (A->tiles != NULL)
+        plasma_desc_tiles_rebase(A);
+
+    if (A->distribution == PlasmaDistributionBlockCyclic)
+        plasma_desc_first_touch(A);
+
+    plasma_trace_desc_create(A);
+    return PlasmaSuccess;
+}
 
 /******************************************************************************/
 int plasma_desc_general_create(plasma_enum_t precision, int mb, int nb,
@@ -38,12 +287,7 @@ int plasma_desc_general_create(plasma_enum_t precision, int mb, int nb,
     // Allocate the matrix.
     size_t size = (size_t)A->gm*A->gn*
                   plasma_element_size(A->precision);
-    A->matrix = malloc(size);
-    if (A->matrix == NULL) {
-        plasma_error("malloc() failed");
-        return PlasmaErrorOutOfMemory;
-    }
-    return PlasmaSuccess;
+    return plasma_desc_matrix_create(plasma, A, size);
 }
 
 /******************************************************************************/
@@ -73,12 +317,7 @@ int plasma_desc_general_band_create(plasma_enum_t precision, plasma_enum_t uplo,
     // Allocate the matrix.
     size_t size = (size_t)A->gm*A->gn*
                   plasma_element_size(A->precision);
-    A->matrix = malloc(size);
-    if (A->matrix == NULL) {
-        plasma_error("malloc() failed");
-        return PlasmaErrorOutOfMemory;
-    }
-    return PlasmaSuccess;
+    return plasma_desc_matrix_create(plasma, A, size);
 }
 
 /******************************************************************************/
@@ -110,12 +349,7 @@ int plasma_desc_triangular_create(plasma_enum_t precision, plasma_enum_t uplo, i
     int mnt = (ln1*(1+lm1))/2;
     size_t size = (size_t)(mnt*mb*nb + (lm * (ln%nb)))*
                   plasma_element_size(A->precision);
-    A->matrix = malloc(size);
-    if (A->matrix == NULL) {
-        plasma_error("malloc() failed");
-        return PlasmaErrorOutOfMemory;
-    }
-    return PlasmaSuccess;
+    return plasma_desc_matrix_create(plasma, A, size);
 }
 
 /******************************************************************************/
@@ -126,7 +360,12 @@ int plasma_desc_destroy(plasma_desc_t *A)
         plasma_error("PLASMA not initialized");
         return PlasmaErrorNotInitialized;
     }
-    free(A->matrix);
+    plasma_trace_desc_destroy(A);
+    plasma_pool_free(&plasma->pool, A->matrix);
+    if (A->tiles != NULL) {
+        plasma_pool_free(&plasma->pool,
+                         A->tiles - A->i/A->mb - (size_t)A->gmt*(A->j/A->nb));
+    }
     return PlasmaSuccess;
 }
 
@@ -144,6 +383,14 @@ int plasma_desc_general_init(plasma_enum_t precision, void *matrix,
     A->A21 = (size_t)(lm - lm%mb) * (ln - ln%nb);
     A->A12 = (size_t)(     lm%mb) * (ln - ln%nb) + A->A21;
     A->A22 = (size_t)(lm - lm%mb) * (     ln%nb) + A->A12;
+    A->ld = 0;
+    A->tiles = NULL;
+    A->tile_ld = NULL;
+    A->distribution = PlasmaDistributionNone;
+    A->dist_p = 1;
+    A->dist_q = 1;
+    A->dev_p = 0;
+    A->dev_q = 0;
 
     // tile parameters
     A->mb = mb;
@@ -233,6 +480,14 @@ int plasma_desc_triangular_init(plasma_enum_t precision, plasma_enum_t uplo, voi
     A->A21 = (size_t)(mb * nb) * mnt; // only for PlasmaLower
     A->A12 = (size_t)(mb * nb) * mnt; // only for PlasmaUpper
     A->A22 = (size_t)(lm - lm%mb) * (ln%nb) + A->A12;
+    A->ld = 0;
+    A->tiles = NULL;
+    A->tile_ld = NULL;
+    A->distribution = PlasmaDistributionNone;
+    A->dist_p = 1;
+    A->dist_q = 1;
+    A->dev_p = 0;
+    A->dev_q = 0;
 
     // tile parameters
     A->mb = mb;
@@ -263,6 +518,58 @@ int plasma_desc_triangular_init(plasma_enum_t precision, plasma_enum_t uplo, voi
     return PlasmaSuccess;
 }
 
+/***************************************************************************//**
+ *
+ *  Initializes a strided tile descriptor over the user's m-by-n column-major
+ *  array pA. The tiles are mb-by-nb sub-blocks of pA addressed with
+ *  the leading dimension lda, so no translation is needed.
+ *
+ */
+int plasma_desc_general_strided_init(plasma_enum_t precision, void *pA, int lda,
+                                     int mb, int nb, int m, int n,
+                                     plasma_desc_t *A)
+{
+    if (lda < imax(1, m)) {
+        plasma_error("invalid leading dimension");
+        return PlasmaErrorIllegalValue;
+    }
+    int retval = plasma_desc_general_init(precision, pA, mb, nb,
+                                          m, n, 0, 0, m, n, A);
+    if (retval != PlasmaSuccess) {
+        plasma_error("plasma_desc_general_init() failed");
+        return retval;
+    }
+    A->type = PlasmaGeneralStrided;
+    A->ld = lda;
+    plasma_desc_distribute_devices(plasma_context_self(), A);
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *
+ *  Initializes a general tile descriptor over the user's column-major
+ *  array pA, to be translated in place.
+ *  In-place translation requires full tiles and a packed array,
+ *  i.e., m and n divisible by mb and nb and lda == m.
+ *  Returns PlasmaErrorNotSupported otherwise, in which case the caller
+ *  falls back to an out-of-place copy.
+ *
+ */
+int plasma_desc_general_inplace_init(plasma_enum_t precision, void *pA, int lda,
+                                     int mb, int nb, int m, int n,
+                                     plasma_desc_t *A)
+{
+    if (pA == NULL || m == 0 || n == 0 || lda != m ||
+        m%mb != 0 || n%nb != 0) {
+        return PlasmaErrorNotSupported;
+    }
+    int retval = plasma_desc_general_init(precision, pA, mb, nb,
+                                          m, n, 0, 0, m, n, A);
+    if (retval == PlasmaSuccess)
+        plasma_desc_distribute_devices(plasma_context_self(), A);
+    return retval;
+}
+
 /******************************************************************************/
 int plasma_desc_check(plasma_desc_t A)
 {
@@ -271,6 +578,13 @@ int plasma_desc_check(plasma_desc_t A)
         A.type == PlasmaLower) {
         return plasma_desc_general_check(A);
     }
+    else if (A.type == PlasmaGeneralStrided) {
+        if (A.ld < imax(1, A.gm)) {
+            plasma_error("invalid leading dimension");
+            return PlasmaErrorIllegalValue;
+        }
+        return plasma_desc_general_check(A);
+    }
     else if (A.type == PlasmaGeneralBand) {
         return plasma_desc_general_band_check(A);
     }
@@ -393,6 +707,12 @@ plasma_desc_t plasma_desc_view(plasma_desc_t A, int i, int j, int m, int n)
     B.mt = (m == 0) ? 0 : (B.i+m-1)/mb - B.i/mb + 1;
     B.nt = (n == 0) ? 0 : (B.j+n-1)/nb - B.j/nb + 1;
 
+    // tile table of the submatrix
+    if (A.tiles != NULL) {
+        B.tiles = A.tiles + (B.i/mb - A.i/mb) + (size_t)A.gmt*(B.j/nb - A.j/nb);
+        B.tile_ld = A.tile_ld + (B.i/mb - A.i/mb);
+    }
+
     return B;
 }
 
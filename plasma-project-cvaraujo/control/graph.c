@@ -0,0 +1,546 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_graph.h"
+#include "plasma_internal.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// Alignment of the recorded arguments, enough for any scalar type.
+#define PLASMA_GRAPH_ALIGNMENT 16
+
+/******************************************************************************/
+typedef struct {
+    int desc; ///< index of the descriptor
+    int m;    ///< tile row
+    int n;    ///< tile column
+} plasma_graph_tile_t;
+
+typedef struct {
+    plasma_graph_kernel_t kernel; ///< function executing the task
+    size_t args;                  ///< offset of the arguments
+    int tiles;                    ///< index of the first tile operand
+    int num_tiles;                ///< number of tile operands
+    int succ;                     ///< index of the first successor
+    int num_succ;                 ///< number of successors
+    int num_pred;                 ///< number of predecessors
+} plasma_graph_node_t;
+
+struct plasma_graph_s {
+    char *name;                ///< name of the routine
+    void *key;                 ///< shape and parameters of the call
+    size_t key_size;           ///< size of the key in bytes
+    plasma_graph_node_t *node; ///< tasks, in submission order
+    int num_nodes;             ///< number of tasks
+    plasma_graph_tile_t *tile; ///< tile operands of all tasks
+    int num_tiles;             ///< number of tile operands
+    int *succ;                 ///< successors of all tasks
+    char *args;                ///< arguments of all tasks
+    size_t args_size;          ///< size of the arguments in bytes
+    struct plasma_graph_s *next;
+};
+
+/******************************************************************************/
+// Tile of a captured descriptor, with the tasks accessing it so far.
+typedef struct {
+    const void *addr;         ///< address of the tile
+    plasma_graph_tile_t tile; ///< indices of the tile
+    int writer;               ///< last task writing the tile, or -1
+    int readers;              ///< list of tasks reading it since, or -1
+} plasma_graph_entry_t;
+
+typedef struct {
+    int task; ///< reading task
+    int next; ///< next node of the list, or -1
+} plasma_graph_reader_t;
+
+typedef struct {
+    int from;
+    int to;
+} plasma_graph_edge_t;
+
+typedef struct {
+    plasma_graph_t *graph;         ///< graph being recorded
+    int max_nodes;                 ///< capacity of graph->node
+    int max_tiles;                 ///< capacity of graph->tile
+    size_t max_args;               ///< capacity of graph->args
+    plasma_graph_entry_t *entry;   ///< tiles of the descriptors, by address
+    int num_entries;               ///< number of tiles
+    plasma_graph_reader_t *reader; ///< nodes of the reader lists
+    int num_readers;               ///< number of reader list nodes
+    int max_readers;               ///< capacity of reader
+    plasma_graph_edge_t *edge;     ///< dependencies
+    int num_edges;                 ///< number of dependencies
+    int max_edges;                 ///< capacity of edge
+    int failed;                    ///< nonzero if the graph cannot be recorded
+} plasma_graph_capture_t;
+
+// Capture in progress on the calling thread.
+static __thread int capturing = 0;
+static __thread plasma_graph_capture_t capture;
+
+/******************************************************************************/
+// Makes room for one more element in an array, doubling its capacity.
+static int plasma_graph_grow(void **array, int *max, int num, size_t size)
+{
+    if (num < *max)
+        return PlasmaSuccess;
+
+    int new_max = *max > 0 ? 2*(*max) : 64;
+    void *new_array = realloc(*array, (size_t)new_max*size);
+    if (new_array == NULL)
+        return PlasmaErrorOutOfMemory;
+
+    *array = new_array;
+    *max = new_max;
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+static int plasma_graph_compare_entry(const void *a, const void *b)
+{
+    const char *addr_a = (const char*)((const plasma_graph_entry_t*)a)->addr;
+    const char *addr_b = (const char*)((const plasma_graph_entry_t*)b)->addr;
+    return (addr_a > addr_b) - (addr_a < addr_b);
+}
+
+/******************************************************************************/
+static int plasma_graph_compare_edge(const void *a, const void *b)
+{
+    const plasma_graph_edge_t *edge_a = (const plasma_graph_edge_t*)a;
+    const plasma_graph_edge_t *edge_b = (const plasma_graph_edge_t*)b;
+    if (edge_a->from != edge_b->from)
+        return (edge_a->from > edge_b->from) - (edge_a->from < edge_b->from);
+    return (edge_a->to > edge_b->to) - (edge_a->to < edge_b->to);
+}
+
+/******************************************************************************/
+static void plasma_graph_destroy(plasma_graph_t *graph)
+{
+    free(graph->name);
+    free(graph->key);
+    free(graph->node);
+    free(graph->tile);
+    free(graph->succ);
+    free(graph->args);
+    free(graph);
+}
+
+/******************************************************************************/
+static void plasma_graph_add_edge(int from, int to)
+{
+    if (from == to)
+        return;
+
+    if (plasma_graph_grow((void**)&capture.edge, &capture.max_edges,
+                          capture.num_edges,
+                          sizeof(plasma_graph_edge_t)) != PlasmaSuccess) {
+        capture.failed = 1;
+        return;
+    }
+    capture.edge[capture.num_edges].from = from;
+    capture.edge[capture.num_edges].to = to;
+    capture.num_edges++;
+}
+
+/***************************************************************************//**
+ *
+ *  Returns nonzero if the calling thread is capturing a task graph,
+ *  in which case the plasma_core_omp_* kernels record their tasks
+ *  with plasma_graph_record() instead of submitting them.
+ *
+ */
+int plasma_graph_capturing()
+{
+    return capturing;
+}
+
+/***************************************************************************//**
+ *
+ *  Records a task of the captured graph.
+ *
+ * @param[in] kernel
+ *          Function executing the task.
+ *
+ * @param[in] args
+ *          Arguments of the task, other than the tiles, copied into the graph.
+ *
+ * @param[in] size
+ *          Size of the arguments in bytes.
+ *
+ * @param[in] num_tiles
+ *          Number of tiles accessed by the task.
+ *
+ * @param[in] tiles
+ *          Addresses of the tiles, which must be tiles of the captured
+ *          descriptors.
+ *
+ * @param[in] write
+ *          Nonzero for each tile written by the task.
+ *
+ */
+void plasma_graph_record(plasma_graph_kernel_t kernel,
+                         const void *args, size_t size,
+                         int num_tiles, const void *const *tiles,
+                         const int *write)
+{
+    if (capture.failed)
+        return;
+
+    plasma_graph_t *graph = capture.graph;
+    int id = graph->num_nodes;
+
+    if (plasma_graph_grow((void**)&graph->node, &capture.max_nodes,
+                          graph->num_nodes,
+                          sizeof(plasma_graph_node_t)) != PlasmaSuccess) {
+        capture.failed = 1;
+        return;
+    }
+    size_t offset = (graph->args_size+PLASMA_GRAPH_ALIGNMENT-1)/
+                    PLASMA_GRAPH_ALIGNMENT*PLASMA_GRAPH_ALIGNMENT;
+    if (offset+size > capture.max_args) {
+        size_t max_args = 2*capture.max_args;
+        if (max_args < offset+size)
+            max_args = offset+size;
+        char *new_args = (char*)realloc(graph->args, max_args);
+        if (new_args == NULL) {
+            capture.failed = 1;
+            return;
+        }
+        graph->args = new_args;
+        capture.max_args = max_args;
+    }
+    memcpy(&graph->args[offset], args, size);
+    graph->args_size = offset+size;
+
+    plasma_graph_node_t *node = &graph->node[id];
+    node->kernel = kernel;
+    node->args = offset;
+    node->tiles = graph->num_tiles;
+    node->num_tiles = num_tiles;
+    graph->num_nodes++;
+
+    for (int i = 0; i < num_tiles; i++) {
+        plasma_graph_entry_t key;
+        key.addr = tiles[i];
+        plasma_graph_entry_t *entry = (plasma_graph_entry_t*)bsearch(
+            &key, capture.entry, capture.num_entries,
+            sizeof(plasma_graph_entry_t), plasma_graph_compare_entry);
+        if (entry == NULL ||
+            plasma_graph_grow((void**)&graph->tile, &capture.max_tiles,
+                              graph->num_tiles,
+                              sizeof(plasma_graph_tile_t)) != PlasmaSuccess) {
+            capture.failed = 1;
+            return;
+        }
+        graph->tile[graph->num_tiles++] = entry->tile;
+
+        // Read after write, write after write.
+        if (entry->writer >= 0)
+            plasma_graph_add_edge(entry->writer, id);
+
+        if (write[i]) {
+            // Write after read.
+            for (int r = entry->readers; r >= 0; r = capture.reader[r].next)
+                plasma_graph_add_edge(capture.reader[r].task, id);
+            entry->readers = -1;
+            entry->writer = id;
+        }
+        else {
+            int r = capture.num_readers;
+            if (plasma_graph_grow((void**)&capture.reader,
+                                  &capture.max_readers, r,
+                                  sizeof(plasma_graph_reader_t))
+                != PlasmaSuccess) {
+                capture.failed = 1;
+                return;
+            }
+            capture.reader[r].task = id;
+            capture.reader[r].next = entry->readers;
+            entry->readers = r;
+            capture.num_readers++;
+        }
+    }
+}
+
+/***************************************************************************//**
+ *
+ *  Starts capturing the tasks submitted by the calling thread.
+ *  Only the tiles of the given descriptors can be accessed by the tasks,
+ *  otherwise the capture fails.
+ *
+ * @param[in] desc
+ *          Descriptors of the matrices accessed by the tasks.
+ *
+ * @param[in] num_desc
+ *          Number of descriptors.
+ *
+ */
+void plasma_graph_capture_begin(const plasma_desc_t *desc, int num_desc)
+{
+    memset(&capture, 0, sizeof(capture));
+    capturing = 1;
+
+    capture.graph = (plasma_graph_t*)calloc(1, sizeof(plasma_graph_t));
+    if (capture.graph == NULL) {
+        capture.failed = 1;
+        return;
+    }
+
+    size_t num_entries = 0;
+    for (int d = 0; d < num_desc; d++)
+        num_entries += (size_t)desc[d].mt*desc[d].nt;
+
+    capture.entry = (plasma_graph_entry_t*)malloc(
+        (num_entries+1)*sizeof(plasma_graph_entry_t));
+    if (capture.entry == NULL) {
+        capture.failed = 1;
+        return;
+    }
+
+    for (int d = 0; d < num_desc; d++) {
+        plasma_desc_t A = desc[d];
+        if (A.type == PlasmaGeneralBand) {
+            capture.failed = 1;
+            return;
+        }
+        for (int n = 0; n < A.nt; n++) {
+            for (int m = 0; m < A.mt; m++) {
+                if ((A.type == PlasmaLower && m < n) ||
+                    (A.type == PlasmaUpper && m > n))
+                    continue;
+
+                plasma_graph_entry_t *entry =
+                    &capture.entry[capture.num_entries++];
+                entry->addr = plasma_tile_addr(A, m, n);
+                entry->tile.desc = d;
+                entry->tile.m = m;
+                entry->tile.n = n;
+                entry->writer = -1;
+                entry->readers = -1;
+            }
+        }
+    }
+    qsort(capture.entry, capture.num_entries, sizeof(plasma_graph_entry_t),
+          plasma_graph_compare_entry);
+
+    // Tiles sharing an address are not told apart.
+    for (int i = 1; i < capture.num_entries; i++) {
+        if (capture.entry[i].addr == capture.entry[i-1].addr) {
+            capture.failed = 1;
+            return;
+        }
+    }
+}
+
+/***************************************************************************//**
+ *
+ *  Ends the capture, resolves the dependencies of the recorded tasks
+ *  and inserts the graph in the cache.
+ *
+ * @param[in,out] cache
+ *          List of recorded graphs.
+ *
+ * @param[in] name
+ *          Name of the captured routine.
+ *
+ * @param[in] key
+ *          Shape and parameters of the call, compared bytewise.
+ *
+ * @param[in] size
+ *          Size of the key in bytes.
+ *
+ * @retval The recorded graph, or NULL if the tasks could not be recorded,
+ *         in which case none of them was executed.
+ *
+ */
+plasma_graph_t *plasma_graph_capture_end(plasma_graph_t **cache,
+                                         const char *name,
+                                         const void *key, size_t size)
+{
+    plasma_graph_t *graph = capture.graph;
+    capturing = 0;
+
+    if (!capture.failed) {
+        // Remove duplicate dependencies.
+        qsort(capture.edge, capture.num_edges, sizeof(plasma_graph_edge_t),
+              plasma_graph_compare_edge);
+        int num_edges = 0;
+        for (int i = 0; i < capture.num_edges; i++) {
+            if (num_edges == 0 ||
+                plasma_graph_compare_edge(&capture.edge[i],
+                                          &capture.edge[num_edges-1]) != 0)
+                capture.edge[num_edges++] = capture.edge[i];
+        }
+        capture.num_edges = num_edges;
+
+        graph->succ = (int*)malloc((num_edges+1)*sizeof(int));
+        graph->name = (char*)malloc(strlen(name)+1);
+        graph->key = malloc(size+1);
+        if (graph->succ == NULL || graph->name == NULL || graph->key == NULL)
+            capture.failed = 1;
+    }
+    if (capture.failed) {
+        if (graph != NULL)
+            plasma_graph_destroy(graph);
+        graph = NULL;
+    }
+    else {
+        for (int i = 0; i < graph->num_nodes; i++) {
+            graph->node[i].num_succ = 0;
+            graph->node[i].num_pred = 0;
+        }
+        // The edges are sorted by their origins.
+        for (int i = 0; i < capture.num_edges; i++) {
+            plasma_graph_node_t *from = &graph->node[capture.edge[i].from];
+            if (from->num_succ == 0)
+                from->succ = i;
+            from->num_succ++;
+            graph->node[capture.edge[i].to].num_pred++;
+            graph->succ[i] = capture.edge[i].to;
+        }
+
+        strcpy(graph->name, name);
+        memcpy(graph->key, key, size);
+        graph->key_size = size;
+        graph->next = *cache;
+        *cache = graph;
+    }
+
+    free(capture.entry);
+    free(capture.reader);
+    free(capture.edge);
+    memset(&capture, 0, sizeof(capture));
+    return graph;
+}
+
+/***************************************************************************//**
+ *
+ *  Returns the graph recorded for a routine with the given key,
+ *  or NULL if there is none.
+ *
+ */
+plasma_graph_t *plasma_graph_find(plasma_graph_t *cache, const char *name,
+                                  const void *key, size_t size)
+{
+    for (plasma_graph_t *graph = cache; graph != NULL; graph = graph->next) {
+        if (graph->key_size == size &&
+            strcmp(graph->name, name) == 0 &&
+            memcmp(graph->key, key, size) == 0)
+            return graph;
+    }
+    return NULL;
+}
+
+/******************************************************************************/
+typedef struct {
+    plasma_graph_t *graph;
+    void **tiles;          ///< addresses of the tile operands
+    int *count;            ///< number of unfinished predecessors of each task
+    plasma_sequence_t *sequence;
+    plasma_request_t *request;
+} plasma_graph_replay_t;
+
+/******************************************************************************/
+// Executes a task, then its successors made ready, one of them in place.
+static void plasma_graph_run(plasma_graph_replay_t *replay, int id)
+{
+    plasma_graph_t *graph = replay->graph;
+    while (id >= 0) {
+        plasma_graph_node_t *node = &graph->node[id];
+        if (replay->sequence->status == PlasmaSuccess)
+            node->kernel(&graph->args[node->args],
+                         &replay->tiles[node->tiles],
+                         replay->sequence, replay->request);
+
+        int next = -1;
+        for (int i = node->succ; i < node->succ+node->num_succ; i++) {
+            int succ = graph->succ[i];
+            int count;
+            #pragma omp atomic capture
+            count = --replay->count[succ];
+            if (count == 0) {
+                if (next >= 0) {
+                    int ready = next;
+                    #pragma omp task firstprivate(ready)
+                    plasma_graph_run(replay, ready);
+                }
+                next = succ;
+            }
+        }
+        id = next;
+    }
+}
+
+/***************************************************************************//**
+ *
+ *  Executes a recorded graph on the tiles of the given descriptors,
+ *  which have the shapes of the captured ones.
+ *  The tasks are submitted without dependencies, as soon as their
+ *  predecessors have completed, and are waited for before returning.
+ *  Also waits for the tasks previously submitted by the calling task,
+ *  which the recorded tasks do not depend on.
+ *
+ */
+void plasma_graph_replay(plasma_graph_t *graph, const plasma_desc_t *desc,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request)
+{
+    void **tiles = (void**)malloc(imax(graph->num_tiles, 1)*sizeof(void*));
+    int *count = (int*)malloc(imax(graph->num_nodes, 1)*sizeof(int));
+    if (tiles == NULL || count == NULL) {
+        free(tiles);
+        free(count);
+        plasma_request_fail(sequence, request, PlasmaErrorOutOfMemory);
+        return;
+    }
+    for (int i = 0; i < graph->num_tiles; i++) {
+        plasma_graph_tile_t *tile = &graph->tile[i];
+        tiles[i] = plasma_tile_addr(desc[tile->desc], tile->m, tile->n);
+    }
+    for (int i = 0; i < graph->num_nodes; i++)
+        count[i] = graph->node[i].num_pred;
+
+    plasma_graph_replay_t replay = {
+        graph, tiles, count, sequence, request
+    };
+    plasma_graph_replay_t *r = &replay;
+
+    #pragma omp taskwait
+    #pragma omp taskgroup
+    {
+        for (int i = 0; i < graph->num_nodes; i++) {
+            if (graph->node[i].num_pred == 0) {
+                #pragma omp task firstprivate(i)
+                plasma_graph_run(r, i);
+            }
+        }
+    }
+
+    free(tiles);
+    free(count);
+}
+
+/***************************************************************************//**
+ *
+ *  Frees all the graphs of a cache.
+ *
+ */
+void plasma_graph_cache_clear(plasma_graph_t **cache)
+{
+    plasma_graph_t *graph = *cache;
+    while (graph != NULL) {
+        plasma_graph_t *next = graph->next;
+        plasma_graph_destroy(graph);
+        graph = next;
+    }
+    *cache = NULL;
+}
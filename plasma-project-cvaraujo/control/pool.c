@@ -0,0 +1,455 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+// mmap() flags and madvise() are not in C99.
+#define _GNU_SOURCE
+
+#include "plasma_pool.h"
+#include "plasma_context.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+/******************************************************************************/
+// Header preceding each block of pooled memory.
+typedef struct plasma_pool_block_s {
+    struct plasma_pool_block_s *next; ///< next free block of the same class
+    size_t size;                      ///< usable size in bytes
+    int size_class;                   ///< size class, -1 if not pooled
+    int huge_pages;                   ///< PlasmaHugePages when allocated
+    void *base;                       ///< mapping of a huge page block
+    size_t extent;                    ///< length of the mapping
+} plasma_pool_block_t;
+
+/***************************************************************************//**
+ *
+ *  Returns the size in bytes of the size class c.
+ *
+ */
+static size_t plasma_pool_class_size(int c)
+{
+    int shift = PLASMA_POOL_MIN_SHIFT + c/PLASMA_POOL_STEPS;
+    int step = c%PLASMA_POOL_STEPS;
+    return ((size_t)1 << shift) + step*(((size_t)1 << shift)/PLASMA_POOL_STEPS);
+}
+
+/***************************************************************************//**
+ *
+ *  Returns the smallest size class holding size bytes,
+ *  or -1 if size exceeds the largest class.
+ *
+ */
+static int plasma_pool_class(size_t size)
+{
+    if (size <= ((size_t)1 << PLASMA_POOL_MIN_SHIFT))
+        return 0;
+
+    // Find the power of two below size, then the step above it.
+    int shift = 0;
+    while (((size-1) >> (shift+1)) != 0)
+        shift++;
+    size_t base = (size_t)1 << shift;
+    size_t step_size = base/PLASMA_POOL_STEPS;
+    size_t step = (size-base + step_size-1)/step_size;
+
+    int c = (shift-PLASMA_POOL_MIN_SHIFT)*PLASMA_POOL_STEPS + (int)step;
+    if (c >= PLASMA_POOL_NUM_CLASSES)
+        return -1;
+    return c;
+}
+
+/******************************************************************************/
+static plasma_pool_block_t *plasma_pool_block(void *ptr)
+{
+    return (plasma_pool_block_t*)((char*)ptr - PLASMA_POOL_ALIGNMENT);
+}
+
+/******************************************************************************/
+static void plasma_pool_account(plasma_pool_t *pool)
+{
+    size_t held = pool->stats.bytes_in_use + pool->stats.bytes_cached;
+    if (held > pool->stats.peak_bytes)
+        pool->stats.peak_bytes = held;
+}
+
+/***************************************************************************//**
+ *
+ *  Returns the kind of pages backing a block of the given size.
+ *
+ */
+static int plasma_pool_pages(plasma_pool_t *pool, size_t bytes)
+{
+    if (bytes < PLASMA_POOL_HUGE_PAGE_SIZE)
+        return PlasmaHugePagesNone;
+    return pool->huge_pages;
+}
+
+/***************************************************************************//**
+ *
+ *  Maps a block of bytes backed by huge pages.
+ *  The usable memory starts on a huge page boundary, with the header
+ *  on a small page in front of it. Explicit huge pages come from
+ *  the hugetlbfs pool, and transparent ones are used if it is empty.
+ *
+ */
+static plasma_pool_block_t *plasma_pool_block_map(size_t bytes, int huge_pages)
+{
+    size_t page = PLASMA_POOL_HUGE_PAGE_SIZE;
+    size_t mapped = (bytes+page-1)/page*page;
+    char *base = (char*)MAP_FAILED;
+    char *ptr = NULL;
+    size_t extent = 0;
+
+#if defined(MAP_HUGETLB) && defined(MAP_FIXED_NOREPLACE)
+    if (huge_pages == PlasmaHugePagesExplicit) {
+        ptr = (char*)mmap(NULL, mapped, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (ptr != (char*)MAP_FAILED) {
+            // Map the page of the header right below.
+            size_t small = (size_t)sysconf(_SC_PAGESIZE);
+            base = (char*)mmap(ptr-small, small, PROT_READ | PROT_WRITE,
+                               MAP_PRIVATE | MAP_ANONYMOUS |
+                               MAP_FIXED_NOREPLACE, -1, 0);
+            if (base != ptr-small) {
+                if (base != (char*)MAP_FAILED)
+                    munmap(base, small);
+                munmap(ptr, mapped);
+                base = (char*)MAP_FAILED;
+            }
+            extent = small + mapped;
+        }
+    }
+#endif
+    if (base == (char*)MAP_FAILED) {
+        // Align the block inside a larger mapping of small pages.
+        extent = mapped + 2*page;
+        base = (char*)mmap(NULL, extent, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base == (char*)MAP_FAILED)
+            return NULL;
+
+        uintptr_t addr = (uintptr_t)base + PLASMA_POOL_ALIGNMENT;
+        ptr = (char*)((addr+page-1)/page*page);
+#ifdef MADV_HUGEPAGE
+        madvise(ptr, mapped, MADV_HUGEPAGE);
+#endif
+    }
+
+    plasma_pool_block_t *block =
+        (plasma_pool_block_t*)(ptr - PLASMA_POOL_ALIGNMENT);
+    block->base = base;
+    block->extent = extent;
+    return block;
+}
+
+/***************************************************************************//**
+ *
+ *  Allocates a block of the given size class, or of the given size
+ *  if c is -1, from the system.
+ *
+ */
+static plasma_pool_block_t *plasma_pool_block_alloc(int c, size_t size,
+                                                    int huge_pages)
+{
+    size_t bytes = c >= 0 ? plasma_pool_class_size(c) : size;
+    plasma_pool_block_t *block;
+    if (huge_pages != PlasmaHugePagesNone) {
+        block = plasma_pool_block_map(bytes, huge_pages);
+        if (block == NULL)
+            return NULL;
+    }
+    else {
+        void *mem;
+        if (posix_memalign(&mem, PLASMA_POOL_ALIGNMENT,
+                           PLASMA_POOL_ALIGNMENT+bytes) != 0) {
+            return NULL;
+        }
+        block = (plasma_pool_block_t*)mem;
+        block->base = NULL;
+        block->extent = 0;
+    }
+    block->next = NULL;
+    block->size = bytes;
+    block->size_class = c;
+    block->huge_pages = huge_pages;
+    return block;
+}
+
+/******************************************************************************/
+static void plasma_pool_block_free(plasma_pool_block_t *block)
+{
+    if (block->base != NULL)
+        munmap(block->base, block->extent);
+    else
+        free(block);
+}
+
+/******************************************************************************/
+void plasma_pool_init(plasma_pool_t *pool)
+{
+    assert(sizeof(plasma_pool_block_t) <= PLASMA_POOL_ALIGNMENT);
+    for (int c = 0; c < PLASMA_POOL_NUM_CLASSES; c++)
+        pool->free[c] = NULL;
+    memset(&pool->stats, 0, sizeof(plasma_pool_stats_t));
+    pool->huge_pages = PlasmaHugePagesNone;
+    pthread_mutex_init(&pool->lock, NULL);
+}
+
+/***************************************************************************//**
+ *
+ *  Returns the cached blocks to the system.
+ *  Blocks still in use are not tracked and must be released before.
+ *
+ */
+void plasma_pool_finalize(plasma_pool_t *pool)
+{
+    plasma_pool_release_all(pool);
+    pthread_mutex_destroy(&pool->lock);
+}
+
+/******************************************************************************/
+void plasma_pool_release_all(plasma_pool_t *pool)
+{
+    pthread_mutex_lock(&pool->lock);
+    for (int c = 0; c < PLASMA_POOL_NUM_CLASSES; c++) {
+        plasma_pool_block_t *block = (plasma_pool_block_t*)pool->free[c];
+        while (block != NULL) {
+            plasma_pool_block_t *next = block->next;
+            pool->stats.bytes_cached -= block->size;
+            plasma_pool_block_free(block);
+            block = next;
+        }
+        pool->free[c] = NULL;
+    }
+    pthread_mutex_unlock(&pool->lock);
+}
+
+/***************************************************************************//**
+ *
+ *  Returns a block of at least size bytes, aligned to PLASMA_POOL_ALIGNMENT.
+ *  Reuses a cached block of the same size class if there is one.
+ *  Returns NULL if the allocation fails.
+ *
+ */
+void *plasma_pool_malloc(plasma_pool_t *pool, size_t size)
+{
+    int c = plasma_pool_class(size);
+
+    pthread_mutex_lock(&pool->lock);
+    int huge_pages =
+        plasma_pool_pages(pool, c >= 0 ? plasma_pool_class_size(c) : size);
+    if (c >= 0 && pool->free[c] != NULL) {
+        plasma_pool_block_t *block = (plasma_pool_block_t*)pool->free[c];
+        pool->free[c] = block->next;
+        pool->stats.hits++;
+        pool->stats.bytes_cached -= block->size;
+        pool->stats.bytes_in_use += block->size;
+        pthread_mutex_unlock(&pool->lock);
+        return (char*)block + PLASMA_POOL_ALIGNMENT;
+    }
+    pool->stats.misses++;
+    pthread_mutex_unlock(&pool->lock);
+
+    plasma_pool_block_t *block = plasma_pool_block_alloc(c, size, huge_pages);
+    if (block == NULL)
+        return NULL;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->stats.bytes_in_use += block->size;
+    plasma_pool_account(pool);
+    pthread_mutex_unlock(&pool->lock);
+    return (char*)block + PLASMA_POOL_ALIGNMENT;
+}
+
+/******************************************************************************/
+void *plasma_pool_calloc(plasma_pool_t *pool, size_t size)
+{
+    void *ptr = plasma_pool_malloc(pool, size);
+    if (ptr != NULL)
+        memset(ptr, 0, size);
+    return ptr;
+}
+
+/***************************************************************************//**
+ *
+ *  Returns newly allocated memory, never a cached block, so that its pages
+ *  are placed by the first touch. The block goes back to the system
+ *  when freed.
+ *
+ */
+void *plasma_pool_malloc_fresh(plasma_pool_t *pool, size_t size)
+{
+    pthread_mutex_lock(&pool->lock);
+    int huge_pages = plasma_pool_pages(pool, size);
+    pthread_mutex_unlock(&pool->lock);
+
+    plasma_pool_block_t *block = plasma_pool_block_alloc(-1, size, huge_pages);
+    if (block == NULL)
+        return NULL;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->stats.misses++;
+    pool->stats.bytes_in_use += block->size;
+    plasma_pool_account(pool);
+    pthread_mutex_unlock(&pool->lock);
+    return (char*)block + PLASMA_POOL_ALIGNMENT;
+}
+
+/***************************************************************************//**
+ *
+ *  Returns a block obtained from plasma_pool_malloc() to the pool.
+ *  Blocks larger than the largest size class, and blocks backed by pages
+ *  other than the pool currently uses, go back to the system.
+ *
+ */
+void plasma_pool_free(plasma_pool_t *pool, void *ptr)
+{
+    if (ptr == NULL)
+        return;
+
+    plasma_pool_block_t *block = plasma_pool_block(ptr);
+
+    pthread_mutex_lock(&pool->lock);
+    pool->stats.bytes_in_use -= block->size;
+    if (block->size_class < 0 ||
+        block->huge_pages != plasma_pool_pages(pool, block->size)) {
+        pthread_mutex_unlock(&pool->lock);
+        plasma_pool_block_free(block);
+        return;
+    }
+    block->next = (plasma_pool_block_t*)pool->free[block->size_class];
+    pool->free[block->size_class] = block;
+    pool->stats.bytes_cached += block->size;
+    pthread_mutex_unlock(&pool->lock);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_pool
+ *
+ *  Pre-allocates count blocks of at least size bytes in the memory pool
+ *  of the calling thread's PLASMA context, so that subsequent calls
+ *  with matrices or workspaces of that size do not allocate memory.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ *
+ ******************************************************************************/
+int plasma_pool_reserve(size_t size, int count)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    if (count < 0) {
+        plasma_error("illegal value of count");
+        return PlasmaErrorIllegalValue;
+    }
+    int c = plasma_pool_class(size);
+    if (c < 0) {
+        plasma_error("size exceeds the largest pool size class");
+        return PlasmaErrorIllegalValue;
+    }
+    plasma_pool_t *pool = &plasma->pool;
+    pthread_mutex_lock(&pool->lock);
+    int huge_pages = plasma_pool_pages(pool, plasma_pool_class_size(c));
+    pthread_mutex_unlock(&pool->lock);
+
+    for (int i = 0; i < count; i++) {
+        plasma_pool_block_t *block = plasma_pool_block_alloc(c, size,
+                                                             huge_pages);
+        if (block == NULL) {
+            plasma_error("memory allocation failed");
+            return PlasmaErrorOutOfMemory;
+        }
+        pthread_mutex_lock(&pool->lock);
+        block->next = (plasma_pool_block_t*)pool->free[c];
+        pool->free[c] = block;
+        pool->stats.bytes_cached += block->size;
+        plasma_pool_account(pool);
+        pthread_mutex_unlock(&pool->lock);
+    }
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_pool
+ *
+ *  Returns the memory cached in the pool of the calling thread's
+ *  PLASMA context to the system.
+ *
+ ******************************************************************************/
+int plasma_pool_release()
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    plasma_pool_release_all(&plasma->pool);
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_pool
+ *
+ *  Returns the statistics of the memory pool of the calling thread's
+ *  PLASMA context.
+ *
+ ******************************************************************************/
+int plasma_pool_stats(plasma_pool_stats_t *stats)
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    if (stats == NULL) {
+        plasma_error("NULL stats");
+        return PlasmaErrorNullParameter;
+    }
+    pthread_mutex_lock(&plasma->pool.lock);
+    *stats = plasma->pool.stats;
+    pthread_mutex_unlock(&plasma->pool.lock);
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_pool
+ *
+ *  Resets the hit and miss counters, and the peak to the current usage.
+ *
+ ******************************************************************************/
+int plasma_pool_stats_reset()
+{
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
+    pthread_mutex_lock(&plasma->pool.lock);
+    plasma->pool.stats.hits = 0;
+    plasma->pool.stats.misses = 0;
+    plasma->pool.stats.peak_bytes = plasma->pool.stats.bytes_in_use +
+                                    plasma->pool.stats.bytes_cached;
+    pthread_mutex_unlock(&plasma->pool.lock);
+    return PlasmaSuccess;
+}
@@ -0,0 +1,50 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include <plasma_core_blas.h>
+
+// Priority of the tasks inserted by the calling thread.
+static __thread int task_priority = 0;
+
+/***************************************************************************//**
+ *
+ *  Sets the priority of the tasks subsequently inserted by the calling thread
+ *  through the plasma_core_omp_ wrappers honoring it.
+ *  Used by the factorizations with lookahead to favor the tasks leading to
+ *  the next panels. Priorities only take effect with OMP_MAX_TASK_PRIORITY
+ *  set above zero.
+ *
+ */
+void plasma_task_priority_set(int priority)
+{
+    task_priority = priority;
+}
+
+/***************************************************************************//**
+ *
+ *  Returns the priority of the tasks inserted by the calling thread.
+ *
+ */
+int plasma_task_priority()
+{
+    return task_priority;
+}
+
+/***************************************************************************//**
+ *
+ *  Returns the priority of the nested tasks splitting a critical-path kernel,
+ *  e.g., the getrf panel. It is above the priorities set through
+ *  plasma_task_priority_set(), as the next steps wait for the kernel.
+ *
+ */
+int plasma_task_priority_nested()
+{
+    return 2;
+}
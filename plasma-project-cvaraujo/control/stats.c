@@ -0,0 +1,219 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_stats.h"
+#include "plasma_error.h"
+#include "plasma_trace.h"
+
+#include <omp.h>
+#include <stdlib.h>
+#include <string.h>
+
+/******************************************************************************/
+// Counters of one thread, only updated by that thread.
+// A slot belongs to the epoch it was last updated in, older counts are
+// discarded by the owner at its next update. The slots are never freed,
+// so that the counts of finished threads are kept.
+typedef struct plasma_stats_slot_s {
+    plasma_stats_t kernel[PlasmaStatsNumKernels];
+    unsigned long epoch;
+    struct plasma_stats_slot_s *next;
+} plasma_stats_slot_t;
+
+static plasma_stats_slot_t *slots = NULL;
+static unsigned long epoch = 0;
+static __thread plasma_stats_slot_t *self = NULL;
+
+/******************************************************************************/
+static inline double load_double(const double *ptr)
+{
+    double value;
+    __atomic_load(ptr, &value, __ATOMIC_RELAXED);
+    return value;
+}
+
+/******************************************************************************/
+static inline void store_double(double *ptr, double value)
+{
+    __atomic_store(ptr, &value, __ATOMIC_RELAXED);
+}
+
+/***************************************************************************//**
+ *
+ *  Returns the slot of the calling thread, or NULL if out of memory.
+ *
+ */
+static plasma_stats_slot_t *plasma_stats_slot()
+{
+    if (self != NULL)
+        return self;
+
+    plasma_stats_slot_t *slot =
+        (plasma_stats_slot_t*)calloc(1, sizeof(plasma_stats_slot_t));
+    if (slot == NULL)
+        return NULL;
+
+    slot->epoch = __atomic_load_n(&epoch, __ATOMIC_ACQUIRE);
+    slot->next = __atomic_load_n(&slots, __ATOMIC_RELAXED);
+    while (!__atomic_compare_exchange_n(&slots, &slot->next, slot, 1,
+                                        __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+        ;
+    self = slot;
+    return slot;
+}
+
+/***************************************************************************//**
+ *
+ *  Returns the start time of a kernel call, to be passed to
+ *  plasma_stats_stop().
+ *
+ */
+plasma_time_t plasma_stats_start()
+{
+    return omp_get_wtime();
+}
+
+/***************************************************************************//**
+ *
+ *  Accounts for a kernel call in the counters of the calling thread.
+ *
+ *******************************************************************************
+ *
+ * @param[in] kernel
+ *          The kernel type, one of PlasmaStatsGemm, ..., PlasmaStatsAux.
+ *
+ * @param[in] precision
+ *          The precision of the kernel, PlasmaRealFloat, ...,
+ *          PlasmaComplexDouble.
+ *
+ * @param[in] start
+ *          The value returned by plasma_stats_start() before the call.
+ *
+ * @param[in] flops
+ *          The operation count of the kernel in real arithmetic.
+ *          Multiplied by four for complex precisions.
+ *
+ * @param[in] elements
+ *          The number of matrix elements read plus written.
+ *
+ ******************************************************************************/
+void plasma_stats_stop(plasma_enum_t kernel, plasma_enum_t precision,
+                       plasma_time_t start, double flops, double elements)
+{
+    plasma_time_t stop = omp_get_wtime();
+    double time = stop-start;
+    plasma_trace_record(kernel, precision, start, stop);
+
+    plasma_stats_slot_t *slot = plasma_stats_slot();
+    if (slot == NULL)
+        return;
+
+    unsigned long current = __atomic_load_n(&epoch, __ATOMIC_ACQUIRE);
+    if (slot->epoch != current) {
+        // Invisible to readers until the epoch is updated.
+        for (int i = 0; i < PlasmaStatsNumKernels; i++) {
+            __atomic_store_n(&slot->kernel[i].count, 0, __ATOMIC_RELAXED);
+            store_double(&slot->kernel[i].time, 0.0);
+            store_double(&slot->kernel[i].max_time, 0.0);
+            store_double(&slot->kernel[i].flops, 0.0);
+            store_double(&slot->kernel[i].bytes, 0.0);
+        }
+        __atomic_store_n(&slot->epoch, current, __ATOMIC_RELEASE);
+    }
+
+    int is_complex = precision == PlasmaComplexFloat ||
+                     precision == PlasmaComplexDouble;
+    size_t eltsize;
+    switch (precision) {
+    case PlasmaRealFloat:     eltsize = 4;  break;
+    case PlasmaRealDouble:    eltsize = 8;  break;
+    case PlasmaComplexFloat:  eltsize = 8;  break;
+    case PlasmaComplexDouble: eltsize = 16; break;
+    default:                  eltsize = 0;
+    }
+
+    // Only the owner writes, relaxed accesses suffice.
+    plasma_stats_t *stats = &slot->kernel[kernel];
+    __atomic_store_n(&stats->count, stats->count+1, __ATOMIC_RELAXED);
+    store_double(&stats->time, stats->time+time);
+    if (time > stats->max_time)
+        store_double(&stats->max_time, time);
+    store_double(&stats->flops, stats->flops+(is_complex ? 4.0*flops : flops));
+    store_double(&stats->bytes, stats->bytes+elements*eltsize);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_stats
+ *
+ *  Returns the counters of a kernel type, summed over all threads,
+ *  since the start of the process or the last call to plasma_stats_reset().
+ *  The kernels are counted in the plasma_core_omp_ wrappers, in all
+ *  precisions, whether or not PLASMA is initialized.
+ *  The counters are read without stopping running kernels, hence they are
+ *  only consistent when no PLASMA routine is running.
+ *
+ *******************************************************************************
+ *
+ * @param[in] kernel
+ *          The kernel type, one of PlasmaStatsGemm, ..., PlasmaStatsAux.
+ *
+ * @param[out] stats
+ *          The counters of the kernel type.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ *
+ ******************************************************************************/
+int plasma_stats_get(plasma_enum_t kernel, plasma_stats_t *stats)
+{
+    if (kernel < 0 || kernel >= PlasmaStatsNumKernels) {
+        plasma_error("illegal value of kernel");
+        return PlasmaErrorIllegalValue;
+    }
+    if (stats == NULL) {
+        plasma_error("NULL stats");
+        return PlasmaErrorNullParameter;
+    }
+
+    memset(stats, 0, sizeof(plasma_stats_t));
+    unsigned long current = __atomic_load_n(&epoch, __ATOMIC_ACQUIRE);
+    for (plasma_stats_slot_t *slot = __atomic_load_n(&slots, __ATOMIC_ACQUIRE);
+         slot != NULL;
+         slot = slot->next) {
+
+        if (__atomic_load_n(&slot->epoch, __ATOMIC_ACQUIRE) != current)
+            continue;
+
+        plasma_stats_t *counters = &slot->kernel[kernel];
+        stats->count += __atomic_load_n(&counters->count, __ATOMIC_RELAXED);
+        stats->time += load_double(&counters->time);
+        double max_time = load_double(&counters->max_time);
+        if (max_time > stats->max_time)
+            stats->max_time = max_time;
+        stats->flops += load_double(&counters->flops);
+        stats->bytes += load_double(&counters->bytes);
+    }
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup plasma_stats
+ *
+ *  Resets the counters of all kernel types.
+ *  Kernels running during the reset may be counted either way.
+ *
+ ******************************************************************************/
+void plasma_stats_reset()
+{
+    __atomic_add_fetch(&epoch, 1, __ATOMIC_ACQ_REL);
+}
@@ -0,0 +1,333 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_tile_cache.h"
+#include "plasma_error.h"
+
+#include <omp.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/******************************************************************************/
+// Bit of the host in the masks of devices; devices 0 to 62 have their bits.
+#define PLASMA_TILE_CACHE_HOST (1UL << 63)
+#define PLASMA_TILE_CACHE_MAX_DEVICES 63
+
+// Maximum nesting of the scopes.
+#define PLASMA_TILE_CACHE_MAX_DEPTH 64
+
+/******************************************************************************/
+typedef struct {
+    char *tile;            ///< address of the tile, NULL if the slot is free
+    size_t size;           ///< bytes mapped, 0 if not mapped yet
+    int home;              ///< device owning the tile, or -1
+    unsigned long valid;   ///< mask of the host and devices with a valid copy
+    unsigned long present; ///< mask of the devices the tile is mapped on
+} plasma_tile_cache_entry_t;
+
+// The tiles are tracked by the thread submitting the tasks, as the
+// dependencies of the data transfers are only resolved between its tasks.
+// Another thread, e.g., a worker submitting tasks from within a task,
+// sees no scope, see plasma_tile_cache.h.
+static __thread int depth = 0;
+static __thread int resident_depth = 0;
+static __thread unsigned long resident_scopes = 0;
+static __thread plasma_tile_cache_entry_t *entry = NULL;
+static __thread size_t num_entries = 0;
+static __thread size_t max_entries = 0;
+static __thread int next_device = 0;
+
+/******************************************************************************/
+static size_t plasma_tile_cache_hash(const void *tile)
+{
+    // Tiles are at least cache-line aligned.
+    return (size_t)(((uintptr_t)tile >> 6)*0x9E3779B97F4A7C15ULL);
+}
+
+/******************************************************************************/
+// Returns the entry of a tile, or NULL if not tracked.
+static plasma_tile_cache_entry_t *plasma_tile_cache_lookup(const void *tile)
+{
+    if (max_entries == 0)
+        return NULL;
+
+    size_t i = plasma_tile_cache_hash(tile) & (max_entries-1);
+    while (entry[i].tile != NULL) {
+        if (entry[i].tile == tile)
+            return &entry[i];
+        i = (i+1) & (max_entries-1);
+    }
+    return NULL;
+}
+
+/***************************************************************************//**
+ *
+ *  Returns the entry of a tile, inserting it as valid on the host only
+ *  and without an owner if not tracked yet, or NULL if out of memory.
+ *
+ */
+static plasma_tile_cache_entry_t *plasma_tile_cache_find(const void *tile)
+{
+    // Keep the table at most half full.
+    if (2*(num_entries+1) > max_entries) {
+        size_t max = max_entries == 0 ? 1024 : 2*max_entries;
+        plasma_tile_cache_entry_t *table = (plasma_tile_cache_entry_t*)calloc(
+            max, sizeof(plasma_tile_cache_entry_t));
+        if (table == NULL)
+            return NULL;
+
+        for (size_t i = 0; i < max_entries; i++) {
+            if (entry[i].tile != NULL) {
+                size_t j = plasma_tile_cache_hash(entry[i].tile) & (max-1);
+                while (table[j].tile != NULL)
+                    j = (j+1) & (max-1);
+                table[j] = entry[i];
+            }
+        }
+        free(entry);
+        entry = table;
+        max_entries = max;
+    }
+
+    size_t i = plasma_tile_cache_hash(tile) & (max_entries-1);
+    while (entry[i].tile != NULL && entry[i].tile != tile)
+        i = (i+1) & (max_entries-1);
+
+    if (entry[i].tile == NULL) {
+        entry[i].tile = (char*)tile;
+        entry[i].size = 0;
+        entry[i].home = -1;
+        entry[i].valid = PLASMA_TILE_CACHE_HOST;
+        entry[i].present = 0;
+        num_entries++;
+    }
+    return &entry[i];
+}
+
+/******************************************************************************/
+// Submits the copy of a tile from the host to a device,
+// where it is mapped already if present is nonzero.
+static void plasma_tile_cache_to(char *tile, size_t size, int device,
+                                 int present)
+{
+    if (present) {
+        #pragma omp target update to(tile[0:size]) \
+                                  device(device) \
+                                  depend(in:tile[0:size]) \
+                                  nowait
+    }
+    else {
+        #pragma omp target enter data map(to:tile[0:size]) \
+                                      device(device) \
+                                      depend(in:tile[0:size]) \
+                                      nowait
+    }
+}
+
+/******************************************************************************/
+// Submits the copy of a tile from a device to the host.
+static void plasma_tile_cache_from(char *tile, size_t size, int device)
+{
+    #pragma omp target update from(tile[0:size]) \
+                              device(device) \
+                              depend(inout:tile[0:size]) \
+                              nowait
+}
+
+/***************************************************************************//**
+ *
+ *  Submits the copies of the tiles written on the devices back to the host
+ *  and the unmapping of all the tiles, as tasks depending on the tiles.
+ *
+ */
+static void plasma_tile_cache_flush()
+{
+    for (size_t i = 0; i < max_entries; i++) {
+        char *tile = entry[i].tile;
+        size_t size = entry[i].size;
+        if (tile == NULL)
+            continue;
+
+        for (unsigned long present = entry[i].present;
+             present != 0; present &= present-1) {
+            int device = __builtin_ctzl(present);
+            if (entry[i].valid == 1UL << device) {
+                #pragma omp target exit data map(from:tile[0:size]) \
+                                             device(device) \
+                                             depend(inout:tile[0:size]) \
+                                             nowait
+            }
+            else {
+                #pragma omp target exit data map(release:tile[0:size]) \
+                                             device(device) \
+                                             depend(inout:tile[0:size]) \
+                                             nowait
+            }
+        }
+        entry[i].valid = PLASMA_TILE_CACHE_HOST;
+        entry[i].present = 0;
+    }
+}
+
+/***************************************************************************//**
+ *
+ *  Starts a scope in which the offloaded tasks writing a tile of the num_desc
+ *  descriptors desc run on the device owning it, and, if resident is
+ *  nonzero, the offloaded tiles stay on the devices.
+ *  Scopes nest, the tiles stay on the devices until the end of the outermost
+ *  resident scope.
+ *
+ */
+void plasma_tile_cache_begin(const plasma_desc_t *desc, int num_desc,
+                             int resident)
+{
+    // Scopes nested deeper than the mask of resident scopes only place
+    // the tasks.
+    if (depth < PLASMA_TILE_CACHE_MAX_DEPTH) {
+        if (resident) {
+            resident_scopes |= 1UL << depth;
+            resident_depth++;
+        }
+        else {
+            resident_scopes &= ~(1UL << depth);
+        }
+    }
+    depth++;
+
+    for (int d = 0; d < num_desc; d++) {
+        plasma_desc_t A = desc[d];
+        if (A.dev_p == 0)
+            continue;
+
+        for (int n = 0; n < A.nt; n++) {
+            for (int m = 0; m < A.mt; m++) {
+                plasma_tile_cache_entry_t *e =
+                    plasma_tile_cache_find(plasma_tile_addr(A, m, n));
+                if (e == NULL) {
+                    plasma_error("calloc() failed");
+                    return;
+                }
+                e->home = plasma_tile_device(A, m, n);
+            }
+        }
+    }
+}
+
+/***************************************************************************//**
+ *
+ *  Ends the innermost scope started by plasma_tile_cache_begin().
+ *
+ */
+void plasma_tile_cache_end()
+{
+    if (depth == 0)
+        return;
+
+    depth--;
+    if (depth < PLASMA_TILE_CACHE_MAX_DEPTH &&
+        (resident_scopes & (1UL << depth)) != 0) {
+        if (--resident_depth == 0)
+            plasma_tile_cache_flush();
+    }
+    if (depth == 0) {
+        free(entry);
+        entry = NULL;
+        num_entries = 0;
+        max_entries = 0;
+    }
+}
+
+/***************************************************************************//**
+ *
+ *  Returns the device to run a task writing the tile on: the device owning
+ *  the tile, otherwise in a resident scope a device holding a valid copy
+ *  of the tile, otherwise the next device in a round-robin.
+ *  Outside of the scopes, returns the default device.
+ *
+ */
+int plasma_tile_cache_device(const void *tile)
+{
+    if (depth == 0)
+        return omp_get_default_device();
+
+    int num_devices = omp_get_num_devices();
+    if (num_devices == 0)
+        return omp_get_initial_device();
+    if (num_devices > PLASMA_TILE_CACHE_MAX_DEVICES)
+        num_devices = PLASMA_TILE_CACHE_MAX_DEVICES;
+
+    plasma_tile_cache_entry_t *e = plasma_tile_cache_lookup(tile);
+    if (e != NULL && e->home >= 0)
+        return e->home%num_devices;
+    if (resident_depth == 0)
+        return omp_get_default_device();
+
+    if (e != NULL) {
+        unsigned long devices = e->valid & ~PLASMA_TILE_CACHE_HOST;
+        if (devices != 0)
+            return __builtin_ctzl(devices);
+    }
+    int device = next_device;
+    next_device = (next_device+1) % num_devices;
+    return device;
+}
+
+/***************************************************************************//**
+ *
+ *  Makes the copy of a tile of size bytes on a device valid before a task
+ *  on the device reads it, or before a task on the device writes it if write
+ *  is nonzero. A device of -1, or the initial device, is the host.
+ *  The transfers are submitted as tasks depending on the tile, so the task
+ *  accessing the tile must be submitted next, with the same dependencies.
+ *  Does nothing outside of the resident scopes, where the tasks map their
+ *  tiles themselves.
+ *
+ */
+void plasma_tile_cache_acquire(const void *tile, size_t size,
+                               int device, int write)
+{
+    if (resident_depth == 0)
+        return;
+
+    unsigned long bit;
+    if (device < 0 || device == omp_get_initial_device())
+        bit = PLASMA_TILE_CACHE_HOST;
+    else if (device < PLASMA_TILE_CACHE_MAX_DEVICES)
+        bit = 1UL << device;
+    else
+        return;
+
+    plasma_tile_cache_entry_t *e = plasma_tile_cache_find(tile);
+    if (e == NULL) {
+        // Not tracked, so valid on the host only, where the tasks mapping
+        // the tile copy it back.
+        plasma_error("calloc() failed");
+        return;
+    }
+    if (e->size == 0)
+        e->size = size;
+    if ((e->valid & bit) == 0) {
+        // Copy the tile back to the host from the device that wrote it.
+        if ((e->valid & PLASMA_TILE_CACHE_HOST) == 0) {
+            plasma_tile_cache_from(e->tile, e->size, __builtin_ctzl(e->valid));
+            e->valid |= PLASMA_TILE_CACHE_HOST;
+        }
+        // Copy the tile from the host to the device.
+        if (bit != PLASMA_TILE_CACHE_HOST) {
+            plasma_tile_cache_to(e->tile, e->size, device,
+                                 (e->present & bit) != 0);
+            e->present |= bit;
+            e->valid |= bit;
+        }
+    }
+    if (write)
+        e->valid = bit;
+}
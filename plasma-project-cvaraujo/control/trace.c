@@ -0,0 +1,392 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#define _GNU_SOURCE
+
+#include "plasma_trace.h"
+#include "plasma_error.h"
+#include "plasma_internal.h"
+#include "plasma_stats.h"
+
+#include <omp.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/******************************************************************************/
+// Names of the kernel types, in the order of PlasmaStatsGemm, ...
+static const char *kernel_name[] = {
+    "gemm", "symm", "syrk", "syr2k", "trmm", "trsm", "potrf", "potrf_update",
+    "getrf", "geqrt", "tsqrt", "unmqr", "tsmqr", "trtri", "hegst", "norm",
+    "aux"
+};
+
+/******************************************************************************/
+typedef struct {
+    const void *addr; ///< address of the tile
+    int matrix;       ///< id of the matrix, or -1 if not a known tile
+    int m;            ///< tile row
+    int n;            ///< tile column
+    char mode;        ///< 'r' if only read, 'w' if written
+} plasma_trace_tile_t;
+
+typedef struct {
+    plasma_enum_t kernel;    ///< PlasmaStatsGemm, ...
+    plasma_enum_t precision; ///< PlasmaRealFloat, ...
+    int thread;              ///< OpenMP thread number
+    int num_tiles;           ///< number of tiles accessed
+    plasma_time_t start;     ///< start time
+    plasma_time_t stop;      ///< stop time
+    plasma_trace_tile_t tile[PLASMA_TRACE_MAX_TILES];
+} plasma_trace_event_t;
+
+// Events of one thread, only appended by that thread.
+typedef struct plasma_trace_buffer_s {
+    plasma_trace_event_t *event;
+    int num_events;
+    int max_events;
+    struct plasma_trace_buffer_s *next;
+} plasma_trace_buffer_t;
+
+// Tile addresses of a matrix, sorted for lookup.
+typedef struct {
+    const void *addr;
+    int m;
+    int n;
+} plasma_trace_entry_t;
+
+typedef struct plasma_trace_matrix_s {
+    int id;                       ///< number in the order of creation
+    const void *matrix;           ///< matrix of the descriptor
+    const char *lo;               ///< lowest tile address
+    const char *hi;               ///< highest tile address
+    plasma_trace_entry_t *entry;  ///< tile addresses
+    int num_entries;              ///< number of tiles
+    struct plasma_trace_matrix_s *next;
+} plasma_trace_matrix_t;
+
+static int tracing = 0;
+static plasma_time_t origin;
+static plasma_trace_buffer_t *buffers = NULL;
+static __thread plasma_trace_buffer_t *self = NULL;
+
+// Tiles of the task about to be recorded by the calling thread.
+static __thread plasma_trace_tile_t pending[PLASMA_TRACE_MAX_TILES];
+static __thread int num_pending = 0;
+
+// Matrices created while tracing, newest first.
+static pthread_rwlock_t matrices_lock = PTHREAD_RWLOCK_INITIALIZER;
+static plasma_trace_matrix_t *matrices = NULL;
+static int num_matrices = 0;
+
+/******************************************************************************/
+static int plasma_trace_compare_entry(const void *a, const void *b)
+{
+    const char *x = (const char*)((const plasma_trace_entry_t*)a)->addr;
+    const char *y = (const char*)((const plasma_trace_entry_t*)b)->addr;
+    return (x > y) - (x < y);
+}
+
+/***************************************************************************//**
+ *
+ *  Starts recording the tasks executed by the plasma_core_omp_ wrappers.
+ *  Clears the events of a previous trace.
+ *  The trace is also started by plasma_init() and written by
+ *  plasma_finalize() to the file named by PLASMA_TRACE, if set.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ *
+ ******************************************************************************/
+int plasma_trace_start()
+{
+    for (plasma_trace_buffer_t *buffer =
+             __atomic_load_n(&buffers, __ATOMIC_ACQUIRE);
+         buffer != NULL;
+         buffer = buffer->next) {
+        buffer->num_events = 0;
+    }
+    origin = omp_get_wtime();
+    __atomic_store_n(&tracing, 1, __ATOMIC_RELEASE);
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *
+ *  Records the tiles accessed by the task about to call
+ *  plasma_stats_stop() on the calling thread.
+ *
+ *******************************************************************************
+ *
+ * @param[in] mode
+ *          For each tile, 'r' if the tile is only read, 'w' if written.
+ *
+ * @param[in] tiles
+ *          Array of strlen(mode) tile addresses.
+ *
+ ******************************************************************************/
+void plasma_trace_tiles(const char *mode, const void *const *tiles)
+{
+    if (!__atomic_load_n(&tracing, __ATOMIC_RELAXED))
+        return;
+
+    num_pending = 0;
+    pthread_rwlock_rdlock(&matrices_lock);
+    for (int i = 0; mode[i] != '\0' && i < PLASMA_TRACE_MAX_TILES; i++) {
+        plasma_trace_tile_t *tile = &pending[num_pending++];
+        tile->addr = tiles[i];
+        tile->matrix = -1;
+        tile->mode = mode[i];
+        for (plasma_trace_matrix_t *matrix = matrices;
+             matrix != NULL;
+             matrix = matrix->next) {
+
+            if ((const char*)tiles[i] < matrix->lo ||
+                (const char*)tiles[i] > matrix->hi)
+                continue;
+
+            plasma_trace_entry_t key = {tiles[i], 0, 0};
+            plasma_trace_entry_t *entry =
+                bsearch(&key, matrix->entry, matrix->num_entries,
+                        sizeof(plasma_trace_entry_t),
+                        plasma_trace_compare_entry);
+            if (entry != NULL) {
+                tile->matrix = matrix->id;
+                tile->m = entry->m;
+                tile->n = entry->n;
+                break;
+            }
+        }
+    }
+    pthread_rwlock_unlock(&matrices_lock);
+}
+
+/***************************************************************************//**
+ *
+ *  Records a task with the tiles passed to plasma_trace_tiles().
+ *  Called by plasma_stats_stop().
+ *
+ ******************************************************************************/
+void plasma_trace_record(plasma_enum_t kernel, plasma_enum_t precision,
+                         plasma_time_t start, plasma_time_t stop)
+{
+    if (!__atomic_load_n(&tracing, __ATOMIC_RELAXED)) {
+        num_pending = 0;
+        return;
+    }
+
+    if (self == NULL) {
+        plasma_trace_buffer_t *buffer =
+            (plasma_trace_buffer_t*)calloc(1, sizeof(plasma_trace_buffer_t));
+        if (buffer == NULL)
+            return;
+
+        buffer->next = __atomic_load_n(&buffers, __ATOMIC_RELAXED);
+        while (!__atomic_compare_exchange_n(&buffers, &buffer->next, buffer,
+                                            1, __ATOMIC_RELEASE,
+                                            __ATOMIC_RELAXED))
+            ;
+        self = buffer;
+    }
+    if (self->num_events == self->max_events) {
+        int max_events = imax(2*self->max_events, 1024);
+        plasma_trace_event_t *event = (plasma_trace_event_t*)realloc(
+            self->event, max_events*sizeof(plasma_trace_event_t));
+        if (event == NULL)
+            return;
+
+        self->event = event;
+        self->max_events = max_events;
+    }
+
+    plasma_trace_event_t *event = &self->event[self->num_events++];
+    event->kernel = kernel;
+    event->precision = precision;
+    event->thread = omp_get_thread_num();
+    event->start = start;
+    event->stop = stop;
+    event->num_tiles = num_pending;
+    memcpy(event->tile, pending, num_pending*sizeof(plasma_trace_tile_t));
+    num_pending = 0;
+}
+
+/***************************************************************************//**
+ *
+ *  Registers the tiles of a matrix created while tracing, so that
+ *  the tasks are recorded with tile coordinates instead of addresses.
+ *  Band matrices are not registered.
+ *
+ ******************************************************************************/
+void plasma_trace_desc_create(const plasma_desc_t *A)
+{
+    if (!__atomic_load_n(&tracing, __ATOMIC_RELAXED) ||
+        A->type == PlasmaGeneralBand)
+        return;
+
+    plasma_trace_matrix_t *matrix =
+        (plasma_trace_matrix_t*)malloc(sizeof(plasma_trace_matrix_t));
+    plasma_trace_entry_t *entry = (plasma_trace_entry_t*)malloc(
+        (size_t)A->mt*A->nt*sizeof(plasma_trace_entry_t));
+    if (matrix == NULL || entry == NULL) {
+        free(matrix);
+        free(entry);
+        return;
+    }
+
+    int num_entries = 0;
+    for (int n = 0; n < A->nt; n++) {
+        for (int m = 0; m < A->mt; m++) {
+            if ((A->type == PlasmaLower && m < n) ||
+                (A->type == PlasmaUpper && m > n))
+                continue;
+
+            entry[num_entries].addr = plasma_tile_addr(*A, m, n);
+            entry[num_entries].m = m;
+            entry[num_entries].n = n;
+            num_entries++;
+        }
+    }
+    qsort(entry, num_entries, sizeof(plasma_trace_entry_t),
+          plasma_trace_compare_entry);
+
+    matrix->matrix = A->matrix;
+    matrix->entry = entry;
+    matrix->num_entries = num_entries;
+    matrix->lo = num_entries > 0 ? (const char*)entry[0].addr : NULL;
+    matrix->hi = num_entries > 0 ?
+        (const char*)entry[num_entries-1].addr : NULL;
+
+    pthread_rwlock_wrlock(&matrices_lock);
+    matrix->id = num_matrices++;
+    matrix->next = matrices;
+    matrices = matrix;
+    pthread_rwlock_unlock(&matrices_lock);
+}
+
+/***************************************************************************//**
+ *
+ *  Unregisters a matrix before its memory is released and reused.
+ *
+ ******************************************************************************/
+void plasma_trace_desc_destroy(const plasma_desc_t *A)
+{
+    pthread_rwlock_wrlock(&matrices_lock);
+    for (plasma_trace_matrix_t **matrix = &matrices;
+         *matrix != NULL;
+         matrix = &(*matrix)->next) {
+
+        if ((*matrix)->matrix == A->matrix) {
+            plasma_trace_matrix_t *next = (*matrix)->next;
+            free((*matrix)->entry);
+            free(*matrix);
+            *matrix = next;
+            break;
+        }
+    }
+    pthread_rwlock_unlock(&matrices_lock);
+}
+
+/******************************************************************************/
+static void plasma_trace_write_tile(FILE *file, const plasma_trace_tile_t *tile)
+{
+    if (tile->matrix >= 0)
+        fprintf(file, "\"%c A%d(%d,%d)\"",
+                tile->mode, tile->matrix, tile->m, tile->n);
+    else
+        fprintf(file, "\"%c %p\"", tile->mode, tile->addr);
+}
+
+/***************************************************************************//**
+ *
+ *  Stops recording and writes the trace in the Chrome trace event format,
+ *  viewable in chrome://tracing or Perfetto.
+ *  Each task is a complete event named after its precision and kernel type,
+ *  on the row of the thread that executed it. The arguments list the tiles
+ *  accessed, prefixed by 'r' if only read or 'w' if written, from which
+ *  tools/trace_analysis.py derives the dependencies.
+ *  Must be called when no PLASMA routine is running.
+ *
+ *******************************************************************************
+ *
+ * @param[in] filename
+ *          The name of the file to write.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ *
+ ******************************************************************************/
+int plasma_trace_stop(const char *filename)
+{
+    __atomic_store_n(&tracing, 0, __ATOMIC_RELEASE);
+
+    if (filename == NULL) {
+        plasma_error("NULL filename");
+        return PlasmaErrorNullParameter;
+    }
+    FILE *file = fopen(filename, "w");
+    if (file == NULL) {
+        plasma_error("fopen() failed");
+        return PlasmaErrorEnvironment;
+    }
+
+    int max_thread = -1;
+    const char *separator = "";
+    fprintf(file, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n");
+    for (plasma_trace_buffer_t *buffer =
+             __atomic_load_n(&buffers, __ATOMIC_ACQUIRE);
+         buffer != NULL;
+         buffer = buffer->next) {
+
+        for (int i = 0; i < buffer->num_events; i++) {
+            plasma_trace_event_t *event = &buffer->event[i];
+            char prefix;
+            switch (event->precision) {
+            case PlasmaRealFloat:     prefix = 's'; break;
+            case PlasmaRealDouble:    prefix = 'd'; break;
+            case PlasmaComplexFloat:  prefix = 'c'; break;
+            case PlasmaComplexDouble: prefix = 'z'; break;
+            default:                  prefix = '?';
+            }
+            fprintf(file,
+                    "%s{\"name\": \"%c%s\", \"cat\": \"%s\", \"ph\": \"X\", "
+                    "\"pid\": 0, \"tid\": %d, \"ts\": %.3f, \"dur\": %.3f, "
+                    "\"args\": {\"tiles\": [",
+                    separator, prefix, kernel_name[event->kernel],
+                    kernel_name[event->kernel], event->thread,
+                    (event->start-origin)*1e6,
+                    (event->stop-event->start)*1e6);
+            for (int j = 0; j < event->num_tiles; j++) {
+                if (j > 0)
+                    fprintf(file, ", ");
+                plasma_trace_write_tile(file, &event->tile[j]);
+            }
+            fprintf(file, "]}}");
+            separator = ",\n";
+            max_thread = imax(max_thread, event->thread);
+        }
+        buffer->num_events = 0;
+    }
+    for (int thread = 0; thread <= max_thread; thread++) {
+        fprintf(file,
+                "%s{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 0, "
+                "\"tid\": %d, \"args\": {\"name\": \"thread %d\"}}",
+                separator, thread, thread);
+        separator = ",\n";
+    }
+    fprintf(file, "\n]}\n");
+
+    if (fclose(file) != 0) {
+        plasma_error("fclose() failed");
+        return PlasmaErrorEnvironment;
+    }
+    return PlasmaSuccess;
+}
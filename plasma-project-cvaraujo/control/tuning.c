@@ -14,7 +14,9 @@
 #include "plasma_context.h"
 #include "plasma_types.h"
 
+#include <math.h>
 #include <stdio.h>
+#include <string.h>
 #include <assert.h>
 #include <stdarg.h>
 #include <omp.h>
@@ -25,8 +27,7 @@
 #include <lualib.h>
 
 /******************************************************************************/
-void
-plasma_tuning_init(plasma_context_t *plasma)
+static void plasma_tuning_lua_init(plasma_context_t *plasma)
 {
     // Initiaize Lua.
     lua_State *L = luaL_newstate();
@@ -61,10 +62,11 @@ plasma_tuning_init(plasma_context_t *plasma)
         lua_close(L);
         return;
     }
+    plasma->L = L;
 }
 
 /******************************************************************************/
-void plasma_tuning_finalize(plasma_context_t *plasma)
+static void plasma_tuning_lua_finalize(plasma_context_t *plasma)
 {
     lua_State *L = (lua_State *)plasma->L;
     if (L != NULL)
@@ -80,6 +82,7 @@ static void plasma_tune(plasma_context_t *plasma, plasma_enum_t dtyp,
     retval = lua_getglobal(L, func_name);
     if (retval != LUA_TFUNCTION) {
         plasma_error("lua_getglobal() failed");
+        lua_pop(L, 1);
         return;
     }
     switch (dtyp) {
@@ -101,25 +104,26 @@ static void plasma_tune(plasma_context_t *plasma, plasma_enum_t dtyp,
     retval = lua_pcall(L, 2+count, 1, 0);
     if (retval != LUA_OK) {
         plasma_error("lua_pcall() failed");
+        lua_pop(L, 1);
         return;
     }
-    retval = lua_tonumber(L, -1);
-    if (retval == 0) {
-        plasma_error("lua_tonumber() failed");
+    // Zero is a valid value, e.g., for the lookahead.
+    if (!lua_isnumber(L, -1)) {
+        plasma_error("lua_isnumber() failed");
+        lua_pop(L, 1);
         return;
     }
-    *out = retval;
+    *out = lua_tonumber(L, -1);
     lua_pop(L, 1);
 }
 
 #else
-void
-plasma_tuning_init(plasma_context_t *plasma)
+static void plasma_tuning_lua_init(plasma_context_t *plasma)
 {
     if (plasma) return;
 }
 
-void plasma_tuning_finalize(plasma_context_t *plasma)
+static void plasma_tuning_lua_finalize(plasma_context_t *plasma)
 {
     if (plasma) return;
 }
@@ -139,16 +143,58 @@ static void plasma_tune(plasma_context_t *plasma, plasma_enum_t dtyp,
 }
 #endif
 
+/******************************************************************************/
+void plasma_tuning_init(plasma_context_t *plasma)
+{
+    plasma->L = NULL;
+    plasma->tuning_table = NULL;
+
+    // A tuning file not ending in .lua is a table written by
+    // tools/plasmatune.py, loaded once and usable without Lua.
+    char *config_filename = getenv("PLASMA_TUNING_FILENAME");
+    if (config_filename != NULL) {
+        size_t len = strlen(config_filename);
+        if (len < 4 || strcmp(config_filename+len-4, ".lua") != 0) {
+            plasma->tuning_table = plasma_tuning_table_load(config_filename);
+            return;
+        }
+    }
+    plasma_tuning_lua_init(plasma);
+}
+
+/******************************************************************************/
+void plasma_tuning_finalize(plasma_context_t *plasma)
+{
+    plasma_tuning_table_free(
+        (plasma_tuning_table_t*)plasma->tuning_table);
+    plasma->tuning_table = NULL;
+    plasma_tuning_lua_finalize(plasma);
+}
+
+/******************************************************************************/
+// Sets nb, ib and the panel threads from the tuning table, if loaded with
+// the routine in this precision, and returns nonzero then.
+static int plasma_tune_table(plasma_context_t *plasma, int routine,
+                             plasma_enum_t dtyp, double size)
+{
+    return plasma_tuning_table_lookup(
+        (const plasma_tuning_table_t*)plasma->tuning_table, routine, dtyp,
+        omp_get_max_threads(), size,
+        &plasma->nb, &plasma->ib, &plasma->max_panel_threads);
+}
+
 /******************************************************************************/
 void plasma_tune_gbtrf(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int n, int bw)
 {
+    if (plasma_tune_table(plasma, PlasmaTuneGbtrf, dtyp, n))
+        return;
     if (plasma->L == NULL)
         return;
 
-    plasma_tune(plasma->L, dtyp, "gbtrf_nb", &plasma->nb, 2, n, bw);
-    plasma_tune(plasma->L, dtyp, "gbtrf_ib", &plasma->ib, 2, n, bw);
-    plasma_tune(plasma->L, dtyp, "gbtrf_max_panel_threads",
+    plasma_tune(plasma, dtyp, "gbtrf_nb", &plasma->nb, 2, n, bw);
+    plasma_tune(plasma, dtyp, "gbtrf_ib", &plasma->ib, 2, n, bw);
+    plasma_tune(plasma, dtyp, "gbtrf_max_panel_threads",
                 &plasma->max_panel_threads, 2, n, bw);
 }
 
@@ -156,22 +202,26 @@ void plasma_tune_gbtrf(plasma_context_t *plasma, plasma_enum_t dtyp,
 void plasma_tune_geadd(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int m, int n)
 {
+    if (plasma_tune_table(plasma, PlasmaTuneGeadd, dtyp, sqrt(1.0*m*n)))
+        return;
     if (plasma->L == NULL)
         return;
 
-    plasma_tune(plasma->L, dtyp, "geadd_nb", &plasma->nb, 2, m, n);
+    plasma_tune(plasma, dtyp, "geadd_nb", &plasma->nb, 2, m, n);
 }
 
 /******************************************************************************/
 void plasma_tune_geinv(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int m, int n)
 {
+    if (plasma_tune_table(plasma, PlasmaTuneGeinv, dtyp, sqrt(1.0*m*n)))
+        return;
     if (plasma->L == NULL)
         return;
 
-    plasma_tune(plasma->L, dtyp, "geinv_nb", &plasma->nb, 2, m, n);
-    plasma_tune(plasma->L, dtyp, "geinv_ib", &plasma->ib, 2, m, n);
-    plasma_tune(plasma->L, dtyp, "geinv_max_panel_threads",
+    plasma_tune(plasma, dtyp, "geinv_nb", &plasma->nb, 2, m, n);
+    plasma_tune(plasma, dtyp, "geinv_ib", &plasma->ib, 2, m, n);
+    plasma_tune(plasma, dtyp, "geinv_max_panel_threads",
                 &plasma->max_panel_threads, 2, m, n);
 }
 
@@ -179,243 +229,295 @@ void plasma_tune_geinv(plasma_context_t *plasma, plasma_enum_t dtyp,
 void plasma_tune_gelqf(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int m, int n)
 {
+    if (plasma_tune_table(plasma, PlasmaTuneGelqf, dtyp, sqrt(1.0*m*n)))
+        return;
     if (plasma->L == NULL)
         return;
 
-    plasma_tune(plasma->L, dtyp, "gelqf_nb", &plasma->nb, 2, m, n);
-    plasma_tune(plasma->L, dtyp, "gelqf_ib", &plasma->ib, 2, m, n);
+    plasma_tune(plasma, dtyp, "gelqf_nb", &plasma->nb, 2, m, n);
+    plasma_tune(plasma, dtyp, "gelqf_ib", &plasma->ib, 2, m, n);
 }
 
 /******************************************************************************/
 void plasma_tune_gemm(plasma_context_t *plasma, plasma_enum_t dtyp,
                       int m, int n, int k)
 {
+    if (plasma_tune_table(plasma, PlasmaTuneGemm, dtyp, cbrt(1.0*m*n*k)))
+        return;
     if (plasma->L == NULL)
         return;
 
-    plasma_tune(plasma->L, dtyp, "gemm_nb", &plasma->nb, 3, m, n, k);
+    plasma_tune(plasma, dtyp, "gemm_nb", &plasma->nb, 3, m, n, k);
 }
 
 /******************************************************************************/
 void plasma_tune_geqrf(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int m, int n)
 {
+    if (plasma_tune_table(plasma, PlasmaTuneGeqrf, dtyp, sqrt(1.0*m*n)))
+        return;
     if (plasma->L == NULL)
         return;
 
-    plasma_tune(plasma->L, dtyp, "geqrf_nb", &plasma->nb, 2, m, n);
-    plasma_tune(plasma->L, dtyp, "geqrf_ib", &plasma->ib, 2, m, n);
+    plasma_tune(plasma, dtyp, "geqrf_nb", &plasma->nb, 2, m, n);
+    plasma_tune(plasma, dtyp, "geqrf_ib", &plasma->ib, 2, m, n);
+    plasma_tune(plasma, dtyp, "geqrf_lookahead", &plasma->lookahead, 2, m, n);
 }
 
 /******************************************************************************/
 void plasma_tune_geswp(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int m, int n)
 {
+    if (plasma_tune_table(plasma, PlasmaTuneGeswp, dtyp, sqrt(1.0*m*n)))
+        return;
     if (plasma->L == NULL)
         return;
 
-    plasma_tune(plasma->L, dtyp, "geswp_nb", &plasma->nb, 2, m, n);
+    plasma_tune(plasma, dtyp, "geswp_nb", &plasma->nb, 2, m, n);
 }
 
 /******************************************************************************/
 void plasma_tune_getrf(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int m, int n)
 {
+    if (plasma_tune_table(plasma, PlasmaTuneGetrf, dtyp, sqrt(1.0*m*n)))
+        return;
     if (plasma->L == NULL)
         return;
 
-    plasma_tune(plasma->L, dtyp, "getrf_nb", &plasma->nb, 2, m, n);
-    plasma_tune(plasma->L, dtyp, "getrf_ib", &plasma->ib, 2, m, n);
-    plasma_tune(plasma->L, dtyp, "getrf_max_panel_threads",
+    plasma_tune(plasma, dtyp, "getrf_nb", &plasma->nb, 2, m, n);
+    plasma_tune(plasma, dtyp, "getrf_ib", &plasma->ib, 2, m, n);
+    plasma_tune(plasma, dtyp, "getrf_max_panel_threads",
                 &plasma->max_panel_threads, 2, m, n);
+    plasma_tune(plasma, dtyp, "getrf_panel", &plasma->getrf_panel, 2, m, n);
+    plasma_tune(plasma, dtyp, "getrf_lookahead", &plasma->lookahead, 2, m, n);
 }
 
 /******************************************************************************/
 void plasma_tune_hetrf(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int n)
 {
+    if (plasma_tune_table(plasma, PlasmaTuneHetrf, dtyp, n))
+        return;
     if (plasma->L == NULL)
         return;
 
-    plasma_tune(plasma->L, dtyp, "hetrf_nb", &plasma->nb, 1, n);
+    plasma_tune(plasma, dtyp, "hetrf_nb", &plasma->nb, 1, n);
 }
 
 /******************************************************************************/
 void plasma_tune_lacpy(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int m, int n)
 {
+    if (plasma_tune_table(plasma, PlasmaTuneLacpy, dtyp, sqrt(1.0*m*n)))
+        return;
     if (plasma->L == NULL)
         return;
 
-    plasma_tune(plasma->L, dtyp, "lacpy_nb", &plasma->nb, 2, m, n);
+    plasma_tune(plasma, dtyp, "lacpy_nb", &plasma->nb, 2, m, n);
 }
 
 /******************************************************************************/
 void plasma_tune_lag2c(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int m, int n)
 {
+    if (plasma_tune_table(plasma, PlasmaTuneLag2c, dtyp, sqrt(1.0*m*n)))
+        return;
     if (plasma->L == NULL)
         return;
 
-    plasma_tune(plasma->L, dtyp, "lag2c_nb", &plasma->nb, 2, m, n);
+    plasma_tune(plasma, dtyp, "lag2c_nb", &plasma->nb, 2, m, n);
 }
 
 /******************************************************************************/
 void plasma_tune_lange(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int m, int n)
 {
+    if (plasma_tune_table(plasma, PlasmaTuneLange, dtyp, sqrt(1.0*m*n)))
+        return;
     if (plasma->L == NULL)
         return;
 
-    plasma_tune(plasma->L, dtyp, "lange_nb", &plasma->nb, 2, m, n);
+    plasma_tune(plasma, dtyp, "lange_nb", &plasma->nb, 2, m, n);
 }
 
 /******************************************************************************/
 void plasma_tune_lansy(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int n)
 {
+    if (plasma_tune_table(plasma, PlasmaTuneLansy, dtyp, n))
+        return;
     if (plasma->L == NULL)
         return;
 
-    plasma_tune(plasma->L, dtyp, "lansy_nb", &plasma->nb, 1, n);
+    plasma_tune(plasma, dtyp, "lansy_nb", &plasma->nb, 1, n);
 }
 
 /******************************************************************************/
 void plasma_tune_lantr(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int m, int n)
 {
+    if (plasma_tune_table(plasma, PlasmaTuneLantr, dtyp, sqrt(1.0*m*n)))
+        return;
     if (plasma->L == NULL)
         return;
 
-    plasma_tune(plasma->L, dtyp, "lantr_nb", &plasma->nb, 2, m, n);
+    plasma_tune(plasma, dtyp, "lantr_nb", &plasma->nb, 2, m, n);
 }
 
 /******************************************************************************/
 void plasma_tune_lascl(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int m, int n)
 {
+    if (plasma_tune_table(plasma, PlasmaTuneLascl, dtyp, sqrt(1.0*m*n)))
+        return;
     if (plasma->L == NULL)
         return;
 
-    plasma_tune(plasma->L, dtyp, "lascl_nb", &plasma->nb, 2, m, n);
+    plasma_tune(plasma, dtyp, "lascl_nb", &plasma->nb, 2, m, n);
 }
 
 /******************************************************************************/
 void plasma_tune_laset(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int m, int n)
 {
+    if (plasma_tune_table(plasma, PlasmaTuneLaset, dtyp, sqrt(1.0*m*n)))
+        return;
     if (plasma->L == NULL)
         return;
 
-    plasma_tune(plasma->L, dtyp, "laset_nb", &plasma->nb, 2, m, n);
+    plasma_tune(plasma, dtyp, "laset_nb", &plasma->nb, 2, m, n);
 }
 
 /******************************************************************************/
 void plasma_tune_lauum(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int n)
 {
+    if (plasma_tune_table(plasma, PlasmaTuneLauum, dtyp, n))
+        return;
     if (plasma->L == NULL)
         return;
 
-    plasma_tune(plasma->L, dtyp, "lauum_nb", &plasma->nb, 1, n);
+    plasma_tune(plasma, dtyp, "lauum_nb", &plasma->nb, 1, n);
 }
 
 /******************************************************************************/
 void plasma_tune_pbtrf(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int n)
 {
+    if (plasma_tune_table(plasma, PlasmaTunePbtrf, dtyp, n))
+        return;
     if (plasma->L == NULL)
         return;
 
-    plasma_tune(plasma->L, dtyp, "pbtrf_nb", &plasma->nb, 1, n);
+    plasma_tune(plasma, dtyp, "pbtrf_nb", &plasma->nb, 1, n);
 }
 
 /******************************************************************************/
 void plasma_tune_poinv(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int n)
 {
+    if (plasma_tune_table(plasma, PlasmaTunePoinv, dtyp, n))
+        return;
     if (plasma->L == NULL)
         return;
 
-    plasma_tune(plasma->L, dtyp, "poinv_nb", &plasma->nb, 1, n);
+    plasma_tune(plasma, dtyp, "poinv_nb", &plasma->nb, 1, n);
 }
 
 /******************************************************************************/
 void plasma_tune_potrf(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int n)
 {
+    if (plasma_tune_table(plasma, PlasmaTunePotrf, dtyp, n))
+        return;
     if (plasma->L == NULL)
         return;
 
-    plasma_tune(plasma->L, dtyp, "potrf_nb", &plasma->nb, 1, n);
+    plasma_tune(plasma, dtyp, "potrf_nb", &plasma->nb, 1, n);
+    plasma_tune(plasma, dtyp, "potrf_lookahead", &plasma->lookahead, 1, n);
 }
 
 /******************************************************************************/
 void plasma_tune_symm(plasma_context_t *plasma, plasma_enum_t dtyp,
                       int m, int n)
 {
+    if (plasma_tune_table(plasma, PlasmaTuneSymm, dtyp, sqrt(1.0*m*n)))
+        return;
     if (plasma->L == NULL)
         return;
 
-    plasma_tune(plasma->L, dtyp, "symm_nb", &plasma->nb, 2, m, n);
+    plasma_tune(plasma, dtyp, "symm_nb", &plasma->nb, 2, m, n);
 }
 
 /******************************************************************************/
 void plasma_tune_syr2k(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int n, int k)
 {
+    if (plasma_tune_table(plasma, PlasmaTuneSyr2k, dtyp, sqrt(1.0*n*k)))
+        return;
     if (plasma->L == NULL)
         return;
 
-    plasma_tune(plasma->L, dtyp, "syr2k_nb", &plasma->nb, 2, n, k);
+    plasma_tune(plasma, dtyp, "syr2k_nb", &plasma->nb, 2, n, k);
 }
 
 /******************************************************************************/
 void plasma_tune_syrk(plasma_context_t *plasma, plasma_enum_t dtyp,
                       int n, int k)
 {
+    if (plasma_tune_table(plasma, PlasmaTuneSyrk, dtyp, sqrt(1.0*n*k)))
+        return;
     if (plasma->L == NULL)
         return;
 
-    plasma_tune(plasma->L, dtyp, "syrk_nb", &plasma->nb, 2, n, k);
+    plasma_tune(plasma, dtyp, "syrk_nb", &plasma->nb, 2, n, k);
 }
 
 /******************************************************************************/
 void plasma_tune_tradd(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int m, int n)
 {
+    if (plasma_tune_table(plasma, PlasmaTuneTradd, dtyp, sqrt(1.0*m*n)))
+        return;
     if (plasma->L == NULL)
         return;
 
-    plasma_tune(plasma->L, dtyp, "tradd_nb", &plasma->nb, 2, m, n);
+    plasma_tune(plasma, dtyp, "tradd_nb", &plasma->nb, 2, m, n);
 }
 
 /******************************************************************************/
 void plasma_tune_trmm(plasma_context_t *plasma, plasma_enum_t dtyp,
                       int m, int n)
 {
+    if (plasma_tune_table(plasma, PlasmaTuneTrmm, dtyp, sqrt(1.0*m*n)))
+        return;
     if (plasma->L == NULL)
         return;
 
-    plasma_tune(plasma->L, dtyp, "trmm_nb", &plasma->nb, 2, m, n);
+    plasma_tune(plasma, dtyp, "trmm_nb", &plasma->nb, 2, m, n);
 }
 
 /******************************************************************************/
 void plasma_tune_trsm(plasma_context_t *plasma, plasma_enum_t dtyp,
                       int m, int n)
 {
+    if (plasma_tune_table(plasma, PlasmaTuneTrsm, dtyp, sqrt(1.0*m*n)))
+        return;
     if (plasma->L == NULL)
         return;
 
-    plasma_tune(plasma->L, dtyp, "trsm_nb", &plasma->nb, 2, m, n);
+    plasma_tune(plasma, dtyp, "trsm_nb", &plasma->nb, 2, m, n);
 }
 
 /******************************************************************************/
 void plasma_tune_trtri(plasma_context_t *plasma, plasma_enum_t dtyp,
                        int n)
 {
+    if (plasma_tune_table(plasma, PlasmaTuneTrtri, dtyp, n))
+        return;
     if (plasma->L == NULL)
         return;
 
-    plasma_tune(plasma->L, dtyp, "trtri_nb", &plasma->nb, 1, n);
+    plasma_tune(plasma, dtyp, "trtri_nb", &plasma->nb, 1, n);
 }
@@ -0,0 +1,252 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include "plasma_tuning.h"
+#include "plasma_internal.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Half-octave buckets of the number of threads and of the size,
+// up to 2^12 threads and 2^32 rows.
+#define PLASMA_TUNING_THREAD_BUCKETS 25
+#define PLASMA_TUNING_SIZE_BUCKETS   65
+
+static const char *routine_name[PlasmaTuneNumRoutines] = {
+    "gbtrf", "geadd", "geinv", "gelqf", "gemm",  "geqrf", "geswp",
+    "getrf", "hetrf", "lacpy", "lag2c", "lange", "lansy", "lantr",
+    "lascl", "laset", "lauum", "pbtrf", "poinv", "potrf", "symm",
+    "syr2k", "syrk",  "tradd", "trmm",  "trsm",  "trtri"
+};
+
+// Precisions in the order of the table, as named by the tuning files.
+static const char precision_name[] = "SDCZ";
+
+/******************************************************************************/
+typedef struct {
+    int nb;                ///< tile size, or 0 if not tuned
+    int ib;                ///< inner blocking, or 0 if not tuned
+    int max_panel_threads; ///< panel threads, or 0 if not tuned
+} plasma_tuning_entry_t;
+
+// Settings measured for a routine, precision, number of threads and size.
+typedef struct {
+    int routine;
+    int precision;
+    int threads;
+    int size;
+    plasma_tuning_entry_t entry;
+} plasma_tuning_point_t;
+
+struct plasma_tuning_table_s {
+    // Settings of each routine and precision, by bucket of the number of
+    // threads and bucket of the size; NULL if not tuned.
+    plasma_tuning_entry_t *entry[PlasmaTuneNumRoutines][4];
+};
+
+/******************************************************************************/
+static int precision_index(plasma_enum_t dtyp)
+{
+    switch (dtyp) {
+        case PlasmaRealFloat:     return 0;
+        case PlasmaRealDouble:    return 1;
+        case PlasmaComplexFloat:  return 2;
+        case PlasmaComplexDouble: return 3;
+        default:                  return -1;
+    }
+}
+
+/******************************************************************************/
+// Returns the nearest half-octave of x.
+static int bucket(double x, int num_buckets)
+{
+    int b = x > 1.0 ? (int)lround(2.0*log2(x)) : 0;
+    return b < num_buckets ? b : num_buckets-1;
+}
+
+/******************************************************************************/
+// Fills the buckets of a routine in a precision with the settings measured
+// for the nearest number of threads, then the nearest size.
+static plasma_tuning_entry_t *plasma_tuning_table_fill(
+    const plasma_tuning_point_t *point, int num_points,
+    int routine, int precision)
+{
+    plasma_tuning_entry_t *entry = (plasma_tuning_entry_t*)malloc(
+        PLASMA_TUNING_THREAD_BUCKETS*PLASMA_TUNING_SIZE_BUCKETS*
+        sizeof(plasma_tuning_entry_t));
+    if (entry == NULL)
+        return NULL;
+
+    for (int tb = 0; tb < PLASMA_TUNING_THREAD_BUCKETS; tb++) {
+        int threads = 0;
+        for (int i = 0; i < num_points; i++) {
+            if (point[i].routine == routine &&
+                point[i].precision == precision &&
+                (threads == 0 ||
+                 fabs(log2(point[i].threads)-0.5*tb) <
+                 fabs(log2(threads)-0.5*tb)))
+                threads = point[i].threads;
+        }
+        for (int sb = 0; sb < PLASMA_TUNING_SIZE_BUCKETS; sb++) {
+            const plasma_tuning_point_t *best = NULL;
+            for (int i = 0; i < num_points; i++) {
+                if (point[i].routine == routine &&
+                    point[i].precision == precision &&
+                    point[i].threads == threads &&
+                    (best == NULL ||
+                     fabs(log2(point[i].size)-0.5*sb) <
+                     fabs(log2(best->size)-0.5*sb)))
+                    best = &point[i];
+            }
+            entry[tb*PLASMA_TUNING_SIZE_BUCKETS+sb] = best->entry;
+        }
+    }
+    return entry;
+}
+
+/***************************************************************************//**
+ *
+ * Loads a tuning table written by tools/plasmatune.py. Each line holds
+ * a routine, a precision (S, D, C or Z), a number of threads, a size and the
+ * nb, ib and number of panel threads measured best, 0 for settings not tuned;
+ * lines starting with # are comments. Calls are then tuned with the settings
+ * of the nearest number of threads and size, found in constant time.
+ *
+ * @return The table, or NULL on error.
+ *
+ ******************************************************************************/
+plasma_tuning_table_t *plasma_tuning_table_load(const char *filename)
+{
+    FILE *file = fopen(filename, "r");
+    if (file == NULL) {
+        plasma_error("tuning table not found");
+        return NULL;
+    }
+
+    plasma_tuning_point_t *point = NULL;
+    int num_points = 0;
+    int max_points = 0;
+    char line[256];
+    while (fgets(line, sizeof(line), file) != NULL) {
+        char name[16];
+        char type = '\0';
+        plasma_tuning_point_t p;
+        int num = sscanf(line, "%15s %c %d %d %d %d %d", name, &type,
+                         &p.threads, &p.size, &p.entry.nb, &p.entry.ib,
+                         &p.entry.max_panel_threads);
+        if (num <= 0 || name[0] == '#')
+            continue;
+
+        const char *prec = strchr(precision_name, type);
+        p.precision = prec != NULL && type != '\0' ?
+                      (int)(prec-precision_name) : -1;
+        p.routine = -1;
+        for (int r = 0; r < PlasmaTuneNumRoutines; r++)
+            if (strcmp(name, routine_name[r]) == 0)
+                p.routine = r;
+
+        if (num != 7 || p.precision < 0 || p.routine < 0 ||
+            p.threads < 1 || p.size < 1 || p.entry.nb < 0 || p.entry.ib < 0 ||
+            p.entry.max_panel_threads < 0) {
+            plasma_error("invalid line in tuning table");
+            free(point);
+            fclose(file);
+            return NULL;
+        }
+
+        if (num_points == max_points) {
+            max_points = max_points == 0 ? 64 : 2*max_points;
+            plasma_tuning_point_t *tmp = (plasma_tuning_point_t*)realloc(
+                point, max_points*sizeof(plasma_tuning_point_t));
+            if (tmp == NULL) {
+                plasma_error("realloc() failed");
+                free(point);
+                fclose(file);
+                return NULL;
+            }
+            point = tmp;
+        }
+        point[num_points++] = p;
+    }
+    fclose(file);
+
+    plasma_tuning_table_t *table =
+        (plasma_tuning_table_t*)calloc(1, sizeof(plasma_tuning_table_t));
+    if (table == NULL) {
+        plasma_error("calloc() failed");
+        free(point);
+        return NULL;
+    }
+    for (int i = 0; i < num_points; i++) {
+        int r = point[i].routine;
+        int p = point[i].precision;
+        if (table->entry[r][p] == NULL) {
+            table->entry[r][p] =
+                plasma_tuning_table_fill(point, num_points, r, p);
+            if (table->entry[r][p] == NULL) {
+                plasma_error("malloc() failed");
+                plasma_tuning_table_free(table);
+                free(point);
+                return NULL;
+            }
+        }
+    }
+    free(point);
+    return table;
+}
+
+/******************************************************************************/
+void plasma_tuning_table_free(plasma_tuning_table_t *table)
+{
+    if (table == NULL)
+        return;
+
+    for (int r = 0; r < PlasmaTuneNumRoutines; r++)
+        for (int p = 0; p < 4; p++)
+            free(table->entry[r][p]);
+    free(table);
+}
+
+/***************************************************************************//**
+ *
+ * Sets nb, ib and max_panel_threads to the settings of the table for
+ * the routine, precision, number of threads and size, leaving unchanged
+ * the settings not tuned.
+ *
+ * @return 1 if the table has the routine in the precision, 0 otherwise.
+ *
+ ******************************************************************************/
+int plasma_tuning_table_lookup(const plasma_tuning_table_t *table,
+                               int routine, plasma_enum_t dtyp,
+                               int num_threads, double size,
+                               int *nb, int *ib, int *max_panel_threads)
+{
+    if (table == NULL || routine < 0 || routine >= PlasmaTuneNumRoutines)
+        return 0;
+
+    int p = precision_index(dtyp);
+    if (p < 0 || table->entry[routine][p] == NULL)
+        return 0;
+
+    const plasma_tuning_entry_t *entry = &table->entry[routine][p][
+        bucket(num_threads, PLASMA_TUNING_THREAD_BUCKETS)*
+        PLASMA_TUNING_SIZE_BUCKETS +
+        bucket(size, PLASMA_TUNING_SIZE_BUCKETS)];
+
+    if (entry->nb > 0)
+        *nb = entry->nb;
+    if (entry->ib > 0)
+        *ib = entry->ib;
+    if (entry->max_panel_threads > 0)
+        *max_panel_threads = entry->max_panel_threads;
+    return 1;
+}
@@ -8,6 +8,7 @@
  *
  **/
 #include "plasma_workspace.h"
+#include "plasma_context.h"
 #include "plasma_internal.h"
 
 #include <omp.h>
@@ -16,46 +17,62 @@
 int plasma_workspace_create(plasma_workspace_t *workspace, size_t lworkspace,
                             plasma_enum_t dtyp)
 {
-    // Allocate array of pointers.
-    #pragma omp parallel
-    #pragma omp master
-    {
-        workspace->nthread = omp_get_num_threads();
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
     }
+    // Allocate array of pointers.
+    workspace->nthread = omp_get_max_threads();
     workspace->lworkspace = lworkspace;
     workspace->dtyp  = dtyp;
-    if ((workspace->spaces = (void**)calloc(workspace->nthread,
-                                            sizeof(void*))) == NULL) {
-        free(workspace->spaces);
-        plasma_error("malloc() failed");
+    if ((workspace->spaces = (void**)plasma_pool_calloc(
+             &plasma->pool, workspace->nthread*sizeof(void*))) == NULL) {
+        plasma_error("plasma_pool_calloc() failed");
         return PlasmaErrorOutOfMemory;
     }
 
-    // Each thread allocates its workspace.
+    // Each thread takes its own workspace from the pool, so that the pages
+    // of new memory are placed by the first touch near the thread using it.
+    // Across NUMA domains, the workspaces are always new memory.
     size_t size = (size_t)lworkspace * plasma_element_size(workspace->dtyp);
-    int info = PlasmaSuccess;
-    #pragma omp parallel
+    int fresh = plasma->distribution == PlasmaDistributionBlockCyclic;
+    #pragma omp parallel num_threads(workspace->nthread)
     {
         int tid = omp_get_thread_num();
-        if ((workspace->spaces[tid] = (void*)malloc(size)) == NULL) {
-            info = PlasmaErrorOutOfMemory;
-        }
+        if (fresh)
+            workspace->spaces[tid] =
+                plasma_pool_malloc_fresh(&plasma->pool, size);
+        else
+            workspace->spaces[tid] = plasma_pool_malloc(&plasma->pool, size);
     }
-    if (info != PlasmaSuccess) {
-        plasma_workspace_destroy(workspace);
+    // The team may have been smaller, e.g., with dynamic threads.
+    for (int tid = 0; tid < workspace->nthread; tid++) {
+        if (workspace->spaces[tid] == NULL)
+            workspace->spaces[tid] = plasma_pool_malloc(&plasma->pool, size);
+        if (workspace->spaces[tid] == NULL) {
+            plasma_workspace_destroy(workspace);
+            plasma_error("plasma_pool_malloc() failed");
+            return PlasmaErrorOutOfMemory;
+        }
     }
-    return info;
+    return PlasmaSuccess;
 }
 
 /******************************************************************************/
 int plasma_workspace_destroy(plasma_workspace_t *workspace)
 {
+    plasma_context_t *plasma = plasma_context_self();
+    if (plasma == NULL) {
+        plasma_error("PLASMA not initialized");
+        return PlasmaErrorNotInitialized;
+    }
     if (workspace->spaces != NULL) {
         for (int i = 0; i < workspace->nthread; ++i) {
-            free(workspace->spaces[i]);
+            plasma_pool_free(&plasma->pool, workspace->spaces[i]);
             workspace->spaces[i] = NULL;
         }
-        free(workspace->spaces);
+        plasma_pool_free(&plasma->pool, workspace->spaces);
         workspace->spaces  = NULL;
         workspace->nthread = 0;
         workspace->lworkspace   = 0;
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/core_blas/core_zgeadd.c, normal z -> c, Fri Sep 28 17:38:18 2018
+ * @generated from core_blas/core_zgeadd.c, normal z -> c, Sat Oct 17 04:41:22 2026
  *
  **/
 
@@ -144,12 +144,11 @@ void plasma_core_omp_cgeadd(
     plasma_complex32_t beta,        plasma_complex32_t *B, int ldb,
     plasma_sequence_t *sequence, plasma_request_t *request)
 {
-    int k = (transa == PlasmaNoTrans) ? n : m;
-
-    #pragma omp task depend(in:A[0:lda*k]) \
-                     depend(inout:B[0:ldb*n])
+    #pragma omp task depend(in:A[0]) \
+                     depend(inout:B[0])
     {
         if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             int retval = plasma_core_cgeadd(transa,
                                      m, n,
                                      alpha, A, lda,
@@ -158,6 +157,9 @@ void plasma_core_omp_cgeadd(
                 plasma_error("core_cgeadd() failed");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
+            plasma_trace_tiles("rw", (const void*[]){A, B});
+            plasma_stats_stop(PlasmaStatsAux, PlasmaComplexFloat, start,
+                              0.0, 3.0*m*n);
         }
     }
 }
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/core_blas/core_zgelqt.c, normal z -> c, Fri Sep 28 17:38:20 2018
+ * @generated from core_blas/core_zgelqt.c, normal z -> c, Sat Oct 17 02:49:18 2026
  *
  **/
 
@@ -180,6 +180,7 @@ void plasma_core_omp_cgelqt(int m, int n, int ib,
                                            // as ibxm
     {
         if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             // Prepare workspaces.
             int tid = omp_get_thread_num();
             plasma_complex32_t *tau = (plasma_complex32_t*)work.spaces[tid];
@@ -195,6 +196,9 @@ void plasma_core_omp_cgelqt(int m, int n, int ib,
                 plasma_error("core_cgelqt() failed");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
+            plasma_trace_tiles("ww", (const void*[]){A, T});
+            plasma_stats_stop(PlasmaStatsGeqrt, PlasmaComplexFloat, start,
+                              2.0*m*m*(n-m/3.0), 2.0*m*n);
         }
     }
 }
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/core_blas/core_zhegst.c, normal z -> c, Fri Sep 28 17:38:23 2018
+ * @generated from core_blas/core_zhegst.c, normal z -> c, Sat Oct 17 02:49:18 2026
  *
  **/
 
@@ -90,10 +90,15 @@ void plasma_core_omp_chegst(int itype, plasma_enum_t uplo,
     #pragma omp task depend(inout:A[0:lda*n]) \
                      depend(in:B[0:ldb*n])
     {
-        if (sequence->status == PlasmaSuccess)
+        if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             plasma_core_chegst(itype, uplo,
                         n,
                         A, lda,
                         B, ldb);
+            plasma_trace_tiles("wr", (const void*[]){A, B});
+            plasma_stats_stop(PlasmaStatsHegst, PlasmaComplexFloat, start,
+                              1.0*n*n*n, 3.0*n*n);
+        }
     }
 }
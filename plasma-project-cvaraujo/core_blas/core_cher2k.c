@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/core_blas/core_zher2k.c, normal z -> c, Fri Sep 28 17:38:21 2018
+ * @generated from core_blas/core_zher2k.c, normal z -> c, Sat Oct 17 02:49:18 2026
  *
  **/
 
@@ -123,13 +123,19 @@ void plasma_core_omp_cher2k(
 
     #pragma omp task depend(in:A[0:lda*ak]) \
                      depend(in:B[0:ldb*bk]) \
-                     depend(inout:C[0:ldc*n])
+                     depend(inout:C[0:ldc*n]) \
+                     affinity(C[0:ldc*n])
     {
-        if (sequence->status == PlasmaSuccess)
+        if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             plasma_core_cher2k(uplo, trans,
                         n, k,
                         alpha, A, lda,
                                B, ldb,
                         beta,  C, ldc);
+            plasma_trace_tiles("rrw", (const void*[]){A, B, C});
+            plasma_stats_stop(PlasmaStatsSyr2k, PlasmaComplexFloat, start,
+                              2.0*n*n*k, 4.0*n*k+2.0*n*n);
+        }
     }
 }
@@ -6,12 +6,15 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/core_blas/core_zherk.c, normal z -> c, Fri Sep 28 17:38:21 2018
+ * @generated from core_blas/core_zherk.c, normal z -> c, Sat Oct 17 03:04:06 2026
  *
  **/
 
 #include <plasma_core_blas.h>
 #include "plasma_types.h"
+#include "plasma_graph.h"
+#include "plasma_internal.h"
+#include "plasma_tile_cache.h"
 #include "core_lapack.h"
 
 /***************************************************************************//**
@@ -83,6 +86,36 @@ void plasma_core_cherk(plasma_enum_t uplo, plasma_enum_t trans,
                 beta,  C, ldc);
 }
 
+/******************************************************************************/
+typedef struct {
+    plasma_enum_t uplo;
+    plasma_enum_t trans;
+    int n;
+    int k;
+    float alpha;
+    int lda;
+    float beta;
+    int ldc;
+} plasma_core_cherk_args_t;
+
+/******************************************************************************/
+static void plasma_core_cherk_graph(const void *args_, void **tiles,
+                                    plasma_sequence_t *sequence,
+                                    plasma_request_t *request)
+{
+    const plasma_core_cherk_args_t *args =
+        (const plasma_core_cherk_args_t*)args_;
+    plasma_time_t start = plasma_stats_start();
+    plasma_core_cherk(args->uplo, args->trans,
+                      args->n, args->k,
+                      args->alpha, tiles[0], args->lda,
+                      args->beta,  tiles[1], args->ldc);
+    plasma_trace_tiles("rw", (const void*[]){tiles[0], tiles[1]});
+    plasma_stats_stop(PlasmaStatsSyrk, PlasmaComplexFloat, start,
+                      1.0*args->n*args->n*args->k,
+                      1.0*args->n*args->k+2.0*args->n*args->n);
+}
+
 /******************************************************************************/
 void plasma_core_omp_cherk(plasma_enum_t uplo, plasma_enum_t trans,
                     int n, int k,
@@ -90,19 +123,40 @@ void plasma_core_omp_cherk(plasma_enum_t uplo, plasma_enum_t trans,
                     float beta,        plasma_complex32_t *C, int ldc,
                     plasma_sequence_t *sequence, plasma_request_t *request)
 {
+    if (plasma_graph_capturing()) {
+        plasma_core_cherk_args_t args = {
+            uplo, trans, n, k, alpha, lda, beta, ldc
+        };
+        const void *tiles[] = {A, C};
+        const int write[] = {0, 1};
+        plasma_graph_record(plasma_core_cherk_graph, &args, sizeof(args),
+                            2, tiles, write);
+        return;
+    }
+
     int ak;
     if (trans == PlasmaNoTrans)
         ak = k;
     else
         ak = n;
 
+    plasma_tile_cache_host(A, sizeof(plasma_complex32_t)*lda*ak, 0);
+    plasma_tile_cache_host(C, sizeof(plasma_complex32_t)*ldc*n, 1);
+
     #pragma omp task depend(in:A[0:lda*ak]) \
-                     depend(inout:C[0:ldc*n])
+                     depend(inout:C[0:ldc*n]) \
+                     affinity(C[0:ldc*n]) \
+                     priority(plasma_task_priority())
     {
-        if (sequence->status == PlasmaSuccess)
+        if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             plasma_core_cherk(uplo, trans,
                        n, k,
                        alpha, A, lda,
                        beta,  C, ldc);
+            plasma_trace_tiles("rw", (const void*[]){A, C});
+            plasma_stats_stop(PlasmaStatsSyrk, PlasmaComplexFloat, start,
+                              1.0*n*n*k, 1.0*n*k+2.0*n*n);
+        }
     }
 }
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/core_blas/core_zhessq.c, normal z -> c, Fri Sep 28 17:38:21 2018
+ * @generated from core_blas/core_zhessq.c, normal z -> c, Sat Oct 17 02:49:18 2026
  *
  **/
 
@@ -64,9 +64,13 @@ void plasma_core_omp_chessq(plasma_enum_t uplo,
                      depend(out:sumsq[0:n])
     {
         if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             *scale = 0.0;
             *sumsq = 1.0;
             plasma_core_chessq(uplo, n, A, lda, scale, sumsq);
+            plasma_trace_tiles("rww", (const void*[]){A, scale, sumsq});
+            plasma_stats_stop(PlasmaStatsNorm, PlasmaComplexFloat, start,
+                              0.0, 1.0*n*n);
         }
     }
 }
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/core_blas/core_zlange.c, normal z -> c, Fri Sep 28 17:38:21 2018
+ * @generated from core_blas/core_zlange.c, normal z -> c, Sat Oct 17 04:40:24 2026
  *
  **/
 
@@ -67,11 +67,16 @@ void plasma_core_omp_clange(plasma_enum_t norm, int m, int n,
                      float *work, float *value,
                      plasma_sequence_t *sequence, plasma_request_t *request)
 {
-    #pragma omp task depend(in:A[0:lda*n]) \
+    #pragma omp task depend(in:A[0]) \
                      depend(out:value[0:1])
     {
-        if (sequence->status == PlasmaSuccess)
+        if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             plasma_core_clange(norm, m, n, A, lda, work, value);
+            plasma_trace_tiles("rw", (const void*[]){A, value});
+            plasma_stats_stop(PlasmaStatsNorm, PlasmaComplexFloat, start,
+                              0.0, 1.0*m*n);
+        }
     }
 }
 
@@ -83,24 +88,29 @@ void plasma_core_omp_clange_aux(plasma_enum_t norm, int m, int n,
 {
     switch (norm) {
     case PlasmaOneNorm:
-        #pragma omp task depend(in:A[0:lda*n]) \
+        #pragma omp task depend(in:A[0]) \
                          depend(out:value[0:n])
         {
             if (sequence->status == PlasmaSuccess) {
+                plasma_time_t start = plasma_stats_start();
                 for (int j = 0; j < n; j++) {
                     value[j] = cabsf(A[lda*j]);
                     for (int i = 1; i < m; i++) {
                         value[j] += cabsf(A[lda*j+i]);
                     }
                 }
+                plasma_trace_tiles("rw", (const void*[]){A, value});
+                plasma_stats_stop(PlasmaStatsNorm, PlasmaComplexFloat, start,
+                                  0.0, 1.0*m*n);
             }
         }
         break;
     case PlasmaInfNorm:
-        #pragma omp task depend(in:A[0:lda*n]) \
+        #pragma omp task depend(in:A[0]) \
                          depend(out:value[0:m])
         {
             if (sequence->status == PlasmaSuccess) {
+                plasma_time_t start = plasma_stats_start();
                 for (int i = 0; i < m; i++)
                     value[i] = 0.0;
 
@@ -109,6 +119,9 @@ void plasma_core_omp_clange_aux(plasma_enum_t norm, int m, int n,
                         value[i] += cabsf(A[lda*j+i]);
                     }
                 }
+                plasma_trace_tiles("rw", (const void*[]){A, value});
+                plasma_stats_stop(PlasmaStatsNorm, PlasmaComplexFloat, start,
+                                  0.0, 1.0*m*n);
             }
         }
         break;
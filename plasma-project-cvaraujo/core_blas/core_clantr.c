@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/core_blas/core_zlantr.c, normal z -> c, Fri Sep 28 17:38:21 2018
+ * @generated from core_blas/core_zlantr.c, normal z -> c, Sat Oct 17 02:49:18 2026
  *
  **/
 
@@ -47,8 +47,13 @@ void plasma_core_omp_clantr(plasma_enum_t norm, plasma_enum_t uplo, plasma_enum_
     #pragma omp task depend(in:A[0:lda*n]) \
                      depend(out:value[0:1])
     {
-        if (sequence->status == PlasmaSuccess)
+        if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             plasma_core_clantr(norm, uplo, diag, m, n, A, lda, work, value);
+            plasma_trace_tiles("rw", (const void*[]){A, value});
+            plasma_stats_stop(PlasmaStatsNorm, PlasmaComplexFloat, start,
+                              0.0, 1.0*m*n);
+        }
     }
 }
 
@@ -66,6 +71,7 @@ void plasma_core_omp_clantr_aux(plasma_enum_t norm, plasma_enum_t uplo,
                          depend(out:value[0:n])
         {
             if (sequence->status == PlasmaSuccess) {
+                plasma_time_t start = plasma_stats_start();
                 if (uplo == PlasmaUpper) {
                     if (diag == PlasmaNonUnit) {
                         for (int j = 0; j < n; j++) {
@@ -115,6 +121,9 @@ void plasma_core_omp_clantr_aux(plasma_enum_t norm, plasma_enum_t uplo,
                             value[j] = 0.0;
                     }
                 }
+                plasma_trace_tiles("rw", (const void*[]){A, value});
+                plasma_stats_stop(PlasmaStatsNorm, PlasmaComplexFloat, start,
+                                  0.0, 1.0*m*n);
             }
         }
         break;
@@ -123,6 +132,7 @@ void plasma_core_omp_clantr_aux(plasma_enum_t norm, plasma_enum_t uplo,
                          depend(out:value[0:m])
         {
             if (sequence->status == PlasmaSuccess) {
+                plasma_time_t start = plasma_stats_start();
                 if (uplo == PlasmaUpper) {
                     if (diag == PlasmaNonUnit) {
                         for (int i = 0; i < m; i++)
@@ -181,6 +191,9 @@ void plasma_core_omp_clantr_aux(plasma_enum_t norm, plasma_enum_t uplo,
                         }
                     }
                 }
+                plasma_trace_tiles("rw", (const void*[]){A, value});
+                plasma_stats_stop(PlasmaStatsNorm, PlasmaComplexFloat, start,
+                                  0.0, 1.0*m*n);
             }
         }
         break;
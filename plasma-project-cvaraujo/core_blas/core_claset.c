@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/core_blas/core_zlaset.c, normal z -> c, Fri Sep 28 17:38:22 2018
+ * @generated from core_blas/core_zlaset.c, normal z -> c, Sat Oct 17 02:49:19 2026
  *
  **/
 
@@ -78,7 +78,13 @@ void plasma_core_omp_claset(plasma_enum_t uplo,
                      plasma_complex32_t *A)
 {
     #pragma omp task depend(out:A[0:mb*nb])
-    plasma_core_claset(uplo, m, n,
-                alpha, beta,
-                A+i+j*mb, mb);
+    {
+        plasma_time_t start = plasma_stats_start();
+        plasma_core_claset(uplo, m, n,
+                    alpha, beta,
+                    A+i+j*mb, mb);
+        plasma_trace_tiles("w", (const void*[]){A});
+        plasma_stats_stop(PlasmaStatsAux, PlasmaComplexFloat, start,
+                          0.0, 1.0*m*n);
+    }
 }
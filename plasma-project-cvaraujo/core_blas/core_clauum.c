@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/core_blas/core_zlauum.c, normal z -> c, Fri Sep 28 17:38:22 2018
+ * @generated from core_blas/core_zlauum.c, normal z -> c, Sat Oct 17 02:49:19 2026
  *
  **/
 
@@ -72,11 +72,15 @@ void plasma_core_omp_clauum(plasma_enum_t uplo,
     #pragma omp task depend(inout:A[0:lda*n])
     {
         if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             int info = plasma_core_clauum(uplo, n, A, lda);
             if (info != PlasmaSuccess) {
                 plasma_coreblas_error("core_clauum() failed");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
+            plasma_trace_tiles("w", (const void*[]){A});
+            plasma_stats_stop(PlasmaStatsTrtri, PlasmaComplexFloat, start,
+                              1.0*n*n*n/3.0, 2.0*n*n);
         }
     }
 }
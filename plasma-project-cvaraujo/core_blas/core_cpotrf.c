@@ -6,12 +6,16 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/core_blas/core_zpotrf.c, normal z -> c, Fri Sep 28 17:38:23 2018
+ * @generated from core_blas/core_zpotrf.c, normal z -> c, Sat Oct 17 03:04:06 2026
  *
  **/
 
 #include <plasma_core_blas.h>
 #include "plasma_types.h"
+#include "plasma_graph.h"
+#include "plasma_hier.h"
+#include "plasma_internal.h"
+#include "plasma_tile_cache.h"
 #include "core_lapack.h"
 
 /***************************************************************************//**
@@ -62,6 +66,32 @@ int plasma_core_cpotrf(plasma_enum_t uplo,
                                A, lda);
 }
 
+/******************************************************************************/
+typedef struct {
+    plasma_enum_t uplo;
+    int n;
+    int lda;
+    int iinfo;
+} plasma_core_cpotrf_args_t;
+
+/******************************************************************************/
+static void plasma_core_cpotrf_graph(const void *args_, void **tiles,
+                                     plasma_sequence_t *sequence,
+                                     plasma_request_t *request)
+{
+    const plasma_core_cpotrf_args_t *args =
+        (const plasma_core_cpotrf_args_t*)args_;
+    plasma_time_t start = plasma_stats_start();
+    int info = plasma_core_cpotrf(args->uplo,
+                                  args->n,
+                                  tiles[0], args->lda);
+    if (info != 0)
+        plasma_request_fail(sequence, request, args->iinfo+info);
+    plasma_trace_tiles("w", (const void*[]){tiles[0]});
+    plasma_stats_stop(PlasmaStatsPotrf, PlasmaComplexFloat, start,
+                      1.0*args->n*args->n*args->n/3.0, 2.0*args->n*args->n);
+}
+
 /******************************************************************************/
 void plasma_core_omp_cpotrf(plasma_enum_t uplo,
                      int n,
@@ -69,14 +99,39 @@ void plasma_core_omp_cpotrf(plasma_enum_t uplo,
                      int iinfo,
                      plasma_sequence_t *sequence, plasma_request_t *request)
 {
-    #pragma omp task depend(inout:A[0:lda*n])
+    if (plasma_graph_capturing()) {
+        plasma_core_cpotrf_args_t args = {
+            uplo, n, lda, iinfo
+        };
+        const void *tiles[] = {A};
+        const int write[] = {1};
+        plasma_graph_record(plasma_core_cpotrf_graph, &args, sizeof(args),
+                            1, tiles, write);
+        return;
+    }
+
+    if (plasma_hier_offload(n, n)) {
+        plasma_core_omp_chier_potrf(uplo, n, A, lda, iinfo,
+                                    sequence, request);
+        return;
+    }
+
+    plasma_tile_cache_host(A, sizeof(plasma_complex32_t)*lda*n, 1);
+
+    #pragma omp task depend(inout:A[0:lda*n]) \
+                     affinity(A[0:lda*n]) \
+                     priority(plasma_task_priority())
     {
         if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             int info = plasma_core_cpotrf(uplo,
                                    n,
                                    A, lda);
             if (info != 0)
                 plasma_request_fail(sequence, request, iinfo+info);
+            plasma_trace_tiles("w", (const void*[]){A});
+            plasma_stats_stop(PlasmaStatsPotrf, PlasmaComplexFloat, start,
+                              1.0*n*n*n/3.0, 2.0*n*n);
         }
     }
 }
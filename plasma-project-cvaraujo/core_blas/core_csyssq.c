@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/core_blas/core_zsyssq.c, normal z -> c, Fri Sep 28 17:38:23 2018
+ * @generated from core_blas/core_zsyssq.c, normal z -> c, Sat Oct 17 02:49:19 2026
  *
  **/
 
@@ -64,9 +64,13 @@ void plasma_core_omp_csyssq(plasma_enum_t uplo,
                      depend(out:sumsq[0:n])
     {
         if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             *scale = 0.0;
             *sumsq = 1.0;
             plasma_core_csyssq(uplo, n, A, lda, scale, sumsq);
+            plasma_trace_tiles("rww", (const void*[]){A, scale, sumsq});
+            plasma_stats_stop(PlasmaStatsNorm, PlasmaComplexFloat, start,
+                              0.0, 1.0*n*n);
         }
     }
 }
@@ -82,6 +86,7 @@ void plasma_core_omp_csyssq_aux(int m, int n,
                      depend(out:value[0:1])
     {
         if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             float scl = 0.0;
             float sum = 1.0;
             for (int j = 0; j < n; j++) {
@@ -110,6 +115,9 @@ void plasma_core_omp_csyssq_aux(int m, int n,
                 }
             }
             *value = scl*sqrtf(sum);
+            plasma_trace_tiles("rrw", (const void*[]){scale, sumsq, value});
+            plasma_stats_stop(PlasmaStatsNorm, PlasmaComplexFloat, start,
+                              0.0, 2.0*n*n);
         }
     }
 }
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/core_blas/core_ztrssq.c, normal z -> c, Fri Sep 28 17:38:24 2018
+ * @generated from core_blas/core_ztrssq.c, normal z -> c, Sat Oct 17 02:49:19 2026
  *
  **/
 
@@ -98,9 +98,13 @@ void plasma_core_omp_ctrssq(plasma_enum_t uplo, plasma_enum_t diag,
                      depend(out:sumsq[0:n])
     {
         if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             *scale = 0.0;
             *sumsq = 1.0;
             plasma_core_ctrssq(uplo, diag, m, n, A, lda, scale, sumsq);
+            plasma_trace_tiles("rww", (const void*[]){A, scale, sumsq});
+            plasma_stats_stop(PlasmaStatsNorm, PlasmaComplexFloat, start,
+                              0.0, 1.0*m*n);
         }
     }
 }
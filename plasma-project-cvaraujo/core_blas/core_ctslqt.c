@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/core_blas/core_ztslqt.c, normal z -> c, Fri Sep 28 17:38:24 2018
+ * @generated from core_blas/core_ztslqt.c, normal z -> c, Sat Oct 17 02:49:19 2026
  *
  **/
 
@@ -235,6 +235,7 @@ void plasma_core_omp_ctslqt(int m, int n, int ib,
                                            // as ibxm
     {
         if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             // Prepare workspaces.
             int tid = omp_get_thread_num();
             plasma_complex32_t *tau = ((plasma_complex32_t*)work.spaces[tid]);
@@ -251,6 +252,9 @@ void plasma_core_omp_ctslqt(int m, int n, int ib,
                 plasma_error("core_ctslqt() failed");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
+            plasma_trace_tiles("www", (const void*[]){A1, A2, T});
+            plasma_stats_stop(PlasmaStatsTsqrt, PlasmaComplexFloat, start,
+                              2.0*m*m*n, 2.0*m*m+2.0*m*n);
         }
     }
 }
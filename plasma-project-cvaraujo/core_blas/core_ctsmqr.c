@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/core_blas/core_ztsmqr.c, normal z -> c, Fri Sep 28 17:38:24 2018
+ * @generated from core_blas/core_ztsmqr.c, normal z -> c, Sat Oct 17 02:49:19 2026
  *
  **/
 
@@ -260,9 +260,11 @@ void plasma_core_omp_ctsmqr(plasma_enum_t side, plasma_enum_t trans,
     #pragma omp task depend(inout:A1[0:lda1*n1]) \
                      depend(inout:A2[0:lda2*n2]) \
                      depend(in:V[0:ldv*k]) \
-                     depend(in:T[0:ib*k])
+                     depend(in:T[0:ib*k]) \
+                     priority(plasma_task_priority())
     {
         if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             // Prepare workspaces.
             int tid = omp_get_thread_num();
             plasma_complex32_t *W = (plasma_complex32_t*)work.spaces[tid];
@@ -281,6 +283,9 @@ void plasma_core_omp_ctsmqr(plasma_enum_t side, plasma_enum_t trans,
                 plasma_error("core_ctsmqr() failed");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
+            plasma_trace_tiles("wwrr", (const void*[]){A1, A2, V, T});
+            plasma_stats_stop(PlasmaStatsTsmqr, PlasmaComplexFloat, start,
+                              4.0*m2*n2*k, 2.0*m1*n1+2.0*m2*n2);
         }
     }
 }
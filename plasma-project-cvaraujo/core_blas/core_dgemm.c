@@ -6,12 +6,16 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/core_blas/core_zgemm.c, normal z -> d, Fri Sep 28 17:38:18 2018
+ * @generated from core_blas/core_zgemm.c, normal z -> d, Sat Oct 17 04:40:24 2026
  *
  **/
 
 #include <plasma_core_blas.h>
 #include "plasma_types.h"
+#include "plasma_graph.h"
+#include "plasma_hier.h"
+#include "plasma_internal.h"
+#include "plasma_tile_cache.h"
 #include "core_lapack.h"
 
 /***************************************************************************//**
@@ -101,6 +105,39 @@ void plasma_core_dgemm(plasma_enum_t transa, plasma_enum_t transb,
                 (beta),  C, ldc);
 }
 
+/******************************************************************************/
+typedef struct {
+    plasma_enum_t transa;
+    plasma_enum_t transb;
+    int m;
+    int n;
+    int k;
+    double alpha;
+    int lda;
+    int ldb;
+    double beta;
+    int ldc;
+} plasma_core_dgemm_args_t;
+
+/******************************************************************************/
+static void plasma_core_dgemm_graph(const void *args_, void **tiles,
+                                    plasma_sequence_t *sequence,
+                                    plasma_request_t *request)
+{
+    const plasma_core_dgemm_args_t *args =
+        (const plasma_core_dgemm_args_t*)args_;
+    plasma_time_t start = plasma_stats_start();
+    plasma_core_dgemm(args->transa, args->transb,
+                      args->m, args->n, args->k,
+                      args->alpha, tiles[0], args->lda,
+                                   tiles[1], args->ldb,
+                      args->beta,  tiles[2], args->ldc);
+    plasma_trace_tiles("rrw", (const void*[]){tiles[0], tiles[1], tiles[2]});
+    plasma_stats_stop(PlasmaStatsGemm, PlasmaRealDouble, start,
+                      2.0*args->m*args->n*args->k,
+                      1.0*args->k*(args->m+args->n)+2.0*args->m*args->n);
+}
+
 /******************************************************************************/
 void plasma_core_omp_dgemm(
     plasma_enum_t transa, plasma_enum_t transb,
@@ -110,6 +147,26 @@ void plasma_core_omp_dgemm(
     double beta,        double *C, int ldc,
     plasma_sequence_t *sequence, plasma_request_t *request)
 {
+    if (plasma_graph_capturing()) {
+        plasma_core_dgemm_args_t args = {
+            transa, transb, m, n, k, alpha, lda, ldb, beta, ldc
+        };
+        const void *tiles[] = {A, B, C};
+        const int write[] = {0, 0, 1};
+        plasma_graph_record(plasma_core_dgemm_graph, &args, sizeof(args),
+                            3, tiles, write);
+        return;
+    }
+
+    if (plasma_hier_offload(m, n) && k > 0) {
+        plasma_core_omp_dhier_gemm(transa, transb, m, n, k,
+                                   alpha, A, lda,
+                                          B, ldb,
+                                   beta,  C, ldc,
+                                   sequence, request);
+        return;
+    }
+
     int ak;
     if (transa == PlasmaNoTrans)
         ak = k;
@@ -122,15 +179,28 @@ void plasma_core_omp_dgemm(
     else
         bk = k;
 
-    #pragma omp task depend(in:A[0:lda*ak]) \
-                     depend(in:B[0:ldb*bk]) \
-                     depend(inout:C[0:ldc*n])
+    plasma_tile_cache_host(A, sizeof(double)*lda*ak, 0);
+    plasma_tile_cache_host(B, sizeof(double)*ldb*bk, 0);
+    plasma_tile_cache_host(C, sizeof(double)*ldc*n, 1);
+
+    // The tiles may be strided views of a larger array, so the task
+    // depends on their first elements rather than on ld-long ranges.
+    #pragma omp task depend(in:A[0]) \
+                     depend(in:B[0]) \
+                     depend(inout:C[0]) \
+                     affinity(C[0:ldc*n]) \
+                     priority(plasma_task_priority())
     {
-        if (sequence->status == PlasmaSuccess)
+        if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             plasma_core_dgemm(transa, transb,
                        m, n, k,
                        alpha, A, lda,
                               B, ldb,
                        beta,  C, ldc);
+            plasma_trace_tiles("rrw", (const void*[]){A, B, C});
+            plasma_stats_stop(PlasmaStatsGemm, PlasmaRealDouble, start,
+                              2.0*m*n*k, 1.0*m*k+1.0*k*n+2.0*m*n);
+        }
     }
 }
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/core_blas/core_zgessq.c, normal z -> d, Fri Sep 28 17:38:20 2018
+ * @generated from core_blas/core_zgessq.c, normal z -> d, Sat Oct 17 04:40:24 2026
  *
  **/
 
@@ -35,14 +35,18 @@ void plasma_core_omp_dgessq(int m, int n,
                      double *scale, double *sumsq,
                      plasma_sequence_t *sequence, plasma_request_t *request)
 {
-    #pragma omp task depend(in:A[0:lda*n]) \
+    #pragma omp task depend(in:A[0]) \
                      depend(out:scale[0:n]) \
                      depend(out:sumsq[0:n])
     {
         if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             *scale = 0.0;
             *sumsq = 1.0;
             plasma_core_dgessq(m, n, A, lda, scale, sumsq);
+            plasma_trace_tiles("rww", (const void*[]){A, scale, sumsq});
+            plasma_stats_stop(PlasmaStatsNorm, PlasmaRealDouble, start,
+                              0.0, 1.0*m*n);
         }
     }
 }
@@ -58,6 +62,7 @@ void plasma_core_omp_dgessq_aux(int n,
                      depend(out:value[0:1])
     {
         if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             double scl = 0.0;
             double sum = 1.0;
             for (int i = 0; i < n; i++) {
@@ -70,6 +75,9 @@ void plasma_core_omp_dgessq_aux(int n,
                 }
             }
             *value = scl*sqrt(sum);
+            plasma_trace_tiles("rrw", (const void*[]){scale, sumsq, value});
+            plasma_stats_stop(PlasmaStatsNorm, PlasmaRealDouble, start,
+                              0.0, 2.0*n);
         }
     }
 }
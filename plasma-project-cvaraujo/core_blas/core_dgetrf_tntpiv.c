@@ -0,0 +1,309 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zgetrf_tntpiv.c, normal z -> d, Sat Oct 17 02:21:04 2026
+ *
+ **/
+
+#include <plasma_core_blas.h>
+#include "core_lapack.h"
+#include "plasma_internal.h"
+#include "plasma_types.h"
+
+#include <stdlib.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup core_getrf
+ *
+ *  Selects pivot rows for tournament pivoting (CALU).
+ *  Performs LU factorization with partial pivoting of a copy of the m-by-n
+ *  matrix A and moves the rows chosen as pivots, in their original form, to
+ *  the top of A in pivot order. The row indices in idx follow the rows.
+ *
+ *  Applied to a single tile, this is the local pivoting of the tile.
+ *  Applied to the candidate rows of two tiles stacked together, this is one
+ *  round of the tournament.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of A. m >= 0.
+ *
+ * @param[in] n
+ *          The number of columns of A. n >= 0.
+ *
+ * @param[in,out] A
+ *          On entry, the m-by-n matrix of candidate rows.
+ *          On exit, the same rows, with the min(m, n) selected rows on top.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ * @param[in,out] idx
+ *          Array of dimension m with the indices of the rows of A,
+ *          permuted along with the rows.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval PlasmaErrorOutOfMemory if the workspace could not be allocated
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int plasma_core_dgetrf_tntpiv(int m, int n,
+                              double *A, int lda, int *idx)
+{
+    int k = imin(m, n);
+    if (k == 0)
+        return PlasmaSuccess;
+
+    double *W =
+        (double*)malloc((size_t)m*n*sizeof(double));
+    int *piv = (int*)malloc(k*sizeof(int));
+    if (W == NULL || piv == NULL) {
+        free(W);
+        free(piv);
+        return PlasmaErrorOutOfMemory;
+    }
+
+    // Only the pivots are kept, a zero column leaves the rows in place.
+    LAPACKE_dlacpy_work(LAPACK_COL_MAJOR, 'F', m, n, A, lda, W, m);
+    LAPACKE_dgetrf_work(LAPACK_COL_MAJOR, m, n, W, m, piv);
+
+    LAPACKE_dlaswp_work(LAPACK_COL_MAJOR, n, A, lda, 1, k, piv, 1);
+    for (int i = 0; i < k; i++) {
+        int p = piv[i]-1;
+        if (p != i) {
+            int tmp = idx[i];
+            idx[i] = idx[p];
+            idx[p] = tmp;
+        }
+    }
+
+    free(W);
+    free(piv);
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *
+ *  LU factorization without pivoting, blocked by ib columns.
+ *  Returns the index of the first zero pivot or 0.
+ *
+ */
+static int plasma_core_dgetrf_nopiv(int m, int n, int ib,
+                                    double *A, int lda)
+{
+    int info = 0;
+    int minmn = imin(m, n);
+    double zone  =  1.0;
+    double zmone = -1.0;
+
+    for (int k = 0; k < minmn; k += ib) {
+        int kb = imin(minmn-k, ib);
+
+        // panel
+        for (int j = k; j < k+kb; j++) {
+            if (A[j+j*lda] == 0.0) {
+                if (info == 0)
+                    info = j+1;
+                continue;
+            }
+            double scal = 1.0/A[j+j*lda];
+            cblas_dscal(m-j-1, (scal), &A[j+1+j*lda], 1);
+            cblas_dger(CblasColMajor,
+                        m-j-1, k+kb-j-1,
+                        (zmone), &A[j+1+j*lda], 1,
+                                            &A[j+(j+1)*lda], lda,
+                                            &A[j+1+(j+1)*lda], lda);
+        }
+
+        // trailing update
+        if (k+kb < n) {
+            cblas_dtrsm(CblasColMajor,
+                        CblasLeft, CblasLower, CblasNoTrans, CblasUnit,
+                        kb, n-k-kb,
+                        (zone), &A[k+k*lda], lda,
+                                           &A[k+(k+kb)*lda], lda);
+            cblas_dgemm(CblasColMajor,
+                        CblasNoTrans, CblasNoTrans,
+                        m-k-kb, n-k-kb, kb,
+                        (zmone), &A[k+kb+k*lda], lda,
+                                            &A[k+(k+kb)*lda], lda,
+                        (zone),  &A[k+kb+(k+kb)*lda], lda);
+        }
+    }
+    return info;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_getrf
+ *
+ *  Applies the pivots selected by the tournament to the diagonal tile
+ *  of the panel and factors it.
+ *  The panel rows are numbered from 0, starting with the m rows of the
+ *  diagonal tile. The k selected rows are moved to the top of the panel
+ *  by a sequence of row interchanges, in the same form as in LAPACK getrf.
+ *  The rows of the diagonal tile displaced to other tiles of the panel are
+ *  saved in W, to be applied by plasma_core_dgetrf_tntpiv_apply().
+ *  Since the selected rows come in pivot order, the tile is then factored
+ *  without further pivoting.
+ *
+ *******************************************************************************
+ *
+ * @param[in] mp
+ *          The number of rows of the panel. mp >= m.
+ *
+ * @param[in] m
+ *          The number of rows of the diagonal tile A. m >= k.
+ *
+ * @param[in] n
+ *          The number of columns of the panel. n >= k.
+ *
+ * @param[in] ib
+ *          The inner blocking size. ib > 0.
+ *
+ * @param[in] k
+ *          The number of selected rows, min(mp, n).
+ *
+ * @param[in] idx
+ *          Array of dimension k with the panel indices of the selected rows,
+ *          in pivot order.
+ *
+ * @param[in,out] W
+ *          On entry, the k selected rows in their original form.
+ *          On exit, row k+j holds the row displaced by the selected row j,
+ *          for each selected row j from outside the diagonal tile.
+ *
+ * @param[in] ldw
+ *          The leading dimension of the array W. ldw >= max(1,2*k).
+ *
+ * @param[out] ipiv
+ *          Array of dimension k with the row interchanges, 1-based
+ *          panel indices.
+ *
+ * @param[in,out] A
+ *          On entry, the m-by-n diagonal tile of the panel.
+ *          On exit, its L and U factors.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ * @param[out] info
+ *          The index of the first zero pivot, or 0.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval PlasmaErrorOutOfMemory if the workspace could not be allocated
+ *
+ ******************************************************************************/
+__attribute__((weak))
+int plasma_core_dgetrf_tntpiv_diag(int mp, int m, int n, int ib, int k,
+                                   const int *idx,
+                                   double *W, int ldw, int *ipiv,
+                                   double *A, int lda, int *info)
+{
+    int *row = (int*)malloc(2*(size_t)mp*sizeof(int));
+    double *T =
+        (double*)malloc((size_t)m*n*sizeof(double));
+    if (row == NULL || T == NULL) {
+        free(row);
+        free(T);
+        return PlasmaErrorOutOfMemory;
+    }
+    // row[i] is the row at position i, pos[r] is the position of row r.
+    int *pos = &row[mp];
+    for (int i = 0; i < mp; i++) {
+        row[i] = i;
+        pos[i] = i;
+    }
+
+    // Convert the selection to a sequence of interchanges.
+    for (int i = 0; i < k; i++) {
+        int p = pos[idx[i]];
+        ipiv[i] = p+1;
+        int r = row[i];
+        row[i] = row[p];
+        row[p] = r;
+        pos[row[i]] = i;
+        pos[row[p]] = p;
+    }
+
+    // Only rows of the diagonal tile are displaced.
+    LAPACKE_dlacpy_work(LAPACK_COL_MAJOR, 'F', m, n, A, lda, T, m);
+    for (int j = 0; j < k; j++)
+        if (idx[j] >= m)
+            cblas_dcopy(n, &T[row[idx[j]]], m, &W[k+j], ldw);
+
+    for (int i = 0; i < m; i++) {
+        if (i < k)
+            cblas_dcopy(n, &W[i], ldw, &A[i], lda);
+        else if (row[i] != i)
+            cblas_dcopy(n, &T[row[i]], m, &A[i], lda);
+    }
+
+    *info = plasma_core_dgetrf_nopiv(m, n, ib, A, lda);
+
+    free(row);
+    free(T);
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_getrf
+ *
+ *  Applies the pivots selected by the tournament to a tile of the panel
+ *  below the diagonal tile, by putting the rows displaced from the diagonal
+ *  tile, saved by plasma_core_dgetrf_tntpiv_diag(), in place of the selected
+ *  rows of the tile.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of rows of the tile A.
+ *
+ * @param[in] n
+ *          The number of columns of the panel.
+ *
+ * @param[in] m0
+ *          The panel index of the first row of A.
+ *
+ * @param[in] k
+ *          The number of selected rows.
+ *
+ * @param[in] idx
+ *          Array of dimension k with the panel indices of the selected rows.
+ *
+ * @param[in] W
+ *          The displaced rows in rows k to 2*k-1,
+ *          as returned by plasma_core_dgetrf_tntpiv_diag().
+ *
+ * @param[in] ldw
+ *          The leading dimension of the array W.
+ *
+ * @param[in,out] A
+ *          The m-by-n tile.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,m).
+ *
+ ******************************************************************************/
+__attribute__((weak))
+void plasma_core_dgetrf_tntpiv_apply(int m, int n, int m0, int k,
+                                     const int *idx,
+                                     const double *W, int ldw,
+                                     double *A, int lda)
+{
+    for (int j = 0; j < k; j++)
+        if (idx[j] >= m0 && idx[j] < m0+m)
+            cblas_dcopy(n, &W[k+j], ldw, &A[idx[j]-m0], lda);
+}
@@ -0,0 +1,548 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zhier.c, normal z -> d, Sat Oct 17 03:04:06 2026
+ *
+ **/
+
+#include <plasma_core_blas.h>
+#include "plasma_hier.h"
+#include "plasma_tile_cache.h"
+#include "plasma_types.h"
+
+#define A(m, n) (double*)plasma_tile_addr(A, m, n)
+#define B(m, n) (double*)plasma_tile_addr(B, m, n)
+#define C(m, n) (double*)plasma_tile_addr(C, m, n)
+
+// The inner kernels run on the OmpCluster workers.
+#pragma omp declare target
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gemm
+ *
+ *  Performs the gemm of outer tiles viewed by plasma_hier_view() as inner
+ *  tiles, with one node-local task per inner tile update:
+ *
+ *    \f[ C = \alpha [op( A )\times op( B )] + \beta C. \f]
+ *
+ *  Must be called by one thread of a parallel region, with k > 0.
+ *  Returns when C is computed.
+ *
+ ******************************************************************************/
+void plasma_core_dhier_gemm(plasma_enum_t transa, plasma_enum_t transb,
+                            double alpha, plasma_desc_t A,
+                                                      plasma_desc_t B,
+                            double beta,  plasma_desc_t C)
+{
+    int kt = transa == PlasmaNoTrans ? A.nt : A.mt;
+
+    for (int m = 0; m < C.mt; m++) {
+        int mvcm = plasma_tile_mview(C, m);
+        for (int n = 0; n < C.nt; n++) {
+            int nvcn = plasma_tile_nview(C, n);
+            double *c = C(m, n);
+            for (int k = 0; k < kt; k++) {
+                int kvak = transa == PlasmaNoTrans ?
+                           plasma_tile_nview(A, k) : plasma_tile_mview(A, k);
+                double *a =
+                    transa == PlasmaNoTrans ? A(m, k) : A(k, m);
+                double *b =
+                    transb == PlasmaNoTrans ? B(k, n) : B(n, k);
+                double zbeta = k == 0 ? beta : 1.0;
+
+                #pragma omp task depend(in:a[0]) \
+                                 depend(in:b[0]) \
+                                 depend(inout:c[0])
+                plasma_core_dgemm(transa, transb,
+                                  mvcm, nvcn, kvak,
+                                  alpha, a, A.ld,
+                                         b, B.ld,
+                                  zbeta, c, C.ld);
+            }
+        }
+    }
+    #pragma omp taskwait
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_trsm
+ *
+ *  Solves the triangular system of outer tiles viewed by plasma_hier_view()
+ *  as inner tiles, with one node-local task per inner tile solve or update:
+ *
+ *    \f[ op( A )\times X  = \alpha B, \f] or
+ *    \f[ X \times op( A ) = \alpha B. \f]
+ *
+ *  Must be called by one thread of a parallel region.
+ *  Returns when X is computed in B.
+ *
+ ******************************************************************************/
+void plasma_core_dhier_trsm(plasma_enum_t side, plasma_enum_t uplo,
+                            plasma_enum_t transa, plasma_enum_t diag,
+                            double alpha, plasma_desc_t A,
+                                                      plasma_desc_t B)
+{
+    const double mzone = -1.0;
+
+    // op( A ) is lower triangular for a lower A not transposed,
+    // or an upper A transposed.
+    int lower = (uplo == PlasmaLower) == (transa == PlasmaNoTrans);
+
+    if (side == PlasmaLeft) {
+        // Solve the tile rows of X forward if op( A ) is lower,
+        // backward otherwise.
+        for (int kk = 0; kk < B.mt; kk++) {
+            int k = lower ? kk : B.mt-1-kk;
+            int mvbk = plasma_tile_mview(B, k);
+            double lalpha = kk == 0 ? alpha : 1.0;
+            double *akk = A(k, k);
+            for (int n = 0; n < B.nt; n++) {
+                int nvbn = plasma_tile_nview(B, n);
+                double *bkn = B(k, n);
+
+                #pragma omp task depend(in:akk[0]) \
+                                 depend(inout:bkn[0])
+                plasma_core_dtrsm(side, uplo, transa, diag,
+                                  mvbk, nvbn,
+                                  lalpha, akk, A.ld,
+                                          bkn, B.ld);
+            }
+            for (int ii = kk+1; ii < B.mt; ii++) {
+                int i = lower ? ii : B.mt-1-ii;
+                int mvbi = plasma_tile_mview(B, i);
+                double *aik =
+                    transa == PlasmaNoTrans ? A(i, k) : A(k, i);
+                for (int n = 0; n < B.nt; n++) {
+                    int nvbn = plasma_tile_nview(B, n);
+                    double *bkn = B(k, n);
+                    double *bin = B(i, n);
+
+                    #pragma omp task depend(in:aik[0]) \
+                                     depend(in:bkn[0]) \
+                                     depend(inout:bin[0])
+                    plasma_core_dgemm(transa, PlasmaNoTrans,
+                                      mvbi, nvbn, mvbk,
+                                      mzone,  aik, A.ld,
+                                              bkn, B.ld,
+                                      lalpha, bin, B.ld);
+                }
+            }
+        }
+    }
+    else {
+        // Solve the tile columns of X forward if op( A ) is upper,
+        // backward otherwise.
+        for (int kk = 0; kk < B.nt; kk++) {
+            int k = lower ? B.nt-1-kk : kk;
+            int nvbk = plasma_tile_nview(B, k);
+            double lalpha = kk == 0 ? alpha : 1.0;
+            double *akk = A(k, k);
+            for (int m = 0; m < B.mt; m++) {
+                int mvbm = plasma_tile_mview(B, m);
+                double *bmk = B(m, k);
+
+                #pragma omp task depend(in:akk[0]) \
+                                 depend(inout:bmk[0])
+                plasma_core_dtrsm(side, uplo, transa, diag,
+                                  mvbm, nvbk,
+                                  lalpha, akk, A.ld,
+                                          bmk, B.ld);
+            }
+            for (int jj = kk+1; jj < B.nt; jj++) {
+                int j = lower ? B.nt-1-jj : jj;
+                int nvbj = plasma_tile_nview(B, j);
+                double *akj =
+                    transa == PlasmaNoTrans ? A(k, j) : A(j, k);
+                for (int m = 0; m < B.mt; m++) {
+                    int mvbm = plasma_tile_mview(B, m);
+                    double *bmk = B(m, k);
+                    double *bmj = B(m, j);
+
+                    #pragma omp task depend(in:akj[0]) \
+                                     depend(in:bmk[0]) \
+                                     depend(inout:bmj[0])
+                    plasma_core_dgemm(PlasmaNoTrans, transa,
+                                      mvbm, nvbj, nvbk,
+                                      mzone,  bmk, B.ld,
+                                              akj, A.ld,
+                                      lalpha, bmj, B.ld);
+                }
+            }
+        }
+    }
+    #pragma omp taskwait
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_syrk
+ *
+ *  Performs the symmetric rank-k update of outer tiles viewed by
+ *  plasma_hier_view() as inner tiles, with one node-local task per inner
+ *  tile update of the uplo triangle of C:
+ *
+ *    \f[ C = \alpha A \times A^T + \beta C, \f] or
+ *    \f[ C = \alpha A^T \times A + \beta C. \f]
+ *
+ *  Must be called by one thread of a parallel region, with k > 0.
+ *  Returns when C is computed.
+ *
+ ******************************************************************************/
+void plasma_core_dhier_syrk(plasma_enum_t uplo, plasma_enum_t trans,
+                            double alpha, plasma_desc_t A,
+                            double beta,  plasma_desc_t C)
+{
+    int kt = trans == PlasmaNoTrans ? A.nt : A.mt;
+
+    for (int n = 0; n < C.nt; n++) {
+        int nvcn = plasma_tile_nview(C, n);
+        int mbeg = uplo == PlasmaLower ? n : 0;
+        int mend = uplo == PlasmaLower ? C.mt : n+1;
+        for (int m = mbeg; m < mend; m++) {
+            int mvcm = plasma_tile_mview(C, m);
+            double *c = C(m, n);
+            for (int k = 0; k < kt; k++) {
+                int kvak = trans == PlasmaNoTrans ?
+                           plasma_tile_nview(A, k) : plasma_tile_mview(A, k);
+                double *am =
+                    trans == PlasmaNoTrans ? A(m, k) : A(k, m);
+                double *an =
+                    trans == PlasmaNoTrans ? A(n, k) : A(k, n);
+                double zbeta = k == 0 ? beta : 1.0;
+
+                if (m == n) {
+                    #pragma omp task depend(in:an[0]) \
+                                     depend(inout:c[0])
+                    plasma_core_dsyrk(uplo, trans,
+                                      nvcn, kvak,
+                                      alpha, an, A.ld,
+                                      zbeta, c,  C.ld);
+                }
+                else {
+                    #pragma omp task depend(in:am[0]) \
+                                     depend(in:an[0]) \
+                                     depend(inout:c[0])
+                    plasma_core_dgemm(
+                        trans == PlasmaNoTrans ? PlasmaNoTrans : PlasmaTrans,
+                        trans == PlasmaNoTrans ? PlasmaTrans : PlasmaNoTrans,
+                        mvcm, nvcn, kvak,
+                        alpha, am, A.ld,
+                               an, A.ld,
+                        zbeta, c,  C.ld);
+                }
+            }
+        }
+    }
+    #pragma omp taskwait
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_potrf
+ *
+ *  Performs the Cholesky factorization of an outer tile viewed by
+ *  plasma_hier_view() as inner tiles, right-looking, with one node-local
+ *  task per inner tile factorization, solve or update.
+ *
+ *  Must be called by one thread of a parallel region.
+ *  Returns when A is factored.
+ *
+ * @retval 0 on success.
+ * @retval > 0 if i, the leading minor of order i is not positive definite.
+ *
+ ******************************************************************************/
+int plasma_core_dhier_potrf(plasma_enum_t uplo, plasma_desc_t A)
+{
+    const double mzone = -1.0;
+    const double zone  = 1.0;
+    int info = 0;
+
+    for (int k = 0; k < A.mt; k++) {
+        int mvak = plasma_tile_mview(A, k);
+        double *akk = A(k, k);
+
+        #pragma omp task depend(inout:akk[0]) shared(info)
+        {
+            if (info == 0) {
+                int iinfo = plasma_core_dpotrf(uplo, mvak, akk, A.ld);
+                if (iinfo != 0)
+                    info = k*A.mb+iinfo;
+            }
+        }
+        if (uplo == PlasmaLower) {
+            for (int m = k+1; m < A.mt; m++) {
+                int mvam = plasma_tile_mview(A, m);
+                double *amk = A(m, k);
+
+                #pragma omp task depend(in:akk[0]) \
+                                 depend(inout:amk[0])
+                plasma_core_dtrsm(PlasmaRight, PlasmaLower,
+                                  PlasmaConjTrans, PlasmaNonUnit,
+                                  mvam, mvak,
+                                  zone, akk, A.ld,
+                                        amk, A.ld);
+            }
+            for (int m = k+1; m < A.mt; m++) {
+                int mvam = plasma_tile_mview(A, m);
+                double *amk = A(m, k);
+                double *amm = A(m, m);
+
+                #pragma omp task depend(in:amk[0]) \
+                                 depend(inout:amm[0])
+                plasma_core_dsyrk(PlasmaLower, PlasmaNoTrans,
+                                  mvam, mvak,
+                                  -1.0, amk, A.ld,
+                                   1.0, amm, A.ld);
+
+                for (int n = k+1; n < m; n++) {
+                    int mvan = plasma_tile_mview(A, n);
+                    double *ank = A(n, k);
+                    double *amn = A(m, n);
+
+                    #pragma omp task depend(in:amk[0]) \
+                                     depend(in:ank[0]) \
+                                     depend(inout:amn[0])
+                    plasma_core_dgemm(PlasmaNoTrans, PlasmaConjTrans,
+                                      mvam, mvan, mvak,
+                                      mzone, amk, A.ld,
+                                             ank, A.ld,
+                                      zone,  amn, A.ld);
+                }
+            }
+        }
+        else {
+            for (int n = k+1; n < A.nt; n++) {
+                int nvan = plasma_tile_nview(A, n);
+                double *akn = A(k, n);
+
+                #pragma omp task depend(in:akk[0]) \
+                                 depend(inout:akn[0])
+                plasma_core_dtrsm(PlasmaLeft, PlasmaUpper,
+                                  PlasmaConjTrans, PlasmaNonUnit,
+                                  mvak, nvan,
+                                  zone, akk, A.ld,
+                                        akn, A.ld);
+            }
+            for (int n = k+1; n < A.nt; n++) {
+                int nvan = plasma_tile_nview(A, n);
+                double *akn = A(k, n);
+                double *ann = A(n, n);
+
+                #pragma omp task depend(in:akn[0]) \
+                                 depend(inout:ann[0])
+                plasma_core_dsyrk(PlasmaUpper, PlasmaConjTrans,
+                                  nvan, mvak,
+                                  -1.0, akn, A.ld,
+                                   1.0, ann, A.ld);
+
+                for (int m = k+1; m < n; m++) {
+                    int mvam = plasma_tile_mview(A, m);
+                    double *akm = A(k, m);
+                    double *amn = A(m, n);
+
+                    #pragma omp task depend(in:akm[0]) \
+                                     depend(in:akn[0]) \
+                                     depend(inout:amn[0])
+                    plasma_core_dgemm(PlasmaConjTrans, PlasmaNoTrans,
+                                      mvam, nvan, mvak,
+                                      mzone, akm, A.ld,
+                                             akn, A.ld,
+                                      zone,  amn, A.ld);
+                }
+            }
+        }
+    }
+    #pragma omp taskwait
+    return info;
+}
+
+#pragma omp end declare target
+
+/***************************************************************************//**
+ *
+ *  Offloads the gemm of an outer tile to an OmpCluster worker, which splits
+ *  it into inner tiles of size PLASMA_HIER_NB. Within plasma_tile_cache_begin()
+ *  and plasma_tile_cache_end(), runs on the worker holding C, and only
+ *  transfers the tiles not valid on that worker.
+ *
+ ******************************************************************************/
+void plasma_core_omp_dhier_gemm(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k,
+    double alpha, const double *A, int lda,
+                              const double *B, int ldb,
+    double beta,        double *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    int ak = transa == PlasmaNoTrans ? k : m;
+    int bk = transb == PlasmaNoTrans ? n : k;
+
+    if (sequence->status == PlasmaSuccess) {
+        int device = plasma_tile_cache_device(C);
+        plasma_tile_cache_acquire(A, sizeof(double)*lda*ak,
+                                  device, 0);
+        plasma_tile_cache_acquire(B, sizeof(double)*ldb*bk,
+                                  device, 0);
+        plasma_tile_cache_acquire(C, sizeof(double)*ldc*n,
+                                  device, 1);
+
+        #pragma omp target nowait device(device) \
+                           depend(in:A[0:lda*ak]) \
+                           depend(in:B[0:ldb*bk]) \
+                           depend(inout:C[0:ldc*n]) \
+                           map(to:A[0:lda*ak], B[0:ldb*bk]) \
+                           map(tofrom:C[0:ldc*n]) \
+                           firstprivate(transa, transb, m, n, k) \
+                           firstprivate(alpha, lda, ldb, beta, ldc)
+        {
+            plasma_desc_t Ah = plasma_hier_view(
+                PlasmaRealDouble, (void*)A, lda,
+                transa == PlasmaNoTrans ? m : k, ak, PLASMA_HIER_NB);
+            plasma_desc_t Bh = plasma_hier_view(
+                PlasmaRealDouble, (void*)B, ldb,
+                transb == PlasmaNoTrans ? k : n, bk, PLASMA_HIER_NB);
+            plasma_desc_t Ch = plasma_hier_view(
+                PlasmaRealDouble, C, ldc, m, n, PLASMA_HIER_NB);
+
+            #pragma omp parallel
+            #pragma omp single
+            plasma_core_dhier_gemm(transa, transb, alpha, Ah, Bh, beta, Ch);
+        }
+    }
+}
+
+/***************************************************************************//**
+ *
+ *  Offloads the triangular solve of an outer tile to an OmpCluster worker,
+ *  which splits it into inner tiles of size PLASMA_HIER_NB.
+ *
+ ******************************************************************************/
+void plasma_core_omp_dhier_trsm(
+    plasma_enum_t side, plasma_enum_t uplo,
+    plasma_enum_t transa, plasma_enum_t diag,
+    int m, int n,
+    double alpha, const double *A, int lda,
+                                    double *B, int ldb,
+    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    int ak = side == PlasmaLeft ? m : n;
+
+    if (sequence->status == PlasmaSuccess) {
+        int device = plasma_tile_cache_device(B);
+        plasma_tile_cache_acquire(A, sizeof(double)*lda*ak,
+                                  device, 0);
+        plasma_tile_cache_acquire(B, sizeof(double)*ldb*n,
+                                  device, 1);
+
+        #pragma omp target nowait device(device) \
+                           depend(in:A[0:lda*ak]) \
+                           depend(inout:B[0:ldb*n]) \
+                           map(to:A[0:lda*ak]) \
+                           map(tofrom:B[0:ldb*n]) \
+                           firstprivate(side, uplo, transa, diag) \
+                           firstprivate(m, n, alpha, lda, ldb)
+        {
+            plasma_desc_t Ah = plasma_hier_view(
+                PlasmaRealDouble, (void*)A, lda, ak, ak, PLASMA_HIER_NB);
+            plasma_desc_t Bh = plasma_hier_view(
+                PlasmaRealDouble, B, ldb, m, n, PLASMA_HIER_NB);
+
+            #pragma omp parallel
+            #pragma omp single
+            plasma_core_dhier_trsm(side, uplo, transa, diag, alpha, Ah, Bh);
+        }
+    }
+}
+
+/***************************************************************************//**
+ *
+ *  Offloads the symmetric rank-k update of an outer tile to an OmpCluster
+ *  worker, which splits it into inner tiles of size PLASMA_HIER_NB.
+ *
+ ******************************************************************************/
+void plasma_core_omp_dhier_syrk(
+    plasma_enum_t uplo, plasma_enum_t trans,
+    int n, int k,
+    double alpha, const double *A, int lda,
+    double beta,        double *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    int ak = trans == PlasmaNoTrans ? k : n;
+
+    if (sequence->status == PlasmaSuccess) {
+        int device = plasma_tile_cache_device(C);
+        plasma_tile_cache_acquire(A, sizeof(double)*lda*ak,
+                                  device, 0);
+        plasma_tile_cache_acquire(C, sizeof(double)*ldc*n,
+                                  device, 1);
+
+        #pragma omp target nowait device(device) \
+                           depend(in:A[0:lda*ak]) \
+                           depend(inout:C[0:ldc*n]) \
+                           map(to:A[0:lda*ak]) \
+                           map(tofrom:C[0:ldc*n]) \
+                           firstprivate(uplo, trans, n, k) \
+                           firstprivate(alpha, lda, beta, ldc)
+        {
+            plasma_desc_t Ah = plasma_hier_view(
+                PlasmaRealDouble, (void*)A, lda,
+                trans == PlasmaNoTrans ? n : k, ak, PLASMA_HIER_NB);
+            plasma_desc_t Ch = plasma_hier_view(
+                PlasmaRealDouble, C, ldc, n, n, PLASMA_HIER_NB);
+
+            #pragma omp parallel
+            #pragma omp single
+            plasma_core_dhier_syrk(uplo, trans, alpha, Ah, beta, Ch);
+        }
+    }
+}
+
+/***************************************************************************//**
+ *
+ *  Offloads the Cholesky factorization of an outer tile to an OmpCluster
+ *  worker, which splits it into inner tiles of size PLASMA_HIER_NB.
+ *  The offload is synchronous within a host task, which reports the failure
+ *  of the factorization to the sequence.
+ *
+ ******************************************************************************/
+void plasma_core_omp_dhier_potrf(plasma_enum_t uplo,
+                                 int n,
+                                 double *A, int lda,
+                                 int iinfo,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request)
+{
+    int device = plasma_tile_cache_device(A);
+    if (sequence->status == PlasmaSuccess)
+        plasma_tile_cache_acquire(A, sizeof(double)*lda*n,
+                                  device, 1);
+
+    #pragma omp task depend(inout:A[0:lda*n])
+    {
+        if (sequence->status == PlasmaSuccess) {
+            int info = 0;
+
+            #pragma omp target device(device) \
+                               map(tofrom:A[0:lda*n]) \
+                               map(from:info) \
+                               firstprivate(uplo, n, lda)
+            {
+                plasma_desc_t Ah = plasma_hier_view(
+                    PlasmaRealDouble, A, lda, n, n, PLASMA_HIER_NB);
+
+                #pragma omp parallel
+                #pragma omp single
+                info = plasma_core_dhier_potrf(uplo, Ah);
+            }
+            if (info != 0)
+                plasma_request_fail(sequence, request, iinfo+info);
+        }
+    }
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/core_blas/core_zlacpy_band.c, normal z -> d, Fri Sep 28 17:38:19 2018
+ * @generated from core_blas/core_zlacpy_band.c, normal z -> d, Sat Oct 17 02:49:18 2026
  *
  **/
 
@@ -120,10 +120,16 @@ void plasma_core_omp_dlacpy_lapack2tile_band(plasma_enum_t uplo,
 {
     #pragma omp task depend(in:A[0:lda*n]) \
                      depend(out:B[0:ldb*n])
-    plasma_core_dlacpy_lapack2tile_band(uplo,
-                                 it, jt, m, n, nb, kl, ku,
-                                 A, lda,
-                                 B, ldb);
+    {
+        plasma_time_t start = plasma_stats_start();
+        plasma_core_dlacpy_lapack2tile_band(uplo,
+                                     it, jt, m, n, nb, kl, ku,
+                                     A, lda,
+                                     B, ldb);
+        plasma_trace_tiles("rw", (const void*[]){A, B});
+        plasma_stats_stop(PlasmaStatsAux, PlasmaRealDouble, start,
+                          0.0, 2.0*m*n);
+    }
 }
 
 /*******************************************************************************
@@ -217,8 +223,14 @@ void plasma_core_omp_dlacpy_tile2lapack_band(plasma_enum_t uplo,
 {
     #pragma omp task depend(in:B[0:ldb*n]) \
                      depend(out:A[0:lda*n])
-    plasma_core_dlacpy_tile2lapack_band(uplo,
-                                 it, jt, m, n, nb, kl, ku,
-                                 B, ldb,
-                                 A, lda);
+    {
+        plasma_time_t start = plasma_stats_start();
+        plasma_core_dlacpy_tile2lapack_band(uplo,
+                                     it, jt, m, n, nb, kl, ku,
+                                     B, ldb,
+                                     A, lda);
+        plasma_trace_tiles("rw", (const void*[]){B, A});
+        plasma_stats_stop(PlasmaStatsAux, PlasmaRealDouble, start,
+                          0.0, 2.0*m*n);
+    }
 }
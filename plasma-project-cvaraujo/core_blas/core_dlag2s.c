@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/core_blas/core_zlag2c.c, mixed zc -> ds, Fri Sep 28 17:38:26 2018
+ * @generated from core_blas/core_zlag2c.c, mixed zc -> ds, Sat Oct 17 02:49:18 2026
  *
  **/
 
@@ -62,7 +62,12 @@ void plasma_core_omp_dlag2s(int m, int n,
     #pragma omp task depend(in:A[0:lda*n]) \
                      depend(out:As[0:ldas*n])
     {
-        if (sequence->status == PlasmaSuccess)
+        if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             plasma_core_dlag2s(m, n, A, lda, As, ldas);
+            plasma_trace_tiles("rw", (const void*[]){A, As});
+            plasma_stats_stop(PlasmaStatsAux, PlasmaRealDouble, start,
+                              0.0, 2.0*m*n);
+        }
     }
 }
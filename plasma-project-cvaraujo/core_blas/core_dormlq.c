@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/core_blas/core_zunmlq.c, normal z -> d, Fri Sep 28 17:38:25 2018
+ * @generated from core_blas/core_zunmlq.c, normal z -> d, Sat Oct 17 02:49:19 2026
  *
  **/
 
@@ -255,6 +255,7 @@ void plasma_core_omp_dormlq(plasma_enum_t side, plasma_enum_t trans,
                      depend(inout:C[0:ldc*n])
     {
         if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             // Prepare workspaces.
             int tid = omp_get_thread_num();
             double *W = (double*)work.spaces[tid];
@@ -272,6 +273,9 @@ void plasma_core_omp_dormlq(plasma_enum_t side, plasma_enum_t trans,
                 plasma_error("core_dormlq() failed");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
+            plasma_trace_tiles("rrw", (const void*[]){A, T, C});
+            plasma_stats_stop(PlasmaStatsUnmqr, PlasmaRealDouble, start,
+                              4.0*m*n*k, 2.0*m*n+1.0*ak*k);
         }
     }
 }
@@ -0,0 +1,384 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zpotrf_update.c, normal z -> d, Sat Oct 17 04:06:29 2026
+ *
+ **/
+
+#include <plasma_core_blas.h>
+#include "plasma_types.h"
+#include "plasma_graph.h"
+#include "plasma_internal.h"
+#include "plasma_tile_cache.h"
+
+#include <math.h>
+
+// Number of rotations applied at a time to the tiles of U,
+// and number of columns of the tiles of U they are applied to at a time.
+#define PLASMA_UPDATE_CHUNK 64
+#define PLASMA_UPDATE_COLS  16
+
+/***************************************************************************//**
+ *
+ * @ingroup core_potrf
+ *
+ *  Modifies the Cholesky factor of a diagonal tile of a symmetric positive
+ *  definite matrix A for the rank-k modification
+ *
+ *    \f[ A + \sigma V \times V^T, \f]
+ *
+ *  where sigma = 1 for an update and sigma = -1 for a downdate.
+ *  Each column (row) j of the factor is rotated in turn against every
+ *  column of V, with Givens rotations for an update, or hyperbolic rotations
+ *  for a downdate, that zero row j of V.
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: A holds the factor U of A = U^T*U;
+ *          - PlasmaLower: A holds the factor L of A = L*L^T.
+ *
+ * @param[in] sigma
+ *          - 1.0: update A + V*V^T;
+ *          - -1.0: downdate A - V*V^T.
+ *
+ * @param[in] n
+ *          The order of the tile A. n >= 0.
+ *
+ * @param[in] k
+ *          The number of columns of the tile V. k >= 0.
+ *
+ * @param[in,out] A
+ *          On entry, the n-by-n triangular factor of the tile.
+ *          On exit, the modified factor.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A. lda >= max(1,n).
+ *
+ * @param[in,out] V
+ *          On entry, the n-by-k tile of the modification.
+ *          On exit, the sines of the rotations, to be applied to the tiles
+ *          below (right of) A by plasma_core_dpotrf_update_apply().
+ *
+ * @param[in] ldv
+ *          The leading dimension of the array V. ldv >= max(1,n).
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ * @retval > 0 if i, the leading minor of order i of the downdated tile
+ *         is not positive definite.
+ *
+ ******************************************************************************/
+int plasma_core_dpotrf_update(plasma_enum_t uplo, double sigma,
+                              int n, int k,
+                              double *A, int lda,
+                              double *V, int ldv)
+{
+    for (int j = 0; j < n; j++) {
+        for (int p = 0; p < k; p++) {
+            double *x = &V[(size_t)ldv*p];
+            double ajj = creal(A[j+(size_t)lda*j]);
+            double s = x[j]/ajj;
+            double abss = fabs(s);
+            double c2 = 1.0+sigma*abss*abss;
+            if (c2 <= 0.0)
+                return j+1;
+
+            double c = sqrt(c2);
+            A[j+(size_t)lda*j] = c*ajj;
+            double rc = 1.0/c;
+            double t = sigma*(s)*rc;
+            double u = s*rc;
+            if (uplo == PlasmaLower) {
+                for (int i = j+1; i < n; i++) {
+                    double a = A[i+(size_t)lda*j];
+                    A[i+(size_t)lda*j] = rc*a + t*x[i];
+                    x[i] = rc*x[i] - u*a;
+                }
+            }
+            else {
+                for (int i = j+1; i < n; i++) {
+                    double a = A[j+(size_t)lda*i];
+                    A[j+(size_t)lda*i] = rc*a + (t*x[i]);
+                    x[i] = rc*x[i] - u*(a);
+                }
+            }
+            // Row j of x is now zero, keep the sine in its place.
+            x[j] = s;
+        }
+    }
+    return PlasmaSuccess;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_potrf
+ *
+ *  Applies the rotations of plasma_core_dpotrf_update() on a diagonal tile
+ *  to a tile of the same tile column (row) of the factor, see
+ *  plasma_core_dpotrf_update().
+ *
+ *******************************************************************************
+ *
+ * @param[in] uplo
+ *          - PlasmaUpper: A is a tile of the factor U, right of the diagonal
+ *                         tile;
+ *          - PlasmaLower: A is a tile of the factor L, below the diagonal
+ *                         tile.
+ *
+ * @param[in] sigma
+ *          - 1.0: update A + V*V^T;
+ *          - -1.0: downdate A - V*V^T.
+ *
+ * @param[in] m
+ *          The number of rows of the tile Vi. m >= 0.
+ *
+ * @param[in] n
+ *          The order of the diagonal tile. n >= 0.
+ *
+ * @param[in] k
+ *          The number of columns of the tiles Vj and Vi. k >= 0.
+ *
+ * @param[in,out] A
+ *          On entry, the m-by-n tile of L, or the n-by-m tile of U.
+ *          On exit, the modified tile.
+ *
+ * @param[in] lda
+ *          The leading dimension of the array A.
+ *          lda >= max(1,m) if lower, lda >= max(1,n) if upper.
+ *
+ * @param[in] Vj
+ *          The n-by-k sines computed by plasma_core_dpotrf_update().
+ *
+ * @param[in] ldvj
+ *          The leading dimension of the array Vj. ldvj >= max(1,n).
+ *
+ * @param[in,out] Vi
+ *          On entry, the m-by-k tile of the modification in the rows of A
+ *          (columns of A if upper). On exit, the tile with the rotations
+ *          applied.
+ *
+ * @param[in] ldvi
+ *          The leading dimension of the array Vi. ldvi >= max(1,m).
+ *
+ ******************************************************************************/
+void plasma_core_dpotrf_update_apply(plasma_enum_t uplo, double sigma,
+                                     int m, int n, int k,
+                                           double *A, int lda,
+                                     const double *Vj, int ldvj,
+                                           double *Vi, int ldvi)
+{
+    if (uplo == PlasmaLower) {
+        for (int j = 0; j < n; j++) {
+            for (int p = 0; p < k; p++) {
+                double *x = &Vi[(size_t)ldvi*p];
+                double s = Vj[j+(size_t)ldvj*p];
+                double abss = fabs(s);
+                double rc = 1.0/sqrt(1.0+sigma*abss*abss);
+                double t = sigma*(s)*rc;
+                double u = s*rc;
+                double *a = &A[(size_t)lda*j];
+                for (int i = 0; i < m; i++) {
+                    double aij = a[i];
+                    a[i] = rc*aij + t*x[i];
+                    x[i] = rc*x[i] - u*aij;
+                }
+            }
+        }
+    }
+    else {
+        // The rows of A are strided, so the rotations are applied
+        // by chunks to a few columns of A at a time.
+        int jr[PLASMA_UPDATE_CHUNK];
+        double *xr[PLASMA_UPDATE_CHUNK];
+        double rc[PLASMA_UPDATE_CHUNK];
+        double t[PLASMA_UPDATE_CHUNK];
+        double u[PLASMA_UPDATE_CHUNK];
+        for (int r0 = 0; r0 < n*k; r0 += PLASMA_UPDATE_CHUNK) {
+            int nr = imin(PLASMA_UPDATE_CHUNK, n*k-r0);
+            for (int r = 0; r < nr; r++) {
+                int j = (r0+r)/k;
+                int p = (r0+r)%k;
+                double s = Vj[j+(size_t)ldvj*p];
+                double abss = fabs(s);
+                jr[r] = j;
+                xr[r] = &Vi[(size_t)ldvi*p];
+                rc[r] = 1.0/sqrt(1.0+sigma*abss*abss);
+                t[r] = sigma*(s)*rc[r];
+                u[r] = s*rc[r];
+            }
+            for (int i0 = 0; i0 < m; i0 += PLASMA_UPDATE_COLS) {
+                int ib = imin(PLASMA_UPDATE_COLS, m-i0);
+                double *a = &A[(size_t)lda*i0];
+                for (int r = 0; r < nr; r++) {
+                    double *x = &xr[r][i0];
+                    for (int i = 0; i < ib; i++) {
+                        double aji = a[jr[r]+(size_t)lda*i];
+                        a[jr[r]+(size_t)lda*i] = rc[r]*aji + (t[r]*x[i]);
+                        x[i] = rc[r]*x[i] - u[r]*(aji);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/******************************************************************************/
+typedef struct {
+    plasma_enum_t uplo;
+    double sigma;
+    int n;
+    int k;
+    int lda;
+    int ldv;
+    int iinfo;
+} plasma_core_dpotrf_update_args_t;
+
+/******************************************************************************/
+static void plasma_core_dpotrf_update_graph(const void *args_, void **tiles,
+                                            plasma_sequence_t *sequence,
+                                            plasma_request_t *request)
+{
+    const plasma_core_dpotrf_update_args_t *args =
+        (const plasma_core_dpotrf_update_args_t*)args_;
+    plasma_time_t start = plasma_stats_start();
+    int info = plasma_core_dpotrf_update(args->uplo, args->sigma,
+                                         args->n, args->k,
+                                         tiles[0], args->lda,
+                                         tiles[1], args->ldv);
+    if (info != 0)
+        plasma_request_fail(sequence, request, args->iinfo+info);
+    plasma_trace_tiles("ww", (const void*[]){tiles[0], tiles[1]});
+    plasma_stats_stop(PlasmaStatsPotrfUpdate, PlasmaRealDouble, start,
+                      3.0*args->n*args->n*args->k,
+                      1.0*args->n*args->n+2.0*args->n*args->k);
+}
+
+/******************************************************************************/
+void plasma_core_omp_dpotrf_update(plasma_enum_t uplo, double sigma,
+                                   int n, int k,
+                                   double *A, int lda,
+                                   double *V, int ldv,
+                                   int iinfo,
+                                   plasma_sequence_t *sequence,
+                                   plasma_request_t *request)
+{
+    if (plasma_graph_capturing()) {
+        plasma_core_dpotrf_update_args_t args = {
+            uplo, sigma, n, k, lda, ldv, iinfo
+        };
+        const void *tiles[] = {A, V};
+        const int write[] = {1, 1};
+        plasma_graph_record(plasma_core_dpotrf_update_graph,
+                            &args, sizeof(args), 2, tiles, write);
+        return;
+    }
+
+    plasma_tile_cache_host(A, sizeof(double)*lda*n, 1);
+    plasma_tile_cache_host(V, sizeof(double)*ldv*k, 1);
+
+    #pragma omp task depend(inout:A[0:lda*n]) \
+                     depend(inout:V[0:ldv*k]) \
+                     affinity(A[0:lda*n]) \
+                     priority(plasma_task_priority())
+    {
+        if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
+            int info = plasma_core_dpotrf_update(uplo, sigma,
+                                                 n, k,
+                                                 A, lda,
+                                                 V, ldv);
+            if (info != 0)
+                plasma_request_fail(sequence, request, iinfo+info);
+            plasma_trace_tiles("ww", (const void*[]){A, V});
+            plasma_stats_stop(PlasmaStatsPotrfUpdate, PlasmaRealDouble,
+                              start, 3.0*n*n*k, 1.0*n*n+2.0*n*k);
+        }
+    }
+}
+
+/******************************************************************************/
+typedef struct {
+    plasma_enum_t uplo;
+    double sigma;
+    int m;
+    int n;
+    int k;
+    int lda;
+    int ldvj;
+    int ldvi;
+} plasma_core_dpotrf_update_apply_args_t;
+
+/******************************************************************************/
+static void plasma_core_dpotrf_update_apply_graph(const void *args_,
+                                                  void **tiles,
+                                                  plasma_sequence_t *sequence,
+                                                  plasma_request_t *request)
+{
+    const plasma_core_dpotrf_update_apply_args_t *args =
+        (const plasma_core_dpotrf_update_apply_args_t*)args_;
+    plasma_time_t start = plasma_stats_start();
+    plasma_core_dpotrf_update_apply(args->uplo, args->sigma,
+                                    args->m, args->n, args->k,
+                                    tiles[0], args->lda,
+                                    tiles[1], args->ldvj,
+                                    tiles[2], args->ldvi);
+    plasma_trace_tiles("wrw", (const void*[]){tiles[0], tiles[1], tiles[2]});
+    plasma_stats_stop(PlasmaStatsPotrfUpdate, PlasmaRealDouble, start,
+                      6.0*args->m*args->n*args->k,
+                      2.0*args->m*args->n+1.0*args->n*args->k+
+                      2.0*args->m*args->k);
+}
+
+/******************************************************************************/
+void plasma_core_omp_dpotrf_update_apply(
+    plasma_enum_t uplo, double sigma,
+    int m, int n, int k,
+          double *A, int lda,
+    const double *Vj, int ldvj,
+          double *Vi, int ldvi,
+    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    if (plasma_graph_capturing()) {
+        plasma_core_dpotrf_update_apply_args_t args = {
+            uplo, sigma, m, n, k, lda, ldvj, ldvi
+        };
+        const void *tiles[] = {A, Vj, Vi};
+        const int write[] = {1, 0, 1};
+        plasma_graph_record(plasma_core_dpotrf_update_apply_graph,
+                            &args, sizeof(args), 3, tiles, write);
+        return;
+    }
+
+    int an = uplo == PlasmaLower ? n : m;
+
+    plasma_tile_cache_host(A, sizeof(double)*lda*an, 1);
+    plasma_tile_cache_host(Vj, sizeof(double)*ldvj*k, 0);
+    plasma_tile_cache_host(Vi, sizeof(double)*ldvi*k, 1);
+
+    #pragma omp task depend(inout:A[0:lda*an]) \
+                     depend(in:Vj[0:ldvj*k]) \
+                     depend(inout:Vi[0:ldvi*k]) \
+                     affinity(A[0:lda*an]) \
+                     priority(plasma_task_priority())
+    {
+        if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
+            plasma_core_dpotrf_update_apply(uplo, sigma,
+                                            m, n, k,
+                                            A, lda,
+                                            Vj, ldvj,
+                                            Vi, ldvi);
+            plasma_trace_tiles("wrw", (const void*[]){A, Vj, Vi});
+            plasma_stats_stop(PlasmaStatsPotrfUpdate, PlasmaRealDouble,
+                              start, 6.0*m*n*k,
+                              2.0*m*n+1.0*n*k+2.0*m*k);
+        }
+    }
+}
@@ -0,0 +1,552 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+
+#include <plasma_core_blas.h>
+#include "plasma_core_simd.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+#if defined(PLASMA_WITH_SIMD) && defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+/******************************************************************************/
+// Instruction set of the kernels, -1 until detected.
+static int simd_isa = -1;
+
+/******************************************************************************/
+static int plasma_core_simd_detect()
+{
+#if defined(PLASMA_WITH_SIMD) && defined(__x86_64__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+        return PlasmaSimdAvx512;
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        return PlasmaSimdAvx2;
+#endif
+    return PlasmaSimdNone;
+}
+
+/***************************************************************************//**
+ *
+ *  Returns the instruction set of the tile kernels, PlasmaSimdNone if they
+ *  call CBLAS.
+ *
+ */
+int plasma_core_simd_isa()
+{
+    // Racing threads detect the same instruction set.
+    if (simd_isa < 0)
+        simd_isa = plasma_core_simd_detect();
+    return simd_isa;
+}
+
+/***************************************************************************//**
+ *
+ *  Sets the instruction set of the tile kernels, capped to the one detected.
+ *  Must not be called while kernels run.
+ *
+ */
+void plasma_core_simd_set_isa(int isa)
+{
+    int detected = plasma_core_simd_detect();
+    simd_isa = isa < detected ? isa : detected;
+}
+
+#if defined(PLASMA_WITH_SIMD) && defined(__x86_64__)
+
+/******************************************************************************/
+// Blocking of the inner dimension, so that the packed panel of B
+// stays in the L1 cache.
+#define PLASMA_SIMD_KC 256
+
+// Largest micro-tile over the kernels.
+#define PLASMA_SIMD_MR 16
+#define PLASMA_SIMD_NR 8
+
+// Size of the diagonal blocks solved by trsm without the micro-kernels.
+#define PLASMA_SIMD_TRSM_NB 16
+
+/***************************************************************************//**
+ *
+ *  Micro-kernel computing C = alpha*A*B + beta*C for an mr-by-nr block C,
+ *  with the leading dimension ldc, an mr-by-k column-major panel A, with
+ *  the leading dimension lda, and a k-by-nr panel B packed by rows.
+ *  C is not read if beta is zero.
+ *
+ */
+typedef void (*plasma_core_dsimd_kernel_t)(int k, const double *A, int lda,
+                                           const double *B,
+                                           double alpha, double beta,
+                                           double *C, int ldc);
+
+/******************************************************************************/
+__attribute__((target("avx2,fma")))
+static inline void plasma_core_dsimd_store_avx2(double *C, __m256d ab,
+                                                __m256d alpha, __m256d beta,
+                                                int load)
+{
+    ab = _mm256_mul_pd(alpha, ab);
+    if (load)
+        ab = _mm256_fmadd_pd(beta, _mm256_loadu_pd(C), ab);
+    _mm256_storeu_pd(C, ab);
+}
+
+/******************************************************************************/
+__attribute__((target("avx2,fma")))
+static void plasma_core_dsimd_kernel_avx2(int k, const double *A, int lda,
+                                          const double *B,
+                                          double alpha, double beta,
+                                          double *C, int ldc)
+{
+    __m256d c00 = _mm256_setzero_pd(), c01 = _mm256_setzero_pd();
+    __m256d c10 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+    __m256d c20 = _mm256_setzero_pd(), c21 = _mm256_setzero_pd();
+    __m256d c30 = _mm256_setzero_pd(), c31 = _mm256_setzero_pd();
+    __m256d c40 = _mm256_setzero_pd(), c41 = _mm256_setzero_pd();
+    __m256d c50 = _mm256_setzero_pd(), c51 = _mm256_setzero_pd();
+
+    for (int p = 0; p < k; p++) {
+        __m256d a0 = _mm256_loadu_pd(&A[p*lda]);
+        __m256d a1 = _mm256_loadu_pd(&A[p*lda+4]);
+        __m256d b;
+        b = _mm256_broadcast_sd(&B[6*p+0]);
+        c00 = _mm256_fmadd_pd(a0, b, c00); c01 = _mm256_fmadd_pd(a1, b, c01);
+        b = _mm256_broadcast_sd(&B[6*p+1]);
+        c10 = _mm256_fmadd_pd(a0, b, c10); c11 = _mm256_fmadd_pd(a1, b, c11);
+        b = _mm256_broadcast_sd(&B[6*p+2]);
+        c20 = _mm256_fmadd_pd(a0, b, c20); c21 = _mm256_fmadd_pd(a1, b, c21);
+        b = _mm256_broadcast_sd(&B[6*p+3]);
+        c30 = _mm256_fmadd_pd(a0, b, c30); c31 = _mm256_fmadd_pd(a1, b, c31);
+        b = _mm256_broadcast_sd(&B[6*p+4]);
+        c40 = _mm256_fmadd_pd(a0, b, c40); c41 = _mm256_fmadd_pd(a1, b, c41);
+        b = _mm256_broadcast_sd(&B[6*p+5]);
+        c50 = _mm256_fmadd_pd(a0, b, c50); c51 = _mm256_fmadd_pd(a1, b, c51);
+    }
+
+    __m256d va = _mm256_set1_pd(alpha);
+    __m256d vb = _mm256_set1_pd(beta);
+    int load = beta != 0.0;
+    plasma_core_dsimd_store_avx2(&C[0*ldc],   c00, va, vb, load);
+    plasma_core_dsimd_store_avx2(&C[0*ldc+4], c01, va, vb, load);
+    plasma_core_dsimd_store_avx2(&C[1*ldc],   c10, va, vb, load);
+    plasma_core_dsimd_store_avx2(&C[1*ldc+4], c11, va, vb, load);
+    plasma_core_dsimd_store_avx2(&C[2*ldc],   c20, va, vb, load);
+    plasma_core_dsimd_store_avx2(&C[2*ldc+4], c21, va, vb, load);
+    plasma_core_dsimd_store_avx2(&C[3*ldc],   c30, va, vb, load);
+    plasma_core_dsimd_store_avx2(&C[3*ldc+4], c31, va, vb, load);
+    plasma_core_dsimd_store_avx2(&C[4*ldc],   c40, va, vb, load);
+    plasma_core_dsimd_store_avx2(&C[4*ldc+4], c41, va, vb, load);
+    plasma_core_dsimd_store_avx2(&C[5*ldc],   c50, va, vb, load);
+    plasma_core_dsimd_store_avx2(&C[5*ldc+4], c51, va, vb, load);
+}
+
+/******************************************************************************/
+__attribute__((target("avx512f")))
+static inline void plasma_core_dsimd_store_avx512(double *C, __m512d ab,
+                                                  __m512d alpha, __m512d beta,
+                                                  int load)
+{
+    ab = _mm512_mul_pd(alpha, ab);
+    if (load)
+        ab = _mm512_fmadd_pd(beta, _mm512_loadu_pd(C), ab);
+    _mm512_storeu_pd(C, ab);
+}
+
+/******************************************************************************/
+__attribute__((target("avx512f")))
+static void plasma_core_dsimd_kernel_avx512(int k, const double *A, int lda,
+                                            const double *B,
+                                            double alpha, double beta,
+                                            double *C, int ldc)
+{
+    __m512d c00 = _mm512_setzero_pd(), c01 = _mm512_setzero_pd();
+    __m512d c10 = _mm512_setzero_pd(), c11 = _mm512_setzero_pd();
+    __m512d c20 = _mm512_setzero_pd(), c21 = _mm512_setzero_pd();
+    __m512d c30 = _mm512_setzero_pd(), c31 = _mm512_setzero_pd();
+    __m512d c40 = _mm512_setzero_pd(), c41 = _mm512_setzero_pd();
+    __m512d c50 = _mm512_setzero_pd(), c51 = _mm512_setzero_pd();
+    __m512d c60 = _mm512_setzero_pd(), c61 = _mm512_setzero_pd();
+    __m512d c70 = _mm512_setzero_pd(), c71 = _mm512_setzero_pd();
+
+    for (int p = 0; p < k; p++) {
+        __m512d a0 = _mm512_loadu_pd(&A[p*lda]);
+        __m512d a1 = _mm512_loadu_pd(&A[p*lda+8]);
+        __m512d b;
+        b = _mm512_set1_pd(B[8*p+0]);
+        c00 = _mm512_fmadd_pd(a0, b, c00); c01 = _mm512_fmadd_pd(a1, b, c01);
+        b = _mm512_set1_pd(B[8*p+1]);
+        c10 = _mm512_fmadd_pd(a0, b, c10); c11 = _mm512_fmadd_pd(a1, b, c11);
+        b = _mm512_set1_pd(B[8*p+2]);
+        c20 = _mm512_fmadd_pd(a0, b, c20); c21 = _mm512_fmadd_pd(a1, b, c21);
+        b = _mm512_set1_pd(B[8*p+3]);
+        c30 = _mm512_fmadd_pd(a0, b, c30); c31 = _mm512_fmadd_pd(a1, b, c31);
+        b = _mm512_set1_pd(B[8*p+4]);
+        c40 = _mm512_fmadd_pd(a0, b, c40); c41 = _mm512_fmadd_pd(a1, b, c41);
+        b = _mm512_set1_pd(B[8*p+5]);
+        c50 = _mm512_fmadd_pd(a0, b, c50); c51 = _mm512_fmadd_pd(a1, b, c51);
+        b = _mm512_set1_pd(B[8*p+6]);
+        c60 = _mm512_fmadd_pd(a0, b, c60); c61 = _mm512_fmadd_pd(a1, b, c61);
+        b = _mm512_set1_pd(B[8*p+7]);
+        c70 = _mm512_fmadd_pd(a0, b, c70); c71 = _mm512_fmadd_pd(a1, b, c71);
+    }
+
+    __m512d va = _mm512_set1_pd(alpha);
+    __m512d vb = _mm512_set1_pd(beta);
+    int load = beta != 0.0;
+    plasma_core_dsimd_store_avx512(&C[0*ldc],   c00, va, vb, load);
+    plasma_core_dsimd_store_avx512(&C[0*ldc+8], c01, va, vb, load);
+    plasma_core_dsimd_store_avx512(&C[1*ldc],   c10, va, vb, load);
+    plasma_core_dsimd_store_avx512(&C[1*ldc+8], c11, va, vb, load);
+    plasma_core_dsimd_store_avx512(&C[2*ldc],   c20, va, vb, load);
+    plasma_core_dsimd_store_avx512(&C[2*ldc+8], c21, va, vb, load);
+    plasma_core_dsimd_store_avx512(&C[3*ldc],   c30, va, vb, load);
+    plasma_core_dsimd_store_avx512(&C[3*ldc+8], c31, va, vb, load);
+    plasma_core_dsimd_store_avx512(&C[4*ldc],   c40, va, vb, load);
+    plasma_core_dsimd_store_avx512(&C[4*ldc+8], c41, va, vb, load);
+    plasma_core_dsimd_store_avx512(&C[5*ldc],   c50, va, vb, load);
+    plasma_core_dsimd_store_avx512(&C[5*ldc+8], c51, va, vb, load);
+    plasma_core_dsimd_store_avx512(&C[6*ldc],   c60, va, vb, load);
+    plasma_core_dsimd_store_avx512(&C[6*ldc+8], c61, va, vb, load);
+    plasma_core_dsimd_store_avx512(&C[7*ldc],   c70, va, vb, load);
+    plasma_core_dsimd_store_avx512(&C[7*ldc+8], c71, va, vb, load);
+}
+
+/******************************************************************************/
+static inline int imin(int a, int b)
+{
+    return a < b ? a : b;
+}
+
+/******************************************************************************/
+// Returns nonzero if the element (i, j) is in the uplo part of a matrix.
+static inline int plasma_core_dsimd_in(plasma_enum_t uplo, int i, int j)
+{
+    return uplo == PlasmaGeneral ||
+           (uplo == PlasmaLower && i >= j) ||
+           (uplo == PlasmaUpper && i <= j);
+}
+
+/***************************************************************************//**
+ *
+ *  Computes C = alpha*A*B + beta*C on the uplo part of the m-by-n matrix C,
+ *  with the elements A(i, p) = A[i*ai + p*ap], B(p, j) = B[p*bp + j*bj]
+ *  and C(i, j) = C[i*ci + j*cj], so the transposes are strides.
+ *  Panels of B are packed by rows, and panels of A are read in place when
+ *  their columns are contiguous, and packed otherwise.
+ *
+ */
+static void plasma_core_dsimd_gemm(int isa, plasma_enum_t uplo,
+                                   int m, int n, int k,
+                                   double alpha, const double *A, int ai, int ap,
+                                                 const double *B, int bp, int bj,
+                                   double beta,        double *C, int ci, int cj)
+{
+    if (alpha == 0.0 || k == 0) {
+        for (int j = 0; j < n; j++)
+            for (int i = 0; i < m; i++)
+                if (plasma_core_dsimd_in(uplo, i, j))
+                    C[i*ci+j*cj] = beta == 0.0 ? 0.0 : beta*C[i*ci+j*cj];
+        return;
+    }
+
+    plasma_core_dsimd_kernel_t kernel;
+    int mr, nr;
+    if (isa == PlasmaSimdAvx512) {
+        kernel = plasma_core_dsimd_kernel_avx512;
+        mr = 16;
+        nr = 8;
+    }
+    else {
+        kernel = plasma_core_dsimd_kernel_avx2;
+        mr = 8;
+        nr = 6;
+    }
+
+    double Ap[PLASMA_SIMD_MR*PLASMA_SIMD_KC] __attribute__((aligned(64)));
+    double Bp[PLASMA_SIMD_NR*PLASMA_SIMD_KC] __attribute__((aligned(64)));
+    double AB[PLASMA_SIMD_MR*PLASMA_SIMD_NR] __attribute__((aligned(64)));
+
+    for (int pc = 0; pc < k; pc += PLASMA_SIMD_KC) {
+        int kc = imin(PLASMA_SIMD_KC, k-pc);
+        // Later panels accumulate into C.
+        double betac = pc == 0 ? beta : 1.0;
+
+        for (int jc = 0; jc < n; jc += nr) {
+            int nc = imin(nr, n-jc);
+
+            // Pack the panel of B, padded with zeros.
+            for (int p = 0; p < kc; p++)
+                for (int j = 0; j < nr; j++)
+                    Bp[p*nr+j] = j < nc ? B[(pc+p)*bp+(jc+j)*bj] : 0.0;
+
+            for (int ic = 0; ic < m; ic += mr) {
+                int mc = imin(mr, m-ic);
+                // Skip the micro-tiles outside the uplo part.
+                if (uplo == PlasmaUpper && ic > jc+nc-1)
+                    break;
+                if (uplo == PlasmaLower && ic+mc-1 < jc)
+                    continue;
+
+                const double *a;
+                int lda;
+                if (ai == 1 && mc == mr) {
+                    a = &A[ic+pc*ap];
+                    lda = ap;
+                }
+                else {
+                    // Pack the panel of A, padded with zeros.
+                    for (int p = 0; p < kc; p++)
+                        for (int i = 0; i < mr; i++)
+                            Ap[p*mr+i] =
+                                i < mc ? A[(ic+i)*ai+(pc+p)*ap] : 0.0;
+                    a = Ap;
+                    lda = mr;
+                }
+                // Update full micro-tiles inside the uplo part in place,
+                // others through AB.
+                int inside = uplo == PlasmaGeneral ||
+                             (uplo == PlasmaLower && ic >= jc+nc-1) ||
+                             (uplo == PlasmaUpper && ic+mc-1 <= jc);
+                if (inside && mc == mr && nc == nr && ci == 1) {
+                    kernel(kc, a, lda, Bp, alpha, betac, &C[ic+jc*cj], cj);
+                    continue;
+                }
+                kernel(kc, a, lda, Bp, 1.0, 0.0, AB, mr);
+                for (int j = 0; j < nc; j++) {
+                    double *c = &C[ic*ci+(jc+j)*cj];
+                    for (int i = 0; i < mc; i++) {
+                        if (!plasma_core_dsimd_in(uplo, ic+i, jc+j))
+                            continue;
+                        if (betac == 0.0)
+                            c[i*ci] = alpha*AB[j*mr+i];
+                        else
+                            c[i*ci] = alpha*AB[j*mr+i] + betac*c[i*ci];
+                    }
+                }
+            }
+        }
+    }
+}
+
+/******************************************************************************/
+// Scales the m-by-n matrix B by alpha, setting it to zero if alpha is zero.
+static void plasma_core_dsimd_scale(int m, int n, double alpha,
+                                    double *B, int ldb)
+{
+    if (alpha == 1.0)
+        return;
+
+    for (int j = 0; j < n; j++)
+        for (int i = 0; i < m; i++)
+            B[i+j*ldb] = alpha == 0.0 ? 0.0 : alpha*B[i+j*ldb];
+}
+
+/***************************************************************************//**
+ *
+ *  Solves T*X = alpha*B for the m-by-n matrix X overwriting B, with
+ *  the m-by-m lower or upper triangular matrix T(i, p) = T[i*ti + p*tp].
+ *  Left-looking by blocks of rows, so most of the work is in products
+ *  with the inner dimension growing to m.
+ *
+ */
+static void plasma_core_dsimd_trsm_left(int isa, int lower, plasma_enum_t diag,
+                                        int m, int n,
+                                        double alpha, const double *T,
+                                        int ti, int tp,
+                                        double *B, int ldb)
+{
+    plasma_core_dsimd_scale(m, n, alpha, B, ldb);
+    if (alpha == 0.0)
+        return;
+
+    for (int b = 0; b < m; b += PLASMA_SIMD_TRSM_NB) {
+        int ib = imin(PLASMA_SIMD_TRSM_NB, m-b);
+        // First row of the block, and of the rows solved before it.
+        int i0 = lower ? b : m-b-ib;
+        int s0 = lower ? 0 : m-b;
+
+        // B(i0:i0+ib, :) -= T(i0:i0+ib, s0:s0+b) * X(s0:s0+b, :)
+        if (b > 0) {
+            plasma_core_dsimd_gemm(isa, PlasmaGeneral, ib, n, b,
+                                   -1.0, &T[i0*ti+s0*tp], ti, tp,
+                                         &B[s0], 1, ldb,
+                                    1.0, &B[i0], 1, ldb);
+        }
+
+        // Solve the diagonal block.
+        const double *t = &T[i0*ti+i0*tp];
+        for (int j = 0; j < n; j++) {
+            double *x = &B[i0+j*ldb];
+            if (lower) {
+                for (int p = 0; p < ib; p++) {
+                    if (diag != PlasmaUnit)
+                        x[p] /= t[p*ti+p*tp];
+                    for (int i = p+1; i < ib; i++)
+                        x[i] -= t[i*ti+p*tp]*x[p];
+                }
+            }
+            else {
+                for (int p = ib-1; p >= 0; p--) {
+                    if (diag != PlasmaUnit)
+                        x[p] /= t[p*ti+p*tp];
+                    for (int i = 0; i < p; i++)
+                        x[i] -= t[i*ti+p*tp]*x[p];
+                }
+            }
+        }
+    }
+}
+
+/***************************************************************************//**
+ *
+ *  Solves X*U = alpha*B for the m-by-n matrix X overwriting B, with
+ *  the n-by-n lower or upper triangular matrix U(p, j) = U[p*ui + j*uj].
+ *  Left-looking by blocks of columns, so the columns of B stay contiguous.
+ *
+ */
+static void plasma_core_dsimd_trsm_right(int isa, int lower, plasma_enum_t diag,
+                                         int m, int n,
+                                         double alpha, const double *U,
+                                         int ui, int uj,
+                                         double *B, int ldb)
+{
+    plasma_core_dsimd_scale(m, n, alpha, B, ldb);
+    if (alpha == 0.0)
+        return;
+
+    for (int b = 0; b < n; b += PLASMA_SIMD_TRSM_NB) {
+        int jb = imin(PLASMA_SIMD_TRSM_NB, n-b);
+        // First column of the block, and of the columns solved before it.
+        int j0 = lower ? n-b-jb : b;
+        int s0 = lower ? n-b : 0;
+
+        // B(:, j0:j0+jb) -= X(:, s0:s0+b) * U(s0:s0+b, j0:j0+jb)
+        if (b > 0) {
+            plasma_core_dsimd_gemm(isa, PlasmaGeneral, m, jb, b,
+                                   -1.0, &B[s0*ldb], 1, ldb,
+                                         &U[s0*ui+j0*uj], ui, uj,
+                                    1.0, &B[j0*ldb], 1, ldb);
+        }
+
+        // Solve the diagonal block by columns.
+        const double *u = &U[j0*ui+j0*uj];
+        for (int jj = 0; jj < jb; jj++) {
+            int j = lower ? jb-1-jj : jj;
+            double *x = &B[(j0+j)*ldb];
+            int p0 = lower ? j+1 : 0;
+            int p1 = lower ? jb : j;
+            for (int p = p0; p < p1; p++) {
+                double s = u[p*ui+j*uj];
+                const double *y = &B[(j0+p)*ldb];
+                for (int i = 0; i < m; i++)
+                    x[i] -= s*y[i];
+            }
+            if (diag != PlasmaUnit) {
+                double s = 1.0/u[j*ui+j*uj];
+                for (int i = 0; i < m; i++)
+                    x[i] *= s;
+            }
+        }
+    }
+}
+
+/******************************************************************************/
+// Overrides the weak CBLAS wrapper in core_dgemm.c.
+void plasma_core_dgemm(plasma_enum_t transa, plasma_enum_t transb,
+                int m, int n, int k,
+                double alpha, const double *A, int lda,
+                                          const double *B, int ldb,
+                double beta,        double *C, int ldc)
+{
+    int isa = plasma_core_simd_isa();
+    if (isa == PlasmaSimdNone) {
+        cblas_dgemm(CblasColMajor,
+                    (CBLAS_TRANSPOSE)transa, (CBLAS_TRANSPOSE)transb,
+                    m, n, k,
+                    (alpha), A, lda,
+                                        B, ldb,
+                    (beta),  C, ldc);
+        return;
+    }
+
+    int ai = transa == PlasmaNoTrans ? 1 : lda;
+    int ap = transa == PlasmaNoTrans ? lda : 1;
+    int bp = transb == PlasmaNoTrans ? 1 : ldb;
+    int bj = transb == PlasmaNoTrans ? ldb : 1;
+    plasma_core_dsimd_gemm(isa, PlasmaGeneral, m, n, k,
+                           alpha, A, ai, ap,
+                                  B, bp, bj,
+                           beta,  C, 1, ldc);
+}
+
+/******************************************************************************/
+// Overrides the weak CBLAS wrapper in core_dsyrk.c.
+void plasma_core_dsyrk(plasma_enum_t uplo, plasma_enum_t trans,
+                int n, int k,
+                double alpha, const double *A, int lda,
+                double beta,        double *C, int ldc)
+{
+    int isa = plasma_core_simd_isa();
+    if (isa == PlasmaSimdNone) {
+        cblas_dsyrk(CblasColMajor,
+                    (CBLAS_UPLO)uplo, (CBLAS_TRANSPOSE)trans,
+                    n, k,
+                    (alpha), A, lda,
+                    (beta),  C, ldc);
+        return;
+    }
+
+    // C = alpha*op(A)*op(A)^T + beta*C, with op(A)^T read from A.
+    int ai = trans == PlasmaNoTrans ? 1 : lda;
+    int ap = trans == PlasmaNoTrans ? lda : 1;
+    plasma_core_dsimd_gemm(isa, uplo, n, n, k,
+                           alpha, A, ai, ap,
+                                  A, ap, ai,
+                           beta,  C, 1, ldc);
+}
+
+/******************************************************************************/
+// Overrides the weak CBLAS wrapper in core_dtrsm.c.
+void plasma_core_dtrsm(plasma_enum_t side, plasma_enum_t uplo,
+                plasma_enum_t transa, plasma_enum_t diag,
+                int m, int n,
+                double alpha, const double *A, int lda,
+                                                double *B, int ldb)
+{
+    int isa = plasma_core_simd_isa();
+    if (isa == PlasmaSimdNone) {
+        cblas_dtrsm(CblasColMajor,
+                    (CBLAS_SIDE)side, (CBLAS_UPLO)uplo,
+                    (CBLAS_TRANSPOSE)transa, (CBLAS_DIAG)diag,
+                    m, n,
+                    (alpha), A, lda,
+                                        B, ldb);
+        return;
+    }
+
+    // Strides of op(A), and whether it is lower triangular.
+    int ai = transa == PlasmaNoTrans ? 1 : lda;
+    int ap = transa == PlasmaNoTrans ? lda : 1;
+    int lower = (uplo == PlasmaLower) == (transa == PlasmaNoTrans);
+
+    if (side == PlasmaLeft) {
+        plasma_core_dsimd_trsm_left(isa, lower, diag, m, n,
+                                    alpha, A, ai, ap,
+                                           B, ldb);
+    }
+    else {
+        plasma_core_dsimd_trsm_right(isa, lower, diag, m, n,
+                                     alpha, A, ai, ap,
+                                            B, ldb);
+    }
+}
+
+#endif // PLASMA_WITH_SIMD
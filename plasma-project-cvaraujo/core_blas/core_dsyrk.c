@@ -6,12 +6,16 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/core_blas/core_zsyrk.c, normal z -> d, Fri Sep 28 17:38:23 2018
+ * @generated from core_blas/core_zsyrk.c, normal z -> d, Sat Oct 17 03:04:06 2026
  *
  **/
 
 #include <plasma_core_blas.h>
 #include "plasma_types.h"
+#include "plasma_graph.h"
+#include "plasma_hier.h"
+#include "plasma_internal.h"
+#include "plasma_tile_cache.h"
 #include "core_lapack.h"
 
 /***************************************************************************//**
@@ -83,6 +87,36 @@ void plasma_core_dsyrk(plasma_enum_t uplo, plasma_enum_t trans,
                 (beta),  C, ldc);
 }
 
+/******************************************************************************/
+typedef struct {
+    plasma_enum_t uplo;
+    plasma_enum_t trans;
+    int n;
+    int k;
+    double alpha;
+    int lda;
+    double beta;
+    int ldc;
+} plasma_core_dsyrk_args_t;
+
+/******************************************************************************/
+static void plasma_core_dsyrk_graph(const void *args_, void **tiles,
+                                    plasma_sequence_t *sequence,
+                                    plasma_request_t *request)
+{
+    const plasma_core_dsyrk_args_t *args =
+        (const plasma_core_dsyrk_args_t*)args_;
+    plasma_time_t start = plasma_stats_start();
+    plasma_core_dsyrk(args->uplo, args->trans,
+                      args->n, args->k,
+                      args->alpha, tiles[0], args->lda,
+                      args->beta,  tiles[1], args->ldc);
+    plasma_trace_tiles("rw", (const void*[]){tiles[0], tiles[1]});
+    plasma_stats_stop(PlasmaStatsSyrk, PlasmaRealDouble, start,
+                      1.0*args->n*args->n*args->k,
+                      1.0*args->n*args->k+2.0*args->n*args->n);
+}
+
 /******************************************************************************/
 void plasma_core_omp_dsyrk(
     plasma_enum_t uplo, plasma_enum_t trans,
@@ -91,19 +125,48 @@ void plasma_core_omp_dsyrk(
     double beta,        double *C, int ldc,
     plasma_sequence_t *sequence, plasma_request_t *request)
 {
+    if (plasma_graph_capturing()) {
+        plasma_core_dsyrk_args_t args = {
+            uplo, trans, n, k, alpha, lda, beta, ldc
+        };
+        const void *tiles[] = {A, C};
+        const int write[] = {0, 1};
+        plasma_graph_record(plasma_core_dsyrk_graph, &args, sizeof(args),
+                            2, tiles, write);
+        return;
+    }
+
+    if (plasma_hier_offload(n, n) && k > 0) {
+        plasma_core_omp_dhier_syrk(uplo, trans, n, k,
+                                   alpha, A, lda,
+                                   beta,  C, ldc,
+                                   sequence, request);
+        return;
+    }
+
     int ak;
     if (trans == PlasmaNoTrans)
         ak = k;
     else
         ak = n;
 
+    plasma_tile_cache_host(A, sizeof(double)*lda*ak, 0);
+    plasma_tile_cache_host(C, sizeof(double)*ldc*n, 1);
+
     #pragma omp task depend(in:A[0:lda*ak]) \
-                     depend(inout:C[0:ldc*n])
+                     depend(inout:C[0:ldc*n]) \
+                     affinity(C[0:ldc*n]) \
+                     priority(plasma_task_priority())
     {
-        if (sequence->status == PlasmaSuccess)
+        if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             plasma_core_dsyrk(uplo, trans,
                        n, k,
                        alpha, A, lda,
                        beta,  C, ldc);
+            plasma_trace_tiles("rw", (const void*[]){A, C});
+            plasma_stats_stop(PlasmaStatsSyrk, PlasmaRealDouble, start,
+                              1.0*n*n*k, 1.0*n*k+2.0*n*n);
+        }
     }
 }
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/core_blas/core_ztrmm.c, normal z -> d, Fri Sep 28 17:38:23 2018
+ * @generated from core_blas/core_ztrmm.c, normal z -> d, Sat Oct 17 02:49:19 2026
  *
  **/
 
@@ -121,13 +121,19 @@ void plasma_core_omp_dtrmm(
     int k = (side == PlasmaLeft) ? m : n;
 
     #pragma omp task depend(in:A[0:lda*k]) \
-                     depend(inout:B[0:ldb*n])
+                     depend(inout:B[0:ldb*n]) \
+                     affinity(B[0:ldb*n])
     {
-        if (sequence->status == PlasmaSuccess)
+        if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             plasma_core_dtrmm(side, uplo,
                        transa, diag,
                        m, n,
                        alpha, A, lda,
                               B, ldb);
+            plasma_trace_tiles("rw", (const void*[]){A, B});
+            plasma_stats_stop(PlasmaStatsTrmm, PlasmaRealDouble, start,
+                              1.0*m*n*k, 1.0*k*k+2.0*m*n);
+        }
     }
 }
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/core_blas/core_ztrtri.c, normal z -> d, Fri Sep 28 17:38:24 2018
+ * @generated from core_blas/core_ztrtri.c, normal z -> d, Sat Oct 17 02:49:19 2026
  *
  **/
 
@@ -75,10 +75,14 @@ void plasma_core_omp_dtrtri(plasma_enum_t uplo, plasma_enum_t diag,
     #pragma omp task depend(inout:A[0:lda*n])
     {
         if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             int info = plasma_core_dtrtri(uplo, diag,
                                    n, A, lda);
             if (info != 0)
                 plasma_request_fail(sequence, request, iinfo+info);
+            plasma_trace_tiles("w", (const void*[]){A});
+            plasma_stats_stop(PlasmaStatsTrtri, PlasmaRealDouble, start,
+                              1.0*n*n*n/3.0, 2.0*n*n);
         }
     }
 }
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/core_blas/core_ztsqrt.c, normal z -> d, Fri Sep 28 17:38:24 2018
+ * @generated from core_blas/core_ztsqrt.c, normal z -> d, Sat Oct 17 02:49:19 2026
  *
  **/
 
@@ -219,9 +219,11 @@ void plasma_core_omp_dtsqrt(int m, int n, int ib,
 {
     #pragma omp task depend(inout:A1[0:lda1*n]) \
                      depend(inout:A2[0:lda2*n]) \
-                     depend(out:T[0:ib*n])
+                     depend(out:T[0:ib*n]) \
+                     priority(plasma_task_priority())
     {
         if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             // Prepare workspaces.
             int tid = omp_get_thread_num();
             double *tau = ((double*)work.spaces[tid]);
@@ -238,6 +240,9 @@ void plasma_core_omp_dtsqrt(int m, int n, int ib,
                 plasma_error("core_dtsqrt() failed");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
+            plasma_trace_tiles("www", (const void*[]){A1, A2, T});
+            plasma_stats_stop(PlasmaStatsTsqrt, PlasmaRealDouble, start,
+                              2.0*m*n*n, 2.0*n*n+2.0*m*n);
         }
     }
 }
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/core_blas/core_zgelqt.c, normal z -> s, Fri Sep 28 17:38:20 2018
+ * @generated from core_blas/core_zgelqt.c, normal z -> s, Sat Oct 17 02:49:18 2026
  *
  **/
 
@@ -180,6 +180,7 @@ void plasma_core_omp_sgelqt(int m, int n, int ib,
                                            // as ibxm
     {
         if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             // Prepare workspaces.
             int tid = omp_get_thread_num();
             float *tau = (float*)work.spaces[tid];
@@ -195,6 +196,9 @@ void plasma_core_omp_sgelqt(int m, int n, int ib,
                 plasma_error("core_sgelqt() failed");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
+            plasma_trace_tiles("ww", (const void*[]){A, T});
+            plasma_stats_stop(PlasmaStatsGeqrt, PlasmaRealFloat, start,
+                              2.0*m*m*(n-m/3.0), 2.0*m*n);
         }
     }
 }
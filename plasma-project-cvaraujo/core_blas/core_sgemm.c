@@ -12,6 +12,10 @@
 
 #include <plasma_core_blas.h>
 #include "plasma_types.h"
+#include "plasma_graph.h"
+#include "plasma_hier.h"
+#include "plasma_internal.h"
+#include "plasma_tile_cache.h"
 #include "core_lapack.h"
 
 /***************************************************************************//**
@@ -101,6 +105,39 @@ void plasma_core_sgemm(plasma_enum_t transa, plasma_enum_t transb,
                 (beta),  C, ldc);
 }
 
+/******************************************************************************/
+typedef struct {
+    plasma_enum_t transa;
+    plasma_enum_t transb;
+    int m;
+    int n;
+    int k;
+    float alpha;
+    int lda;
+    int ldb;
+    float beta;
+    int ldc;
+} plasma_core_sgemm_args_t;
+
+/******************************************************************************/
+static void plasma_core_sgemm_graph(const void *args_, void **tiles,
+                                    plasma_sequence_t *sequence,
+                                    plasma_request_t *request)
+{
+    const plasma_core_sgemm_args_t *args =
+        (const plasma_core_sgemm_args_t*)args_;
+    plasma_time_t start = plasma_stats_start();
+    plasma_core_sgemm(args->transa, args->transb,
+                      args->m, args->n, args->k,
+                      args->alpha, tiles[0], args->lda,
+                                   tiles[1], args->ldb,
+                      args->beta,  tiles[2], args->ldc);
+    plasma_trace_tiles("rrw", (const void*[]){tiles[0], tiles[1], tiles[2]});
+    plasma_stats_stop(PlasmaStatsGemm, PlasmaRealFloat, start,
+                      2.0*args->m*args->n*args->k,
+                      1.0*args->k*(args->m+args->n)+2.0*args->m*args->n);
+}
+
 /******************************************************************************/
 void plasma_core_omp_sgemm_default(
     plasma_enum_t transa, plasma_enum_t transb,
@@ -110,28 +147,25 @@ void plasma_core_omp_sgemm_default(
     float beta,        float *C, int ldc,
     plasma_sequence_t *sequence, plasma_request_t *request)
 {
-  int ak;
-  if (transa == PlasmaNoTrans)
-    ak = k;
-  else
-    ak = m;
-
-  int bk;
-  if (transb == PlasmaNoTrans)
-    bk = n;
-  else
-    bk = k;
-
-#pragma omp task depend(in:A[0:lda*ak])		\
-  depend(in:B[0:ldb*bk])			\
-  depend(inout:C[0:ldc*n])
+  // The tiles may be strided views of a larger array, so the task
+  // depends on their first elements rather than on ld-long ranges.
+#pragma omp task depend(in:A[0])			\
+  depend(in:B[0])				\
+  depend(inout:C[0])				\
+  affinity(C[0:ldc*n])				\
+  priority(plasma_task_priority())
   {
-    if (sequence->status == PlasmaSuccess)
+    if (sequence->status == PlasmaSuccess) {
+      plasma_time_t start = plasma_stats_start();
       plasma_core_sgemm(transa, transb,
 			m, n, k,
 			alpha, A, lda,
 			B, ldb,
 			beta,  C, ldc);
+      plasma_trace_tiles("rrw", (const void*[]){A, B, C});
+      plasma_stats_stop(PlasmaStatsGemm, PlasmaRealFloat, start,
+			2.0*m*n*k, 1.0*m*k+1.0*k*n+2.0*m*n);
+    }
   }
 }
 
@@ -143,14 +177,24 @@ void plasma_core_omp_sgemm(
 			   float beta,        float *C, int ldc,
 			   plasma_sequence_t *sequence, plasma_request_t *request) {
 
-  
-  if(m <= 64 || n <= 64) {
-    plasma_core_omp_sgemm_default(transa, transb,
-				  m, n, k,
-				  alpha, A, lda,
-				  B, ldb,
-				  beta, C, ldc,
-				  sequence, request);  
+  if (plasma_graph_capturing()) {
+    plasma_core_sgemm_args_t args = {
+        transa, transb, m, n, k, alpha, lda, ldb, beta, ldc
+    };
+    const void *tiles[] = {A, B, C};
+    const int write[] = {0, 0, 1};
+    plasma_graph_record(plasma_core_sgemm_graph, &args, sizeof(args),
+                        3, tiles, write);
+    return;
+  }
+
+  if (plasma_hier_offload(m, n) && k > 0) {
+    plasma_core_omp_shier_gemm(transa, transb,
+			       m, n, k,
+			       alpha, A, lda,
+			       B, ldb,
+			       beta, C, ldc,
+			       sequence, request);
   } else {
     int ak;
     if (transa == PlasmaNoTrans)
@@ -164,81 +208,14 @@ void plasma_core_omp_sgemm(
     else
       bk = k;
 
-    if (sequence->status == PlasmaSuccess) {
-      int transa_ = transa, transb_ = transb;
-      int size_A = lda*ak, size_B = ldb*bk,size_C = ldc*n;
-
-#pragma omp target nowait			\
-  depend(in:A[0:lda*ak])			\
-  depend(in:B[0:ldb*bk])			\
-  depend(inout:C[0:ldc*n])			\
-  firstprivate(m,n,k,alpha,beta,lda,ak)		\
-  firstprivate(ldb,bk,ldc,transa_,transb_)	\
-  map(to:A[0:size_A],B[0:size_B])		\
-  map(tofrom:C[0:size_C])
-      {
-
-	int block_size = (lda < 128) ? lda : 128;
-	int size_matrix = lda;
-	int m_new = m/block_size;
-	int n_new = n/block_size;
-	int k_new = k/block_size;
-	int zbeta;
-
-#pragma omp parallel
-#pragma omp single
-	{
-	  for (int m_ = 0; m_ < m_new; m_++){
-	    for (int n_ = 0; n_ < n_new; n_++) {
-	      for (int k_ = 0; k_ < k_new; k_++) {
-		int lda_ = m_ * block_size + k_ * block_size;
-		int ldb_ = k_ * block_size + n_ * block_size;
-		int ldc_ = m_ * block_size + n_ * block_size;
-#pragma omp task							\
-  depend(in:A[0:lda_])							\
-  depend(in:B[0:ldb_])							\
-  depend(inout:C[m_*block_size+n_*lda*block_size:m_*block_size+n_*lda*block_size + block_size * block_size])
-		{
-
-		  float A_new[block_size*block_size], B_new[block_size*block_size], C_new[block_size*block_size];
-		  int i_a = m_, j_a=k_;
-		  int i_b = k_, j_b=n_;
-		  int i_c = m_, j_c=n_;
-		  int insert = 0;
-
-		  for(int l = 0; l < block_size; l++) {
-		    int before_a = i_a*block_size+j_a*lda*block_size + l*size_matrix;
-		    int before_b = i_b*block_size+j_b*lda*block_size + l*size_matrix;
-		    int before_c = i_c*block_size+j_c*lda*block_size + l*size_matrix;
-
-		    for (int i = 0; i < block_size; i++) {
-		      A_new[insert] = A[before_a++];
-		      B_new[insert] = B[before_b++];
-		      C_new[insert++] = C[before_c++];
-		    }
-		  }
-
-		  float zbeta = k_== 0 ? beta : 1.0;
-
-		  plasma_core_sgemm(transa_, transb_,
-				    block_size, block_size, block_size,
-				    alpha, (const float *) A_new, block_size,
-				    (const float *) B_new, block_size,
-				    zbeta, (float *) C_new, block_size);
-
-		  insert = 0;
-		  for(int l = 0; l < block_size; l++) {
-		    int before_c = i_c*block_size+j_c*lda*block_size + l*size_matrix;
-
-		    for (int i = 0; i < block_size; i++) C[before_c++]=C_new[insert++];
-
-		  }
-		}
-	      }
-	    }
-	  }
-	}
-      }
-    }
+    plasma_tile_cache_host(A, sizeof(float)*lda*ak, 0);
+    plasma_tile_cache_host(B, sizeof(float)*ldb*bk, 0);
+    plasma_tile_cache_host(C, sizeof(float)*ldc*n, 1);
+    plasma_core_omp_sgemm_default(transa, transb,
+				  m, n, k,
+				  alpha, A, lda,
+				  B, ldb,
+				  beta, C, ldc,
+				  sequence, request);
   }
 }
@@ -0,0 +1,130 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zgemm_batch.c, normal z -> s, Sat Oct 17 03:58:33 2026
+ *
+ **/
+
+#include <plasma_core_blas.h>
+#include "plasma_batch.h"
+#include "plasma_depend.h"
+#include "plasma_types.h"
+#include "plasma_graph.h"
+#include "plasma_hier.h"
+#include "plasma_internal.h"
+#include "plasma_tile_cache.h"
+#include "core_lapack.h"
+
+/***************************************************************************//**
+ *
+ * @ingroup core_gemm
+ *
+ *  Performs the batch->count independent matrix-matrix operations
+ *
+ *    \f[ C_i = \alpha [op( A_i )\times op( B_i )] + \beta C_i, \f]
+ *
+ *  of the batch in a single task, see plasma_core_omp_sgemm().
+ *  The operations are submitted one per task when recording a task graph,
+ *  offloading the tiles or compiling without depend iterators.
+ *
+ *******************************************************************************
+ *
+ * @param[in] transa
+ *          - PlasmaNoTrans:   A_i are not transposed,
+ *          - PlasmaTrans:     A_i are transposed,
+ *          - PlasmaConjTrans: A_i are conjugate transposed.
+ *
+ * @param[in] transb
+ *          - PlasmaNoTrans:   B_i are not transposed,
+ *          - PlasmaTrans:     B_i are transposed,
+ *          - PlasmaConjTrans: B_i are conjugate transposed.
+ *
+ * @param[in] alpha
+ *          The scalar alpha.
+ *
+ * @param[in] batch
+ *          The operations, with distinct tiles C_i, copied into the task.
+ *
+ * @param[in] beta
+ *          The scalar beta.
+ *
+ ******************************************************************************/
+void plasma_core_omp_sgemm_batch(
+    plasma_enum_t transa, plasma_enum_t transb,
+    float alpha, const plasma_batch_t *batch,
+    float beta,
+    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    int single = batch->count == 1 || plasma_graph_capturing();
+    for (int i = 0; i < batch->count; i++)
+        single |= plasma_hier_offload(batch->m[i], batch->n[i]);
+#ifndef PLASMA_DEPEND_ITERATOR
+    single = 1;
+#endif
+
+    if (single) {
+        for (int i = 0; i < batch->count; i++) {
+            plasma_core_omp_sgemm(
+                transa, transb,
+                batch->m[i], batch->n[i], batch->k[i],
+                alpha, (const float*)batch->A[i], batch->lda[i],
+                       (const float*)batch->B[i], batch->ldb[i],
+                beta,  (float*)batch->C[i], batch->ldc[i],
+                sequence, request);
+        }
+        return;
+    }
+
+#ifdef PLASMA_DEPEND_ITERATOR
+    plasma_batch_t ops = *batch;
+    for (int i = 0; i < ops.count; i++) {
+        int ak = transa == PlasmaNoTrans ? ops.k[i] : ops.m[i];
+        int bk = transb == PlasmaNoTrans ? ops.n[i] : ops.k[i];
+        plasma_tile_cache_host(ops.A[i],
+                               sizeof(float)*ops.lda[i]*ak, 0);
+        plasma_tile_cache_host(ops.B[i],
+                               sizeof(float)*ops.ldb[i]*bk, 0);
+        plasma_tile_cache_host(ops.C[i],
+                               sizeof(float)*ops.ldc[i]*ops.n[i],
+                               1);
+    }
+
+    // The tasks on the tiles depend on their first elements.
+    // The batch runs close to the tiles it writes.
+    #pragma omp task firstprivate(ops) \
+                     depend(iterator(int i=0:ops.count), \
+                            in:((const float*)ops.A[i])[0]) \
+                     depend(iterator(int i=0:ops.count), \
+                            in:((const float*)ops.B[i])[0]) \
+                     depend(iterator(int i=0:ops.count), \
+                            inout:((float*)ops.C[i])[0]) \
+                     affinity(iterator(int i=0:ops.count): \
+                              ((float*)ops.C[i])[0]) \
+                     priority(plasma_task_priority())
+    {
+        for (int i = 0; i < ops.count; i++) {
+            if (sequence->status != PlasmaSuccess)
+                break;
+
+            int m = ops.m[i];
+            int n = ops.n[i];
+            int k = ops.k[i];
+            plasma_time_t start = plasma_stats_start();
+            plasma_core_sgemm(transa, transb,
+                       m, n, k,
+                       alpha, ops.A[i], ops.lda[i],
+                              ops.B[i], ops.ldb[i],
+                       beta,  ops.C[i], ops.ldc[i]);
+            plasma_trace_tiles("rrw",
+                               (const void*[]){ops.A[i], ops.B[i], ops.C[i]});
+            plasma_stats_stop(PlasmaStatsGemm, PlasmaRealFloat, start,
+                              2.0*m*n*k, 1.0*m*k+1.0*k*n+2.0*m*n);
+        }
+    }
+#endif
+}
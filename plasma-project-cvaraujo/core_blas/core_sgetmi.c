@@ -0,0 +1,157 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from core_blas/core_zgetmi.c, normal z -> s, Sat Oct 17 04:31:32 2026
+ *
+ **/
+
+#include <plasma_core_blas.h>
+#include "plasma_types.h"
+#include "plasma_internal.h"
+
+#include <string.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup core_getmi
+ *
+ *  Transposes in place an m-by-n matrix of blocks, where each block is
+ *  a contiguous vector of mb elements. The blocks are stored by columns
+ *  on entry and on exit, i.e., block (i, j) is moved from A[(i + j*m)*mb]
+ *  to A[(j + i*n)*mb]. The permutation is applied by following its cycles.
+ *
+ *  With m = lm/mb and n = nb, this converts an lm-by-nb column-major panel
+ *  into a column of contiguous mb-by-nb tiles, and with m and n swapped
+ *  it converts the column of tiles back.
+ *
+ *  If the workspace cannot be allocated, the cycles are rotated one element
+ *  at a time instead, each from its smallest block, so the routine never
+ *  fails and a translation is always followed by its inverse.
+ *
+ *******************************************************************************
+ *
+ * @param[in] m
+ *          The number of block rows of A on entry.
+ *          m >= 0.
+ *
+ * @param[in] n
+ *          The number of block columns of A on entry.
+ *          n >= 0.
+ *
+ * @param[in] mb
+ *          The number of elements in a block.
+ *          mb >= 0.
+ *
+ * @param[in,out] A
+ *          On entry, the m-by-n matrix of blocks.
+ *          On exit, the n-by-m transposed matrix of blocks.
+ *
+ *******************************************************************************
+ *
+ * @retval PlasmaSuccess successful exit
+ *
+ ******************************************************************************/
+int plasma_core_sgetmi(int m, int n, int mb, float *A)
+{
+    size_t nblk = (size_t)m*n;
+    if (m <= 1 || n <= 1 || mb == 0)
+        return PlasmaSuccess;
+
+    float *work =
+        (float*)malloc(2*(size_t)mb*sizeof(float));
+    unsigned char *visited = (unsigned char*)calloc(nblk, 1);
+    if (work == NULL || visited == NULL) {
+        free(work);
+        free(visited);
+
+        for (size_t start = 1; start < nblk-1; start++) {
+            // Skip the cycle unless start is its smallest block.
+            size_t k = start;
+            do {
+                k = k/m + (k%m)*n;
+            } while (k > start);
+            if (k != start)
+                continue;
+
+            for (int e = 0; e < mb; e++) {
+                float carry = A[start*mb+e];
+                do {
+                    k = k/m + (k%m)*n;
+                    float swap = A[k*mb+e];
+                    A[k*mb+e] = carry;
+                    carry = swap;
+                } while (k != start);
+            }
+        }
+        return PlasmaSuccess;
+    }
+    float *carry = work;
+    float *swap = work+mb;
+    size_t bytes = (size_t)mb*sizeof(float);
+
+    // The first and the last block never move.
+    for (size_t start = 1; start < nblk-1; start++) {
+        if (visited[start])
+            continue;
+
+        // Carry the block around its cycle until the cycle closes.
+        size_t k = start;
+        memcpy(carry, &A[k*mb], bytes);
+        do {
+            size_t i = k%m;
+            size_t j = k/m;
+            k = j + i*n;
+            memcpy(swap, &A[k*mb], bytes);
+            memcpy(&A[k*mb], carry, bytes);
+            memcpy(carry, swap, bytes);
+            visited[k] = 1;
+        } while (k != start);
+    }
+
+    free(work);
+    free(visited);
+    return PlasmaSuccess;
+}
+
+/******************************************************************************/
+void plasma_core_omp_sgetmi(int m, int n, int mb, float *A,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request)
+{
+    #pragma omp task depend(inout:A[0:m*n*mb])
+    {
+        if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
+            int retval = plasma_core_sgetmi(m, n, mb, A);
+            if (retval != PlasmaSuccess) {
+                plasma_coreblas_error("plasma_core_sgetmi() failed");
+                plasma_request_fail(sequence, request, retval);
+            }
+            plasma_trace_tiles("w", (const void*[]){A});
+            plasma_stats_stop(PlasmaStatsAux, PlasmaRealFloat, start,
+                              0.0, 2.0*m*n*mb);
+        }
+    }
+}
+
+/***************************************************************************//**
+ *  Same as plasma_core_omp_sgetmi(), but runs whatever the status of the
+ *  sequence. The in-place layout translations use it, so that an array
+ *  translated to tiles is translated back even if the computation failed.
+ ******************************************************************************/
+void plasma_core_omp_sgetmi_always(int m, int n, int mb, float *A)
+{
+    #pragma omp task depend(inout:A[0:m*n*mb])
+    {
+        plasma_time_t start = plasma_stats_start();
+        plasma_core_sgetmi(m, n, mb, A);
+        plasma_trace_tiles("w", (const void*[]){A});
+        plasma_stats_stop(PlasmaStatsAux, PlasmaRealFloat, start,
+                          0.0, 2.0*m*n*mb);
+    }
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/core_blas/core_zgetrf.c, normal z -> s, Fri Sep 28 17:38:19 2018
+ * @generated from core_blas/core_zgetrf.c, normal z -> s, Sat Oct 17 02:13:55 2026
  *
  **/
 
@@ -236,3 +236,244 @@ void plasma_core_sgetrf(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
         }
     }
 }
+
+/***************************************************************************//**
+ *
+ *  Factors columns k to k+n-1 of the panel A column by column,
+ *  swapping rows only within these columns.
+ *  A leaf of plasma_core_sgetrf_recursive().
+ *
+ */
+static void plasma_core_sgetrf_leaf(plasma_desc_t A, int *ipiv, int k, int n,
+                                    int rank, int size,
+                                    volatile int *max_idx,
+                                    volatile float *max_val,
+                                    volatile int *info,
+                                    plasma_barrier_t *barrier)
+{
+    float *a0 = A(0, 0);
+    int lda0 = plasma_tile_mmain(A, 0);
+
+    for (int j = k; j < k+n; j++) {
+        // pivot search
+        max_idx[rank] = j;
+        max_val[rank] = a0[j+j*lda0];
+
+        for (int l = rank; l < A.mt; l += size) {
+            float *al = A(l, 0);
+            int ldal = plasma_tile_mmain(A, l);
+            int mval = plasma_tile_mview(A, l);
+
+            for (int i = (l == 0 ? j+1 : 0); i < mval; i++)
+                if (fabsf(al[i+j*ldal]) >
+                    fabsf(max_val[rank])) {
+
+                    max_val[rank] = al[i+j*ldal];
+                    max_idx[rank] = A.mb*l+i;
+                }
+        }
+
+        plasma_barrier_wait(barrier, size);
+        if (rank == 0) {
+            // max reduction
+            for (int i = 1; i < size; i++) {
+                if (fabsf(max_val[i]) >
+                    fabsf(max_val[0])) {
+                    max_val[0] = max_val[i];
+                    max_idx[0] = max_idx[i];
+                }
+            }
+            int jp = max_idx[0];
+            ipiv[j] = jp+1;
+
+            // singularity check
+            if (*info == 0 && max_val[0] == 0.0) {
+                *info = j+1;
+            }
+            else {
+                // pivot swap
+                if (jp != j) {
+                    float *ap = A(jp/A.mb, 0);
+                    int ldap = plasma_tile_mmain(A, jp/A.mb);
+
+                    cblas_sswap(n,
+                                &a0[j+k*lda0], lda0,
+                                &ap[jp%A.mb+k*ldap], ldap);
+                }
+            }
+        }
+        plasma_barrier_wait(barrier, size);
+
+        // column scaling and update of the leaf (all ranks)
+        float ajj = a0[j+j*lda0];
+        float zmone = -1.0;
+        for (int l = rank; l < A.mt; l += size) {
+            float *al = A(l, 0);
+            int ldal = plasma_tile_mmain(A, l);
+            int i0 = l == 0 ? j+1 : 0;
+            int mval = plasma_tile_mview(A, l)-i0;
+
+            if (mval <= 0)
+                continue;
+
+            if (ajj != 0.0) {
+                float scal = 1.0/ajj;
+                cblas_sscal(mval, (scal), &al[i0+j*ldal], 1);
+            }
+            cblas_sger(CblasColMajor,
+                        mval, k+n-j-1,
+                        (zmone), &al[i0+j*ldal], 1,
+                                            &a0[j+(j+1)*lda0], lda0,
+                                            &al[i0+(j+1)*ldal], ldal);
+        }
+        plasma_barrier_wait(barrier, size);
+    }
+}
+
+/***************************************************************************//**
+ *
+ *  Factors columns k to k+n-1 of the panel A by splitting them in halves,
+ *  swapping rows only within these columns.
+ *
+ */
+static void plasma_core_sgetrf_rec(plasma_desc_t A, int *ipiv, int k, int n,
+                                   int ib, int rank, int size,
+                                   volatile int *max_idx,
+                                   volatile float *max_val,
+                                   volatile int *info,
+                                   plasma_barrier_t *barrier)
+{
+    if (n <= ib) {
+        plasma_core_sgetrf_leaf(A, ipiv, k, n, rank, size,
+                                max_idx, max_val, info, barrier);
+        return;
+    }
+    int n1 = n/2;
+    int n2 = n-n1;
+
+    float *a0 = A(0, 0);
+    int lda0 = plasma_tile_mmain(A, 0);
+
+    // left half
+    plasma_core_sgetrf_rec(A, ipiv, k, n1, ib, rank, size,
+                           max_idx, max_val, info, barrier);
+
+    // right pivoting and trsm (rank 0)
+    if (rank == 0) {
+        for (int i = k; i < k+n1; i++) {
+            int jp = ipiv[i]-1;
+            if (jp != i) {
+                float *ap = A(jp/A.mb, 0);
+                int ldap = plasma_tile_mmain(A, jp/A.mb);
+
+                cblas_sswap(n2,
+                            &a0[i+(k+n1)*lda0], lda0,
+                            &ap[jp%A.mb+(k+n1)*ldap], ldap);
+            }
+        }
+        float zone = 1.0;
+        cblas_strsm(CblasColMajor,
+                    CblasLeft, CblasLower,
+                    CblasNoTrans, CblasUnit,
+                    n1, n2,
+                    (zone), &a0[k+k*lda0], lda0,
+                                       &a0[k+(k+n1)*lda0], lda0);
+    }
+    plasma_barrier_wait(barrier, size);
+
+    // gemm (all ranks)
+    float zone = 1.0;
+    float zmone = -1.0;
+    for (int l = rank; l < A.mt; l += size) {
+        float *al = A(l, 0);
+        int ldal = plasma_tile_mmain(A, l);
+        int i0 = l == 0 ? k+n1 : 0;
+        int mval = plasma_tile_mview(A, l)-i0;
+
+        if (mval > 0)
+            cblas_sgemm(CblasColMajor,
+                        CblasNoTrans, CblasNoTrans,
+                        mval, n2, n1,
+                        (zmone), &al[i0+k*ldal], ldal,
+                                            &a0[k+(k+n1)*lda0], lda0,
+                        (zone),  &al[i0+(k+n1)*ldal], ldal);
+    }
+    plasma_barrier_wait(barrier, size);
+
+    // right half
+    plasma_core_sgetrf_rec(A, ipiv, k+n1, n2, ib, rank, size,
+                           max_idx, max_val, info, barrier);
+
+    // left pivoting (all ranks, each on a block of columns)
+    int nc = (n1+size-1)/size;
+    int c0 = k+rank*nc;
+    nc = imin(nc, k+n1-c0);
+    if (nc > 0) {
+        for (int i = k+n1; i < k+n; i++) {
+            int jp = ipiv[i]-1;
+            if (jp != i) {
+                float *ap = A(jp/A.mb, 0);
+                int ldap = plasma_tile_mmain(A, jp/A.mb);
+
+                cblas_sswap(nc,
+                            &a0[i+c0*lda0], lda0,
+                            &ap[jp%A.mb+c0*ldap], ldap);
+            }
+        }
+    }
+    plasma_barrier_wait(barrier, size);
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_getrf
+ *
+ *  Recursive variant of plasma_core_sgetrf(). Factors the panel by
+ *  splitting its columns in halves, factoring the left half, updating
+ *  the right half with trsm and gemm over the panel tiles, and factoring
+ *  the right half. Most of the flops are in the gemm updates, and the
+ *  threads synchronize per column only in the leaves of at most ib columns.
+ *  The arguments are the same as for plasma_core_sgetrf().
+ *
+ ******************************************************************************/
+__attribute__((weak))
+void plasma_core_sgetrf_recursive(plasma_desc_t A, int *ipiv, int ib,
+                                  int rank, int size,
+                                  volatile int *max_idx,
+                                  volatile float *max_val,
+                                  volatile int *info,
+                                  plasma_barrier_t *barrier)
+{
+    int minmn = imin(A.m, A.n);
+    if (minmn == 0)
+        return;
+
+    plasma_core_sgetrf_rec(A, ipiv, 0, minmn, imax(1, ib), rank, size,
+                           max_idx, max_val, info, barrier);
+
+    // Columns right of a wide panel (rank 0).
+    float *a0 = A(0, 0);
+    int lda0 = plasma_tile_mmain(A, 0);
+    int nva0 = plasma_tile_nview(A, 0);
+    if (rank == 0 && nva0 > minmn) {
+        for (int i = 0; i < minmn; i++) {
+            int jp = ipiv[i]-1;
+            if (jp != i) {
+                float *ap = A(jp/A.mb, 0);
+                int ldap = plasma_tile_mmain(A, jp/A.mb);
+
+                cblas_sswap(nva0-minmn,
+                            &a0[i+minmn*lda0], lda0,
+                            &ap[jp%A.mb+minmn*ldap], ldap);
+            }
+        }
+        float zone = 1.0;
+        cblas_strsm(CblasColMajor,
+                    CblasLeft, CblasLower,
+                    CblasNoTrans, CblasUnit,
+                    minmn, nva0-minmn,
+                    (zone), a0, lda0,
+                                       &a0[minmn*lda0], lda0);
+    }
+    plasma_barrier_wait(barrier, size);
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/core_blas/core_zlacpy.c, normal z -> s, Fri Sep 28 17:38:19 2018
+ * @generated from core_blas/core_zlacpy.c, normal z -> s, Sat Oct 17 02:49:18 2026
  *
  **/
 
@@ -120,10 +120,15 @@ void plasma_core_omp_slacpy(plasma_enum_t uplo, plasma_enum_t transa,
     #pragma omp task depend(in:A[0:lda*n]) \
                      depend(out:B[0:ldb*n])
     {
-        if (sequence->status == PlasmaSuccess)
+        if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             plasma_core_slacpy(uplo, transa,
                         m, n,
                         A, lda,
                         B, ldb);
+            plasma_trace_tiles("rw", (const void*[]){A, B});
+            plasma_stats_stop(PlasmaStatsAux, PlasmaRealFloat, start,
+                              0.0, 2.0*m*n);
+        }
     }
 }
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/core_blas/core_zlansy.c, normal z -> s, Fri Sep 28 17:38:21 2018
+ * @generated from core_blas/core_zlansy.c, normal z -> s, Sat Oct 17 02:49:18 2026
  *
  **/
 
@@ -39,8 +39,13 @@ void plasma_core_omp_slansy(plasma_enum_t norm, plasma_enum_t uplo,
     #pragma omp task depend(in:A[0:lda*n]) \
                      depend(out:value[0:1])
     {
-        if (sequence->status == PlasmaSuccess)
+        if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             plasma_core_slansy(norm, uplo, n, A, lda, work, value);
+            plasma_trace_tiles("rw", (const void*[]){A, value});
+            plasma_stats_stop(PlasmaStatsNorm, PlasmaRealFloat, start,
+                              0.0, 1.0*n*n);
+        }
     }
 }
 
@@ -58,6 +63,7 @@ void plasma_core_omp_slansy_aux(plasma_enum_t norm, plasma_enum_t uplo,
                          depend(out:value[0:n])
         {
             if (sequence->status == PlasmaSuccess) {
+                plasma_time_t start = plasma_stats_start();
                 if (uplo == PlasmaUpper) {
                     for (int i = 0; i < n; i++)
                         value[i] = 0.0;
@@ -82,6 +88,9 @@ void plasma_core_omp_slansy_aux(plasma_enum_t norm, plasma_enum_t uplo,
                         }
                     }
                 }
+                plasma_trace_tiles("rw", (const void*[]){A, value});
+                plasma_stats_stop(PlasmaStatsNorm, PlasmaRealFloat, start,
+                                  0.0, 1.0*n*n);
             }
         }
         break;
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/core_blas/core_zlascl.c, normal z -> s, Fri Sep 28 17:38:21 2018
+ * @generated from core_blas/core_zlascl.c, normal z -> s, Sat Oct 17 04:40:24 2026
  *
  **/
 
@@ -40,12 +40,17 @@ void plasma_core_omp_slascl(plasma_enum_t uplo,
                      float *A, int lda,
                      plasma_sequence_t *sequence, plasma_request_t *request)
 {
-    #pragma omp task depend(inout:A[0:lda*n])
+    #pragma omp task depend(inout:A[0])
     {
-        if (sequence->status == PlasmaSuccess)
+        if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             plasma_core_slascl(uplo,
                         cfrom, cto,
                         m, n,
                         A, lda);
+            plasma_trace_tiles("w", (const void*[]){A});
+            plasma_stats_stop(PlasmaStatsAux, PlasmaRealFloat, start,
+                              0.0, 2.0*m*n);
+        }
     }
 }
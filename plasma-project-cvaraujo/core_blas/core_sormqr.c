@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/core_blas/core_zunmqr.c, normal z -> s, Fri Sep 28 17:38:25 2018
+ * @generated from core_blas/core_zunmqr.c, normal z -> s, Sat Oct 17 02:49:19 2026
  *
  **/
 
@@ -243,9 +243,11 @@ void plasma_core_omp_sormqr(plasma_enum_t side, plasma_enum_t trans,
 {
     #pragma omp task depend(in:A[0:lda*k]) \
                      depend(in:T[0:ib*k]) \
-                     depend(inout:C[0:ldc*n])
+                     depend(inout:C[0:ldc*n]) \
+                     priority(plasma_task_priority())
     {
         if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             // Prepare workspaces.
             int tid = omp_get_thread_num();
             float *W = (float*)work.spaces[tid];
@@ -263,6 +265,10 @@ void plasma_core_omp_sormqr(plasma_enum_t side, plasma_enum_t trans,
                 plasma_error("core_sormqr() failed");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
+            plasma_trace_tiles("rrw", (const void*[]){A, T, C});
+            plasma_stats_stop(PlasmaStatsUnmqr, PlasmaRealFloat, start,
+                              4.0*m*n*k,
+                              2.0*m*n+(side == PlasmaLeft ? m : n)*1.0*k);
         }
     }
 }
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/core_blas/core_ztradd.c, normal z -> s, Fri Sep 28 17:38:23 2018
+ * @generated from core_blas/core_ztradd.c, normal z -> s, Sat Oct 17 02:49:19 2026
  *
  **/
 
@@ -196,6 +196,7 @@ void plasma_core_omp_stradd(
                      depend(inout:B[0:ldb*n])
     {
         if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             int retval = plasma_core_stradd(uplo, transa,
                                      m, n,
                                      alpha, A, lda,
@@ -204,6 +205,9 @@ void plasma_core_omp_stradd(
                 plasma_error("core_stradd() failed");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
+            plasma_trace_tiles("rw", (const void*[]){A, B});
+            plasma_stats_stop(PlasmaStatsAux, PlasmaRealFloat, start,
+                              0.0, 3.0*m*n);
         }
     }
 }
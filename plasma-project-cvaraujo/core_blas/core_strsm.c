@@ -12,6 +12,10 @@
 
 #include <plasma_core_blas.h>
 #include "plasma_types.h"
+#include "plasma_graph.h"
+#include "plasma_hier.h"
+#include "plasma_internal.h"
+#include "plasma_tile_cache.h"
 #include "core_lapack.h"
 
 /***************************************************************************//**
@@ -99,6 +103,39 @@ void plasma_core_strsm(plasma_enum_t side, plasma_enum_t uplo,
                                     B, ldb);
 }
 
+/******************************************************************************/
+typedef struct {
+    plasma_enum_t side;
+    plasma_enum_t uplo;
+    plasma_enum_t transa;
+    plasma_enum_t diag;
+    int m;
+    int n;
+    float alpha;
+    int lda;
+    int ldb;
+} plasma_core_strsm_args_t;
+
+/******************************************************************************/
+static void plasma_core_strsm_graph(const void *args_, void **tiles,
+                                    plasma_sequence_t *sequence,
+                                    plasma_request_t *request)
+{
+    const plasma_core_strsm_args_t *args =
+        (const plasma_core_strsm_args_t*)args_;
+    int ak = args->side == PlasmaLeft ? args->m : args->n;
+    plasma_time_t start = plasma_stats_start();
+    plasma_core_strsm(args->side, args->uplo,
+                      args->transa, args->diag,
+                      args->m, args->n,
+                      args->alpha, tiles[0], args->lda,
+                                   tiles[1], args->ldb);
+    plasma_trace_tiles("rw", (const void*[]){tiles[0], tiles[1]});
+    plasma_stats_stop(PlasmaStatsTrsm, PlasmaRealFloat, start,
+                      1.0*args->m*args->n*ak,
+                      1.0*ak*ak+2.0*args->m*args->n);
+}
+
 /******************************************************************************/
 void plasma_core_omp_strsm_default(
 			   plasma_enum_t side, plasma_enum_t uplo,
@@ -117,13 +154,19 @@ void plasma_core_omp_strsm_default(
   int size_A = lda*ak, size_B = ldb*n;
 
 #pragma omp task depend(in:A[0:lda*ak])		\
-                     depend(inout:B[0:ldb*n])
+                     depend(inout:B[0:ldb*n])	\
+                     affinity(B[0:ldb*n])	\
+                     priority(plasma_task_priority())
   {
+    plasma_time_t start = plasma_stats_start();
     plasma_core_strsm(side_, uplo_,
 		      transa_, diag_,
 		      m, n,
 		      alpha, A, lda,
 		      B, ldb);
+    plasma_trace_tiles("rw", (const void*[]){A, B});
+    plasma_stats_stop(PlasmaStatsTrsm, PlasmaRealFloat, start,
+		      1.0*m*n*ak, 1.0*ak*ak+2.0*m*n);
   }
 }
 
@@ -135,73 +178,35 @@ void plasma_core_omp_strsm(
     const float *A, int lda, float *B, int ldb,
     plasma_sequence_t *sequence, plasma_request_t *request)
 {
+  if (plasma_graph_capturing()) {
+    plasma_core_strsm_args_t args = {
+        side, uplo, transa, diag, m, n, alpha, lda, ldb
+    };
+    const void *tiles[] = {A, B};
+    const int write[] = {0, 1};
+    plasma_graph_record(plasma_core_strsm_graph, &args, sizeof(args),
+                        2, tiles, write);
+    return;
+  }
 
-  if (m <= 64 || n <= 64) {
-    plasma_core_omp_strsm_default(side, uplo,
-				  transa, diag,
-				  m, n, alpha,
-				  A, lda, B, ldb,
-				  sequence, request);
+  if (plasma_hier_offload(m, n)) {
+    plasma_core_omp_shier_trsm(side, uplo,
+			       transa, diag,
+			       m, n,
+			       alpha, A, lda,
+			       B, ldb,
+			       sequence, request);
   } else {
     int ak;
     if (side == PlasmaLeft) ak = m;
     else ak = n;
 
-    int side_ = side, uplo_ = uplo, transa_ = transa, diag_ = diag;
-    int size_A = lda * ak, size_B = ldb * n;
-#pragma target nowait depend(in:A[0:lda*ak])				\
-  depend(inout:B[0:ldb*n])						\
-  map(tofrom: B[0:ldb*n])						\
-  map(to: A[0:lda*ak])							\
-  firstprivate(side_, uplo_, transa_, diag_, m, n, alpha, lda, ldb)
-
-    if (sequence->status == PlasmaSuccess) {
-      int transa_ = transa;
-      int block_size = (lda < 128) ? lda : 128;
-      int size_matrix = ldb;
-      int m_new = m/block_size;
-      int n_new = n/block_size;
-
-#pragma omp parallel
-#pragma omp single 
-      {
-	for(int m_ = 0; m_ < m_new; m_++) {
-	  for(int n_ = 0; n_ < n_new; n_++) {
-	    int k_ = m_;
-	    int lda_ = m_ * block_size + k_ * block_size;
-	    int ldb_ = k_ * block_size + n_ * block_size;
-#pragma omp task
-	    {
-	      float A_new[block_size*block_size], B_new[block_size*block_size];
-	      int i_a = m_, j_a = k_;
-	      int i_b = k_, j_b = n_;
-	      int insert = 0;
-
-	      for(int l = 0; l < block_size; l++) {
-		int bef_a = i_a * block_size + j_a * lda * block_size + l*size_matrix;
-		int bef_b = i_b * block_size + j_b * lda * block_size + l*size_matrix;
-
-		for (int k = 0; k < block_size; k++) {
-		  A_new[insert] = A[bef_a++];
-		  B_new[insert++] = B[bef_b++];
-		}
-	      }
-
-	      plasma_core_strsm(side_, uplo_,
-				transa_, diag_,
-				block_size, block_size,
-				alpha, (const float *) A_new, block_size,
-				(float *) B_new, block_size);
-
-	      insert = 0;
-	      for(int l=0;l<block_size;l++) {
-		int before_b = i_b*block_size+j_b*lda*block_size + l*size_matrix;
-		for (int i = 0; i < block_size; i++) B[before_b++] = B_new[insert++];
-	      }
-	    }
-	  }
-	}
-      }
-    }
+    plasma_tile_cache_host(A, sizeof(float)*lda*ak, 0);
+    plasma_tile_cache_host(B, sizeof(float)*ldb*n, 1);
+    plasma_core_omp_strsm_default(side, uplo,
+				  transa, diag,
+				  m, n, alpha,
+				  A, lda, B, ldb,
+				  sequence, request);
   }
 }
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/core_blas/core_zttmqr.c, normal z -> s, Fri Sep 28 17:38:25 2018
+ * @generated from core_blas/core_zttmqr.c, normal z -> s, Sat Oct 17 02:49:19 2026
  *
  **/
 
@@ -270,6 +270,7 @@ void plasma_core_omp_sttmqr(plasma_enum_t side, plasma_enum_t trans,
                      depend(in:T[0:ib*k])
     {
         if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             // Prepare workspaces.
             int tid = omp_get_thread_num();
             float *W = (float*)work.spaces[tid];
@@ -288,6 +289,9 @@ void plasma_core_omp_sttmqr(plasma_enum_t side, plasma_enum_t trans,
                 plasma_error("core_sttmqr() failed");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
+            plasma_trace_tiles("wwrr", (const void*[]){A1, A2, V, T});
+            plasma_stats_stop(PlasmaStatsTsmqr, PlasmaRealFloat, start,
+                              2.0*m2*n2*k, 2.0*m1*n1+2.0*m2*n2);
         }
     }
 }
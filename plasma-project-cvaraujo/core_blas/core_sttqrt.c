@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/core_blas/core_zttqrt.c, normal z -> s, Fri Sep 28 17:38:25 2018
+ * @generated from core_blas/core_zttqrt.c, normal z -> s, Sat Oct 17 02:49:19 2026
  *
  **/
 
@@ -248,6 +248,7 @@ void plasma_core_omp_sttqrt(int m, int n, int ib,
                      depend(out:T[0:ib*n])
     {
         if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             // Prepare workspaces.
             int tid = omp_get_thread_num();
             float *tau = ((float*)work.spaces[tid]);
@@ -264,6 +265,9 @@ void plasma_core_omp_sttqrt(int m, int n, int ib,
                 plasma_error("core_sttqrt() failed");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
+            plasma_trace_tiles("www", (const void*[]){A1, A2, T});
+            plasma_stats_stop(PlasmaStatsTsqrt, PlasmaRealFloat, start,
+                              2.0*n*n*n/3.0, 4.0*n*n);
         }
     }
 }
@@ -144,12 +144,11 @@ void plasma_core_omp_zgeadd(
     plasma_complex64_t beta,        plasma_complex64_t *B, int ldb,
     plasma_sequence_t *sequence, plasma_request_t *request)
 {
-    int k = (transa == PlasmaNoTrans) ? n : m;
-
-    #pragma omp task depend(in:A[0:lda*k]) \
-                     depend(inout:B[0:ldb*n])
+    #pragma omp task depend(in:A[0]) \
+                     depend(inout:B[0])
     {
         if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             int retval = plasma_core_zgeadd(transa,
                                      m, n,
                                      alpha, A, lda,
@@ -158,6 +157,9 @@ void plasma_core_omp_zgeadd(
                 plasma_error("core_zgeadd() failed");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
+            plasma_trace_tiles("rw", (const void*[]){A, B});
+            plasma_stats_stop(PlasmaStatsAux, PlasmaComplexDouble, start,
+                              0.0, 3.0*m*n);
         }
     }
 }
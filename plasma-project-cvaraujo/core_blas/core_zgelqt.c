@@ -180,6 +180,7 @@ void plasma_core_omp_zgelqt(int m, int n, int ib,
                                            // as ibxm
     {
         if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             // Prepare workspaces.
             int tid = omp_get_thread_num();
             plasma_complex64_t *tau = (plasma_complex64_t*)work.spaces[tid];
@@ -195,6 +196,9 @@ void plasma_core_omp_zgelqt(int m, int n, int ib,
                 plasma_error("core_zgelqt() failed");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
+            plasma_trace_tiles("ww", (const void*[]){A, T});
+            plasma_stats_stop(PlasmaStatsGeqrt, PlasmaComplexDouble, start,
+                              2.0*m*m*(n-m/3.0), 2.0*m*n);
         }
     }
 }
@@ -176,9 +176,11 @@ void plasma_core_omp_zgeqrt(int m, int n, int ib,
                      plasma_sequence_t *sequence, plasma_request_t *request)
 {
     #pragma omp task depend(inout:A[0:lda*n]) \
-                     depend(out:T[0:ib*n])
+                     depend(out:T[0:ib*n]) \
+                     priority(plasma_task_priority())
     {
         if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             // Prepare workspaces.
             int tid = omp_get_thread_num();
             plasma_complex64_t *tau = ((plasma_complex64_t*)work.spaces[tid]);
@@ -194,6 +196,9 @@ void plasma_core_omp_zgeqrt(int m, int n, int ib,
                 plasma_error("core_zgeqrt() failed");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
+            plasma_trace_tiles("ww", (const void*[]){A, T});
+            plasma_stats_stop(PlasmaStatsGeqrt, PlasmaComplexDouble, start,
+                              2.0*n*n*(m-n/3.0), 2.0*m*n);
         }
     }
 }
@@ -90,10 +90,15 @@ void plasma_core_omp_zhegst(int itype, plasma_enum_t uplo,
     #pragma omp task depend(inout:A[0:lda*n]) \
                      depend(in:B[0:ldb*n])
     {
-        if (sequence->status == PlasmaSuccess)
+        if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             plasma_core_zhegst(itype, uplo,
                         n,
                         A, lda,
                         B, ldb);
+            plasma_trace_tiles("wr", (const void*[]){A, B});
+            plasma_stats_stop(PlasmaStatsHegst, PlasmaComplexDouble, start,
+                              1.0*n*n*n, 3.0*n*n);
+        }
     }
 }
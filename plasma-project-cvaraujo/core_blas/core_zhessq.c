@@ -64,9 +64,13 @@ void plasma_core_omp_zhessq(plasma_enum_t uplo,
                      depend(out:sumsq[0:n])
     {
         if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             *scale = 0.0;
             *sumsq = 1.0;
             plasma_core_zhessq(uplo, n, A, lda, scale, sumsq);
+            plasma_trace_tiles("rww", (const void*[]){A, scale, sumsq});
+            plasma_stats_stop(PlasmaStatsNorm, PlasmaComplexDouble, start,
+                              0.0, 1.0*n*n);
         }
     }
 }
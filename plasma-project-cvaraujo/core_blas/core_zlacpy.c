@@ -120,10 +120,15 @@ void plasma_core_omp_zlacpy(plasma_enum_t uplo, plasma_enum_t transa,
     #pragma omp task depend(in:A[0:lda*n]) \
                      depend(out:B[0:ldb*n])
     {
-        if (sequence->status == PlasmaSuccess)
+        if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             plasma_core_zlacpy(uplo, transa,
                         m, n,
                         A, lda,
                         B, ldb);
+            plasma_trace_tiles("rw", (const void*[]){A, B});
+            plasma_stats_stop(PlasmaStatsAux, PlasmaComplexDouble, start,
+                              0.0, 2.0*m*n);
+        }
     }
 }
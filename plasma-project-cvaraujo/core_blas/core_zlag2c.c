@@ -62,7 +62,12 @@ void plasma_core_omp_zlag2c(int m, int n,
     #pragma omp task depend(in:A[0:lda*n]) \
                      depend(out:As[0:ldas*n])
     {
-        if (sequence->status == PlasmaSuccess)
+        if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             plasma_core_zlag2c(m, n, A, lda, As, ldas);
+            plasma_trace_tiles("rw", (const void*[]){A, As});
+            plasma_stats_stop(PlasmaStatsAux, PlasmaComplexDouble, start,
+                              0.0, 2.0*m*n);
+        }
     }
 }
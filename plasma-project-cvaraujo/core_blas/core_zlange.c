@@ -67,11 +67,16 @@ void plasma_core_omp_zlange(plasma_enum_t norm, int m, int n,
                      double *work, double *value,
                      plasma_sequence_t *sequence, plasma_request_t *request)
 {
-    #pragma omp task depend(in:A[0:lda*n]) \
+    #pragma omp task depend(in:A[0]) \
                      depend(out:value[0:1])
     {
-        if (sequence->status == PlasmaSuccess)
+        if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             plasma_core_zlange(norm, m, n, A, lda, work, value);
+            plasma_trace_tiles("rw", (const void*[]){A, value});
+            plasma_stats_stop(PlasmaStatsNorm, PlasmaComplexDouble, start,
+                              0.0, 1.0*m*n);
+        }
     }
 }
 
@@ -83,24 +88,29 @@ void plasma_core_omp_zlange_aux(plasma_enum_t norm, int m, int n,
 {
     switch (norm) {
     case PlasmaOneNorm:
-        #pragma omp task depend(in:A[0:lda*n]) \
+        #pragma omp task depend(in:A[0]) \
                          depend(out:value[0:n])
         {
             if (sequence->status == PlasmaSuccess) {
+                plasma_time_t start = plasma_stats_start();
                 for (int j = 0; j < n; j++) {
                     value[j] = cabs(A[lda*j]);
                     for (int i = 1; i < m; i++) {
                         value[j] += cabs(A[lda*j+i]);
                     }
                 }
+                plasma_trace_tiles("rw", (const void*[]){A, value});
+                plasma_stats_stop(PlasmaStatsNorm, PlasmaComplexDouble, start,
+                                  0.0, 1.0*m*n);
             }
         }
         break;
     case PlasmaInfNorm:
-        #pragma omp task depend(in:A[0:lda*n]) \
+        #pragma omp task depend(in:A[0]) \
                          depend(out:value[0:m])
         {
             if (sequence->status == PlasmaSuccess) {
+                plasma_time_t start = plasma_stats_start();
                 for (int i = 0; i < m; i++)
                     value[i] = 0.0;
 
@@ -109,6 +119,9 @@ void plasma_core_omp_zlange_aux(plasma_enum_t norm, int m, int n,
                         value[i] += cabs(A[lda*j+i]);
                     }
                 }
+                plasma_trace_tiles("rw", (const void*[]){A, value});
+                plasma_stats_stop(PlasmaStatsNorm, PlasmaComplexDouble, start,
+                                  0.0, 1.0*m*n);
             }
         }
         break;
@@ -40,12 +40,17 @@ void plasma_core_omp_zlascl(plasma_enum_t uplo,
                      plasma_complex64_t *A, int lda,
                      plasma_sequence_t *sequence, plasma_request_t *request)
 {
-    #pragma omp task depend(inout:A[0:lda*n])
+    #pragma omp task depend(inout:A[0])
     {
-        if (sequence->status == PlasmaSuccess)
+        if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             plasma_core_zlascl(uplo,
                         cfrom, cto,
                         m, n,
                         A, lda);
+            plasma_trace_tiles("w", (const void*[]){A});
+            plasma_stats_stop(PlasmaStatsAux, PlasmaComplexDouble, start,
+                              0.0, 2.0*m*n);
+        }
     }
 }
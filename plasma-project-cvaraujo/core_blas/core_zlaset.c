@@ -78,7 +78,13 @@ void plasma_core_omp_zlaset(plasma_enum_t uplo,
                      plasma_complex64_t *A)
 {
     #pragma omp task depend(out:A[0:mb*nb])
-    plasma_core_zlaset(uplo, m, n,
-                alpha, beta,
-                A+i+j*mb, mb);
+    {
+        plasma_time_t start = plasma_stats_start();
+        plasma_core_zlaset(uplo, m, n,
+                    alpha, beta,
+                    A+i+j*mb, mb);
+        plasma_trace_tiles("w", (const void*[]){A});
+        plasma_stats_stop(PlasmaStatsAux, PlasmaComplexDouble, start,
+                          0.0, 1.0*m*n);
+    }
 }
@@ -72,11 +72,15 @@ void plasma_core_omp_zlauum(plasma_enum_t uplo,
     #pragma omp task depend(inout:A[0:lda*n])
     {
         if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             int info = plasma_core_zlauum(uplo, n, A, lda);
             if (info != PlasmaSuccess) {
                 plasma_coreblas_error("core_zlauum() failed");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
+            plasma_trace_tiles("w", (const void*[]){A});
+            plasma_stats_stop(PlasmaStatsTrtri, PlasmaComplexDouble, start,
+                              1.0*n*n*n/3.0, 2.0*n*n);
         }
     }
 }
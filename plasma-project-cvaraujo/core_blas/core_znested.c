@@ -0,0 +1,464 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @precisions normal z -> c d s
+ *
+ **/
+
+#include <plasma_core_blas.h>
+#include "plasma_graph.h"
+#include "plasma_hier.h"
+#include "plasma_internal.h"
+#include "plasma_tile_cache.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+#include <omp.h>
+
+/***************************************************************************//**
+ *
+ * @ingroup core_geqrt
+ *
+ *  Computes the QR factorization of the tile A, see plasma_core_zgeqrt(),
+ *  by blocks of ib columns, with the application of the block reflectors
+ *  of each step to the trailing columns split into num_tasks nested tasks.
+ *  The nested tasks use disjoint parts of work, of size ib*n.
+ *
+ *  Must be called from a task. Returns when A and T are computed.
+ *
+ ******************************************************************************/
+void plasma_core_znested_geqrt(int m, int n, int ib,
+                               plasma_complex64_t *A, int lda,
+                               plasma_complex64_t *T, int ldt,
+                               plasma_complex64_t *tau,
+                               plasma_complex64_t *work,
+                               int num_tasks)
+{
+    int k = imin(m, n);
+    for (int i = 0; i < k; i += ib) {
+        int sb = imin(ib, k-i);
+        plasma_complex64_t *aii = &A[i+(size_t)lda*i];
+        LAPACKE_zgeqr2_work(LAPACK_COL_MAJOR,
+                            m-i, sb,
+                            aii, lda,
+                            &tau[i], work);
+
+        LAPACKE_zlarft_work(LAPACK_COL_MAJOR,
+                            lapack_const(PlasmaForward),
+                            lapack_const(PlasmaColumnwise),
+                            m-i, sb,
+                            aii, lda,
+                            &tau[i],
+                            &T[(size_t)ldt*i], ldt);
+
+        int count = n-i-sb;
+        if (count > 0) {
+            int chunk = (count+num_tasks-1)/num_tasks;
+            #pragma omp taskloop num_tasks(num_tasks) \
+                                 priority(plasma_task_priority_nested())
+            for (int j = 0; j < count; j += chunk) {
+                int size = imin(chunk, count-j);
+                LAPACKE_zlarfb_work(LAPACK_COL_MAJOR,
+                                    lapack_const(PlasmaLeft),
+                                    lapack_const(Plasma_ConjTrans),
+                                    lapack_const(PlasmaForward),
+                                    lapack_const(PlasmaColumnwise),
+                                    m-i, size, sb,
+                                    aii, lda,
+                                    &T[(size_t)ldt*i], ldt,
+                                    &A[i+(size_t)lda*(i+sb+j)], lda,
+                                    &work[(size_t)sb*j], size);
+            }
+        }
+    }
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_potrf
+ *
+ *  Performs the Cholesky factorization of the tile A, see
+ *  plasma_core_zpotrf(), by blocks of ib columns (rows), with the
+ *  triangular solves and the updates of the trailing blocks of each step
+ *  split into num_tasks nested tasks.
+ *
+ *  Must be called from a task. Returns when A is factored,
+ *  with the same value as plasma_core_zpotrf().
+ *
+ ******************************************************************************/
+int plasma_core_znested_potrf(plasma_enum_t uplo,
+                              int n,
+                              plasma_complex64_t *A, int lda,
+                              int ib, int num_tasks)
+{
+    for (int j = 0; j < n; j += ib) {
+        int jb = imin(ib, n-j);
+        plasma_complex64_t *ajj = &A[j+(size_t)lda*j];
+        int info = plasma_core_zpotrf(uplo, jb, ajj, lda);
+        if (info != 0)
+            return j+info;
+
+        int nblk = (n-j-jb+ib-1)/ib;
+        if (uplo == PlasmaLower) {
+            #pragma omp taskloop num_tasks(num_tasks) \
+                                 priority(plasma_task_priority_nested())
+            for (int i = 0; i < nblk; i++) {
+                int i0 = j+jb+i*ib;
+                int mb = imin(ib, n-i0);
+                plasma_core_ztrsm(PlasmaRight, PlasmaLower,
+                                  PlasmaConjTrans, PlasmaNonUnit,
+                                  mb, jb,
+                                  1.0, ajj, lda,
+                                       &A[i0+(size_t)lda*j], lda);
+            }
+            #pragma omp taskloop num_tasks(num_tasks) \
+                                 priority(plasma_task_priority_nested())
+            for (int i = 0; i < nblk; i++) {
+                int i0 = j+jb+i*ib;
+                int mb = imin(ib, n-i0);
+                plasma_core_zherk(PlasmaLower, PlasmaNoTrans,
+                                  mb, jb,
+                                  -1.0, &A[i0+(size_t)lda*j], lda,
+                                   1.0, &A[i0+(size_t)lda*i0], lda);
+                if (n-i0-mb > 0) {
+                    plasma_core_zgemm(PlasmaNoTrans, PlasmaConjTrans,
+                                      n-i0-mb, mb, jb,
+                                      -1.0, &A[i0+mb+(size_t)lda*j], lda,
+                                            &A[i0+(size_t)lda*j], lda,
+                                       1.0, &A[i0+mb+(size_t)lda*i0], lda);
+                }
+            }
+        }
+        else {
+            #pragma omp taskloop num_tasks(num_tasks) \
+                                 priority(plasma_task_priority_nested())
+            for (int i = 0; i < nblk; i++) {
+                int i0 = j+jb+i*ib;
+                int nb = imin(ib, n-i0);
+                plasma_core_ztrsm(PlasmaLeft, PlasmaUpper,
+                                  PlasmaConjTrans, PlasmaNonUnit,
+                                  jb, nb,
+                                  1.0, ajj, lda,
+                                       &A[j+(size_t)lda*i0], lda);
+            }
+            #pragma omp taskloop num_tasks(num_tasks) \
+                                 priority(plasma_task_priority_nested())
+            for (int i = 0; i < nblk; i++) {
+                int i0 = j+jb+i*ib;
+                int nb = imin(ib, n-i0);
+                plasma_core_zherk(PlasmaUpper, PlasmaConjTrans,
+                                  nb, jb,
+                                  -1.0, &A[j+(size_t)lda*i0], lda,
+                                   1.0, &A[i0+(size_t)lda*i0], lda);
+                if (n-i0-nb > 0) {
+                    plasma_core_zgemm(PlasmaConjTrans, PlasmaNoTrans,
+                                      nb, n-i0-nb, jb,
+                                      -1.0, &A[j+(size_t)lda*i0], lda,
+                                            &A[j+(size_t)lda*(i0+nb)], lda,
+                                       1.0, &A[i0+(size_t)lda*(i0+nb)], lda);
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_trsm
+ *
+ *  Solves the triangular system of the tiles A and B, see
+ *  plasma_core_ztrsm(), with the independent rows (columns) of B
+ *  split into num_tasks nested tasks.
+ *
+ *  Must be called from a task. Returns when B is computed.
+ *
+ ******************************************************************************/
+void plasma_core_znested_trsm(plasma_enum_t side, plasma_enum_t uplo,
+                              plasma_enum_t transa, plasma_enum_t diag,
+                              int m, int n,
+                              plasma_complex64_t alpha,
+                              const plasma_complex64_t *A, int lda,
+                                    plasma_complex64_t *B, int ldb,
+                              int num_tasks)
+{
+    int count = side == PlasmaLeft ? n : m;
+    if (count == 0)
+        return;
+
+    int chunk = (count+num_tasks-1)/num_tasks;
+
+    #pragma omp taskloop num_tasks(num_tasks) \
+                         priority(plasma_task_priority_nested())
+    for (int i = 0; i < count; i += chunk) {
+        int size = imin(chunk, count-i);
+        if (side == PlasmaLeft)
+            plasma_core_ztrsm(side, uplo, transa, diag,
+                              m, size,
+                              alpha, A, lda,
+                                     &B[(size_t)ldb*i], ldb);
+        else
+            plasma_core_ztrsm(side, uplo, transa, diag,
+                              size, n,
+                              alpha, A, lda,
+                                     &B[i], ldb);
+    }
+}
+
+/***************************************************************************//**
+ *
+ * @ingroup core_trtri
+ *
+ *  Computes the inverse of the triangular tile A, see plasma_core_ztrtri(),
+ *  by blocks of ib columns (rows), as plasma_pztrtri() does by tiles, with
+ *  the triangular solves and the updates of each step split into num_tasks
+ *  nested tasks.
+ *
+ *  Must be called from a task. Returns when A is inverted,
+ *  with the same value as plasma_core_ztrtri().
+ *
+ ******************************************************************************/
+int plasma_core_znested_trtri(plasma_enum_t uplo, plasma_enum_t diag,
+                              int n,
+                              plasma_complex64_t *A, int lda,
+                              int ib, int num_tasks)
+{
+    // Check for singularity first, as the solves divide by the diagonal.
+    if (diag == PlasmaNonUnit) {
+        for (int i = 0; i < n; i++)
+            if (A[i+(size_t)lda*i] == 0.0)
+                return i+1;
+    }
+
+    for (int k = 0; k < n; k += ib) {
+        int kb = imin(ib, n-k);
+        plasma_complex64_t *akk = &A[k+(size_t)lda*k];
+        int nblk = (n-k-kb+ib-1)/ib;
+        if (uplo == PlasmaLower) {
+            #pragma omp taskloop num_tasks(num_tasks) \
+                                 priority(plasma_task_priority_nested())
+            for (int i = 0; i < nblk; i++) {
+                int i0 = k+kb+i*ib;
+                int mb = imin(ib, n-i0);
+                plasma_core_ztrsm(PlasmaRight, PlasmaLower,
+                                  PlasmaNoTrans, diag,
+                                  mb, kb,
+                                  -1.0, akk, lda,
+                                        &A[i0+(size_t)lda*k], lda);
+                if (k > 0) {
+                    plasma_core_zgemm(PlasmaNoTrans, PlasmaNoTrans,
+                                      mb, k, kb,
+                                      1.0, &A[i0+(size_t)lda*k], lda,
+                                           &A[k], lda,
+                                      1.0, &A[i0], lda);
+                }
+            }
+            #pragma omp taskloop num_tasks(num_tasks) \
+                                 priority(plasma_task_priority_nested())
+            for (int j = 0; j < k; j += ib) {
+                plasma_core_ztrsm(PlasmaLeft, PlasmaLower,
+                                  PlasmaNoTrans, diag,
+                                  kb, ib,
+                                  1.0, akk, lda,
+                                       &A[k+(size_t)lda*j], lda);
+            }
+        }
+        else {
+            #pragma omp taskloop num_tasks(num_tasks) \
+                                 priority(plasma_task_priority_nested())
+            for (int i = 0; i < nblk; i++) {
+                int i0 = k+kb+i*ib;
+                int nb = imin(ib, n-i0);
+                plasma_core_ztrsm(PlasmaLeft, PlasmaUpper,
+                                  PlasmaNoTrans, diag,
+                                  kb, nb,
+                                  -1.0, akk, lda,
+                                        &A[k+(size_t)lda*i0], lda);
+            }
+            #pragma omp taskloop num_tasks(num_tasks) \
+                                 priority(plasma_task_priority_nested())
+            for (int j = 0; j < k; j += ib) {
+                if (n-k-kb > 0) {
+                    plasma_core_zgemm(PlasmaNoTrans, PlasmaNoTrans,
+                                      ib, n-k-kb, kb,
+                                      1.0, &A[j+(size_t)lda*k], lda,
+                                           &A[k+(size_t)lda*(k+kb)], lda,
+                                      1.0, &A[j+(size_t)lda*(k+kb)], lda);
+                }
+                plasma_core_ztrsm(PlasmaRight, PlasmaUpper,
+                                  PlasmaNoTrans, diag,
+                                  ib, kb,
+                                  1.0, akk, lda,
+                                       &A[j+(size_t)lda*k], lda);
+            }
+        }
+        plasma_core_ztrtri(uplo, diag, kb, akk, lda);
+    }
+    return 0;
+}
+
+/******************************************************************************/
+void plasma_core_omp_znested_geqrt(int m, int n, int ib,
+                                   plasma_complex64_t *A, int lda,
+                                   plasma_complex64_t *T, int ldt,
+                                   plasma_workspace_t work,
+                                   int num_tasks,
+                                   plasma_sequence_t *sequence,
+                                   plasma_request_t *request)
+{
+    if (num_tasks <= 1 || ib >= n) {
+        plasma_core_omp_zgeqrt(m, n, ib,
+                               A, lda,
+                               T, ldt,
+                               work,
+                               sequence, request);
+        return;
+    }
+
+    #pragma omp task depend(inout:A[0:lda*n]) \
+                     depend(out:T[0:ib*n]) \
+                     affinity(A[0:lda*n]) \
+                     priority(plasma_task_priority())
+    {
+        if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
+            // Prepare workspaces.
+            int tid = omp_get_thread_num();
+            plasma_complex64_t *tau = ((plasma_complex64_t*)work.spaces[tid]);
+
+            plasma_core_znested_geqrt(m, n, ib,
+                                      A, lda,
+                                      T, ldt,
+                                      tau,
+                                      tau+n,
+                                      num_tasks);
+            plasma_trace_tiles("ww", (const void*[]){A, T});
+            plasma_stats_stop(PlasmaStatsGeqrt, PlasmaComplexDouble, start,
+                              2.0*n*n*(m-n/3.0), 2.0*m*n);
+        }
+    }
+}
+
+/******************************************************************************/
+void plasma_core_omp_znested_potrf(plasma_enum_t uplo,
+                                   int n,
+                                   plasma_complex64_t *A, int lda,
+                                   int ib, int num_tasks,
+                                   int iinfo,
+                                   plasma_sequence_t *sequence,
+                                   plasma_request_t *request)
+{
+    // Task graphs and offloaded tiles only record whole kernels.
+    if (num_tasks <= 1 || ib >= n ||
+        plasma_graph_capturing() || plasma_hier_offload(n, n)) {
+        plasma_core_omp_zpotrf(uplo, n, A, lda, iinfo, sequence, request);
+        return;
+    }
+
+    plasma_tile_cache_host(A, sizeof(plasma_complex64_t)*lda*n, 1);
+
+    #pragma omp task depend(inout:A[0:lda*n]) \
+                     affinity(A[0:lda*n]) \
+                     priority(plasma_task_priority())
+    {
+        if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
+            int info = plasma_core_znested_potrf(uplo,
+                                                 n,
+                                                 A, lda,
+                                                 ib, num_tasks);
+            if (info != 0)
+                plasma_request_fail(sequence, request, iinfo+info);
+            plasma_trace_tiles("w", (const void*[]){A});
+            plasma_stats_stop(PlasmaStatsPotrf, PlasmaComplexDouble, start,
+                              1.0*n*n*n/3.0, 2.0*n*n);
+        }
+    }
+}
+
+/******************************************************************************/
+void plasma_core_omp_znested_trsm(
+    plasma_enum_t side, plasma_enum_t uplo,
+    plasma_enum_t transa, plasma_enum_t diag,
+    int m, int n,
+    plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
+                                    plasma_complex64_t *B, int ldb,
+    int num_tasks,
+    plasma_sequence_t *sequence, plasma_request_t *request)
+{
+    if (num_tasks <= 1 ||
+        plasma_graph_capturing() || plasma_hier_offload(m, n)) {
+        plasma_core_omp_ztrsm(side, uplo, transa, diag, m, n,
+                              alpha, A, lda,
+                                     B, ldb,
+                              sequence, request);
+        return;
+    }
+
+    int ak;
+    if (side == PlasmaLeft)
+        ak = m;
+    else
+        ak = n;
+
+    plasma_tile_cache_host(A, sizeof(plasma_complex64_t)*lda*ak, 0);
+    plasma_tile_cache_host(B, sizeof(plasma_complex64_t)*ldb*n, 1);
+
+    #pragma omp task depend(in:A[0:lda*ak]) \
+                     depend(inout:B[0:ldb*n]) \
+                     affinity(B[0:ldb*n]) \
+                     priority(plasma_task_priority())
+    {
+        if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
+            plasma_core_znested_trsm(side, uplo,
+                                     transa, diag,
+                                     m, n,
+                                     alpha, A, lda,
+                                            B, ldb,
+                                     num_tasks);
+            plasma_trace_tiles("rw", (const void*[]){A, B});
+            plasma_stats_stop(PlasmaStatsTrsm, PlasmaComplexDouble, start,
+                              1.0*m*n*ak, 1.0*ak*ak+2.0*m*n);
+        }
+    }
+}
+
+/******************************************************************************/
+void plasma_core_omp_znested_trtri(plasma_enum_t uplo, plasma_enum_t diag,
+                                   int n,
+                                   plasma_complex64_t *A, int lda,
+                                   int ib, int num_tasks,
+                                   int iinfo,
+                                   plasma_sequence_t *sequence,
+                                   plasma_request_t *request)
+{
+    if (num_tasks <= 1 || ib >= n) {
+        plasma_core_omp_ztrtri(uplo, diag, n, A, lda,
+                               iinfo, sequence, request);
+        return;
+    }
+
+    #pragma omp task depend(inout:A[0:lda*n]) \
+                     affinity(A[0:lda*n]) \
+                     priority(plasma_task_priority())
+    {
+        if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
+            int info = plasma_core_znested_trtri(uplo, diag,
+                                                 n,
+                                                 A, lda,
+                                                 ib, num_tasks);
+            if (info != 0)
+                plasma_request_fail(sequence, request, iinfo+info);
+            plasma_trace_tiles("w", (const void*[]){A});
+            plasma_stats_stop(PlasmaStatsTrtri, PlasmaComplexDouble, start,
+                              1.0*n*n*n/3.0, 2.0*n*n);
+        }
+    }
+}
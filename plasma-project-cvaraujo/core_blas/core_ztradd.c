@@ -196,6 +196,7 @@ void plasma_core_omp_ztradd(
                      depend(inout:B[0:ldb*n])
     {
         if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             int retval = plasma_core_ztradd(uplo, transa,
                                      m, n,
                                      alpha, A, lda,
@@ -204,6 +205,9 @@ void plasma_core_omp_ztradd(
                 plasma_error("core_ztradd() failed");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
+            plasma_trace_tiles("rw", (const void*[]){A, B});
+            plasma_stats_stop(PlasmaStatsAux, PlasmaComplexDouble, start,
+                              0.0, 3.0*m*n);
         }
     }
 }
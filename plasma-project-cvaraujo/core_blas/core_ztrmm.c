@@ -121,13 +121,19 @@ void plasma_core_omp_ztrmm(
     int k = (side == PlasmaLeft) ? m : n;
 
     #pragma omp task depend(in:A[0:lda*k]) \
-                     depend(inout:B[0:ldb*n])
+                     depend(inout:B[0:ldb*n]) \
+                     affinity(B[0:ldb*n])
     {
-        if (sequence->status == PlasmaSuccess)
+        if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             plasma_core_ztrmm(side, uplo,
                        transa, diag,
                        m, n,
                        alpha, A, lda,
                               B, ldb);
+            plasma_trace_tiles("rw", (const void*[]){A, B});
+            plasma_stats_stop(PlasmaStatsTrmm, PlasmaComplexDouble, start,
+                              1.0*m*n*k, 1.0*k*k+2.0*m*n);
+        }
     }
 }
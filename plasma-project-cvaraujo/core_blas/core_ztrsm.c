@@ -12,6 +12,10 @@
 
 #include <plasma_core_blas.h>
 #include "plasma_types.h"
+#include "plasma_graph.h"
+#include "plasma_hier.h"
+#include "plasma_internal.h"
+#include "plasma_tile_cache.h"
 #include "core_lapack.h"
 
 /***************************************************************************//**
@@ -99,6 +103,39 @@ void plasma_core_ztrsm(plasma_enum_t side, plasma_enum_t uplo,
                                     B, ldb);
 }
 
+/******************************************************************************/
+typedef struct {
+    plasma_enum_t side;
+    plasma_enum_t uplo;
+    plasma_enum_t transa;
+    plasma_enum_t diag;
+    int m;
+    int n;
+    plasma_complex64_t alpha;
+    int lda;
+    int ldb;
+} plasma_core_ztrsm_args_t;
+
+/******************************************************************************/
+static void plasma_core_ztrsm_graph(const void *args_, void **tiles,
+                                    plasma_sequence_t *sequence,
+                                    plasma_request_t *request)
+{
+    const plasma_core_ztrsm_args_t *args =
+        (const plasma_core_ztrsm_args_t*)args_;
+    int ak = args->side == PlasmaLeft ? args->m : args->n;
+    plasma_time_t start = plasma_stats_start();
+    plasma_core_ztrsm(args->side, args->uplo,
+                      args->transa, args->diag,
+                      args->m, args->n,
+                      args->alpha, tiles[0], args->lda,
+                                   tiles[1], args->ldb);
+    plasma_trace_tiles("rw", (const void*[]){tiles[0], tiles[1]});
+    plasma_stats_stop(PlasmaStatsTrsm, PlasmaComplexDouble, start,
+                      1.0*args->m*args->n*ak,
+                      1.0*ak*ak+2.0*args->m*args->n);
+}
+
 /******************************************************************************/
 void plasma_core_omp_ztrsm(
     plasma_enum_t side, plasma_enum_t uplo,
@@ -108,20 +145,49 @@ void plasma_core_omp_ztrsm(
                                     plasma_complex64_t *B, int ldb,
     plasma_sequence_t *sequence, plasma_request_t *request)
 {
+    if (plasma_graph_capturing()) {
+        plasma_core_ztrsm_args_t args = {
+            side, uplo, transa, diag, m, n, alpha, lda, ldb
+        };
+        const void *tiles[] = {A, B};
+        const int write[] = {0, 1};
+        plasma_graph_record(plasma_core_ztrsm_graph, &args, sizeof(args),
+                            2, tiles, write);
+        return;
+    }
+
+    if (plasma_hier_offload(m, n)) {
+        plasma_core_omp_zhier_trsm(side, uplo, transa, diag, m, n,
+                                   alpha, A, lda,
+                                          B, ldb,
+                                   sequence, request);
+        return;
+    }
+
     int ak;
     if (side == PlasmaLeft)
         ak = m;
     else
         ak = n;
 
+    plasma_tile_cache_host(A, sizeof(plasma_complex64_t)*lda*ak, 0);
+    plasma_tile_cache_host(B, sizeof(plasma_complex64_t)*ldb*n, 1);
+
     #pragma omp task depend(in:A[0:lda*ak]) \
-                     depend(inout:B[0:ldb*n])
+                     depend(inout:B[0:ldb*n]) \
+                     affinity(B[0:ldb*n]) \
+                     priority(plasma_task_priority())
     {
-        if (sequence->status == PlasmaSuccess)
+        if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             plasma_core_ztrsm(side, uplo,
                        transa, diag,
                        m, n,
                        alpha, A, lda,
                               B, ldb);
+            plasma_trace_tiles("rw", (const void*[]){A, B});
+            plasma_stats_stop(PlasmaStatsTrsm, PlasmaComplexDouble, start,
+                              1.0*m*n*ak, 1.0*ak*ak+2.0*m*n);
+        }
     }
 }
@@ -75,10 +75,14 @@ void plasma_core_omp_ztrtri(plasma_enum_t uplo, plasma_enum_t diag,
     #pragma omp task depend(inout:A[0:lda*n])
     {
         if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             int info = plasma_core_ztrtri(uplo, diag,
                                    n, A, lda);
             if (info != 0)
                 plasma_request_fail(sequence, request, iinfo+info);
+            plasma_trace_tiles("w", (const void*[]){A});
+            plasma_stats_stop(PlasmaStatsTrtri, PlasmaComplexDouble, start,
+                              1.0*n*n*n/3.0, 2.0*n*n);
         }
     }
 }
@@ -235,6 +235,7 @@ void plasma_core_omp_ztslqt(int m, int n, int ib,
                                            // as ibxm
     {
         if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             // Prepare workspaces.
             int tid = omp_get_thread_num();
             plasma_complex64_t *tau = ((plasma_complex64_t*)work.spaces[tid]);
@@ -251,6 +252,9 @@ void plasma_core_omp_ztslqt(int m, int n, int ib,
                 plasma_error("core_ztslqt() failed");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
+            plasma_trace_tiles("www", (const void*[]){A1, A2, T});
+            plasma_stats_stop(PlasmaStatsTsqrt, PlasmaComplexDouble, start,
+                              2.0*m*m*n, 2.0*m*m+2.0*m*n);
         }
     }
 }
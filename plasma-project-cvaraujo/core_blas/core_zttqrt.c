@@ -248,6 +248,7 @@ void plasma_core_omp_zttqrt(int m, int n, int ib,
                      depend(out:T[0:ib*n])
     {
         if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             // Prepare workspaces.
             int tid = omp_get_thread_num();
             plasma_complex64_t *tau = ((plasma_complex64_t*)work.spaces[tid]);
@@ -264,6 +265,9 @@ void plasma_core_omp_zttqrt(int m, int n, int ib,
                 plasma_error("core_zttqrt() failed");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
+            plasma_trace_tiles("www", (const void*[]){A1, A2, T});
+            plasma_stats_stop(PlasmaStatsTsqrt, PlasmaComplexDouble, start,
+                              2.0*n*n*n/3.0, 4.0*n*n);
         }
     }
 }
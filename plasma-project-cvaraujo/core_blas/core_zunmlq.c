@@ -255,6 +255,7 @@ void plasma_core_omp_zunmlq(plasma_enum_t side, plasma_enum_t trans,
                      depend(inout:C[0:ldc*n])
     {
         if (sequence->status == PlasmaSuccess) {
+            plasma_time_t start = plasma_stats_start();
             // Prepare workspaces.
             int tid = omp_get_thread_num();
             plasma_complex64_t *W = (plasma_complex64_t*)work.spaces[tid];
@@ -272,6 +273,9 @@ void plasma_core_omp_zunmlq(plasma_enum_t side, plasma_enum_t trans,
                 plasma_error("core_zunmlq() failed");
                 plasma_request_fail(sequence, request, PlasmaErrorInternal);
             }
+            plasma_trace_tiles("rrw", (const void*[]){A, T, C});
+            plasma_stats_stop(PlasmaStatsUnmqr, PlasmaComplexDouble, start,
+                              4.0*m*n*k, 2.0*m*n+1.0*ak*k);
         }
     }
 }
@@ -13,6 +13,8 @@
 #include "plasma_async.h"
 #include "plasma_descriptor.h"
 #include "plasma_context.h"
+#include "plasma_stats.h"
+#include "plasma_trace.h"
 #include "plasma_tuning.h"
 #include "plasma_workspace.h"
 
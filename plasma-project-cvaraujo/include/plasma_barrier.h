@@ -14,10 +14,17 @@
 extern "C" {
 #endif
 
+/******************************************************************************/
+// Rounds of pause instructions spun before sleeping; each round doubles
+// the number of pauses, up to PLASMA_BARRIER_MAX_PAUSE.
+#define PLASMA_BARRIER_SPIN_ROUNDS   32
+#define PLASMA_BARRIER_MAX_PAUSE     64
+
 /******************************************************************************/
 typedef struct {
-    int count;
-    volatile int passed;
+    volatile int count;    ///< number of threads arrived
+    volatile int sense;    ///< flipped by the last thread to arrive
+    volatile int sleepers; ///< number of threads sleeping on sense
 } plasma_barrier_t;
 
 /******************************************************************************/
@@ -0,0 +1,105 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef PLASMA_BATCH_H
+#define PLASMA_BATCH_H
+
+#include "plasma_context.h"
+#include "plasma_depend.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+// Largest number of tile operations in a batch.
+#define PLASMA_BATCH_MAX 32
+
+// Work of a task of batched tile operations, in flops, amortizing
+// the creation of the task and the resolution of its dependencies.
+#define PLASMA_BATCH_FLOPS 4e6
+
+/***************************************************************************//**
+ *  Batch of independent tile operations of the same kernel, submitted as
+ *  a single task by the plasma_core_omp_?*_batch kernels. Operation i reads
+ *  the m[i]-by-k[i] tile A[i] and the tile B[i], and writes the m[i]-by-n[i]
+ *  tile C[i]; the tiles C[i] are distinct.
+ **/
+typedef struct {
+    int count;                          ///< number of operations
+    int m[PLASMA_BATCH_MAX];            ///< rows of the tiles C
+    int n[PLASMA_BATCH_MAX];            ///< columns of the tiles C
+    int k[PLASMA_BATCH_MAX];            ///< inner dimensions
+    const void *A[PLASMA_BATCH_MAX];    ///< first operands
+    int lda[PLASMA_BATCH_MAX];          ///< leading dimensions of A
+    const void *B[PLASMA_BATCH_MAX];    ///< second operands
+    int ldb[PLASMA_BATCH_MAX];          ///< leading dimensions of B
+    void *C[PLASMA_BATCH_MAX];          ///< tiles written
+    int ldc[PLASMA_BATCH_MAX];          ///< leading dimensions of C
+} plasma_batch_t;
+
+/******************************************************************************/
+static inline void plasma_batch_init(plasma_batch_t *batch)
+{
+    batch->count = 0;
+}
+
+/******************************************************************************/
+static inline void plasma_batch_add(plasma_batch_t *batch,
+                                    int m, int n, int k,
+                                    const void *A, int lda,
+                                    const void *B, int ldb,
+                                          void *C, int ldc)
+{
+    int i = batch->count++;
+    batch->m[i] = m;
+    batch->n[i] = n;
+    batch->k[i] = k;
+    batch->A[i] = A;
+    batch->lda[i] = lda;
+    batch->B[i] = B;
+    batch->ldb[i] = ldb;
+    batch->C[i] = C;
+    batch->ldc[i] = ldc;
+}
+
+/***************************************************************************//**
+ *
+ *  Returns the number of operations on nb-by-nb tiles to batch in a task,
+ *  out of count independent operations: enough for PLASMA_BATCH_FLOPS,
+ *  but leaving at least two tasks per thread. Set by PLASMA_BATCH if
+ *  nonzero in the context. Batches need depend iterators.
+ *
+ */
+static inline int plasma_batch_size(plasma_context_t *plasma,
+                                    int nb, int count)
+{
+#ifndef PLASMA_DEPEND_ITERATOR
+    return 1;
+#else
+    if (plasma->batch > 0)
+        return plasma->batch < PLASMA_BATCH_MAX ? plasma->batch
+                                                : PLASMA_BATCH_MAX;
+
+    // Clamped by hand: this header is included by the testers,
+    // which define their own imin() and imax().
+    int size = (int)(PLASMA_BATCH_FLOPS/(2.0*nb*nb*nb));
+    if (size > count/(2*plasma->max_threads))
+        size = count/(2*plasma->max_threads);
+    if (size > PLASMA_BATCH_MAX)
+        size = PLASMA_BATCH_MAX;
+    return size > 1 ? size : 1;
+#endif
+}
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // PLASMA_BATCH_H
@@ -7,7 +7,7 @@
  *  Univ. of Manchester, Univ. of California Berkeley and
  *  Univ. of Colorado Denver.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/include/plasma_z.h, normal z -> c, Fri Sep 28 17:38:00 2018
+ * @generated from include/plasma_z.h, normal z -> c, Sat Oct 17 03:35:11 2026
  *
  **/
 #ifndef PLASMA_C_H
@@ -203,6 +203,16 @@ int plasma_cpotrf(plasma_enum_t uplo,
                   int n,
                   plasma_complex32_t *pA, int lda);
 
+int plasma_cpotrf_update(plasma_enum_t uplo,
+                         int n, int k,
+                         plasma_complex32_t *pA, int lda,
+                         plasma_complex32_t *pV, int ldv);
+
+int plasma_cpotrf_downdate(plasma_enum_t uplo,
+                           int n, int k,
+                           plasma_complex32_t *pA, int lda,
+                           plasma_complex32_t *pV, int ldv);
+
 int plasma_cpotri(plasma_enum_t uplo,
                   int n,
                   plasma_complex32_t *pA, int lda);
@@ -293,6 +303,10 @@ void plasma_omp_cdesc2ge(plasma_desc_t A,
                          plasma_sequence_t *sequence,
                          plasma_request_t *request);
 
+void plasma_omp_cdesc2ge_inplace(plasma_desc_t A,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request);
+
 void plasma_omp_cdesc2pb(plasma_desc_t A,
                          plasma_complex32_t *pA, int lda,
                          plasma_sequence_t *sequence,
@@ -308,6 +322,10 @@ void plasma_omp_cge2desc(plasma_complex32_t *pA, int lda,
                          plasma_sequence_t *sequence,
                          plasma_request_t *request);
 
+void plasma_omp_cge2desc_inplace(plasma_desc_t A,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request);
+
 void plasma_omp_cgeadd(plasma_enum_t transa,
                        plasma_complex32_t alpha, plasma_desc_t A,
                        plasma_complex32_t beta,  plasma_desc_t B,
@@ -470,6 +488,16 @@ void plasma_omp_cposv(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B,
 void plasma_omp_cpotrf(plasma_enum_t uplo, plasma_desc_t A,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_cpotrf_update(plasma_enum_t uplo,
+                              plasma_desc_t A, plasma_desc_t V,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
+void plasma_omp_cpotrf_downdate(plasma_enum_t uplo,
+                                plasma_desc_t A, plasma_desc_t V,
+                                plasma_sequence_t *sequence,
+                                plasma_request_t *request);
+
 void plasma_omp_cpotri(plasma_enum_t uplo, plasma_desc_t A,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
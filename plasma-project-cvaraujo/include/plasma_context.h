@@ -12,6 +12,8 @@
 
 #include "plasma_types.h"
 #include "plasma_barrier.h"
+#include "plasma_graph.h"
+#include "plasma_pool.h"
 
 #include <pthread.h>
 
@@ -29,10 +31,23 @@ typedef struct {
     int max_panel_threads;          ///< max threads for panel factorization
     plasma_barrier_t barrier;       ///< thread barrier for multithreaded tasks
     plasma_enum_t householder_mode; ///< PlasmaHouseholderMode
+    int fused_driver;               ///< PlasmaEnabled or PlasmaDisabled
+    plasma_enum_t distribution;     ///< PlasmaDistribution
+    int device_p;                   ///< rows of the grid of devices, or 0
+    int device_q;                   ///< columns of the grid of devices
+    plasma_enum_t getrf_panel;      ///< PlasmaGetrfPanel
+    int lookahead;                  ///< PlasmaLookahead
+    int batch;                      ///< tile operations per task, 0 if automatic
+    int nested_tasks;               ///< PlasmaNestedTasks, 0 if automatic
+    int graph_cache;                ///< PlasmaEnabled or PlasmaDisabled
+    plasma_graph_t *graphs;         ///< task graphs recorded for replay
+    plasma_pool_t pool;             ///< memory pool for tiles and workspaces
     void *L;                        ///< Lua state pointer; unusued when Lua is missing
+    void *tuning_table;             ///< table from PLASMA_TUNING_FILENAME, or NULL
 } plasma_context_t;
 
 typedef struct {
+    int used;                  ///< nonzero if the slot is taken
     pthread_t thread_id;       ///< thread id
     plasma_context_t *context; ///< pointer to associated context
 } plasma_context_map_t;
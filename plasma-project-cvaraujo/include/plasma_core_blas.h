@@ -107,6 +107,11 @@ static inline void plasma_coreblas_error_func_line_file(
             line, func, file, msg);
 }
 
+/******************************************************************************/
+void plasma_task_priority_set(int priority);
+int plasma_task_priority();
+int plasma_task_priority_nested();
+
 #ifdef __cplusplus
 }  // extern "C"
 #endif
@@ -118,4 +123,7 @@ static inline void plasma_coreblas_error_func_line_file(
 #include "plasma_core_blas_z.h"
 #include "plasma_core_blas_zc.h"
 
+#include "plasma_stats.h"
+#include "plasma_trace.h"
+
 #endif // PLASMA_CORE_BLAS_H
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/include/plasma_core_blas_z.h, normal z -> c, Fri Sep 28 17:38:01 2018
+ * @generated from include/plasma_core_blas_z.h, normal z -> c, Sat Oct 17 04:31:32 2026
  *
  **/
 #ifndef PLASMA_CORE_BLAS_C_H
@@ -14,6 +14,7 @@
 
 #include "plasma_async.h"
 #include "plasma_barrier.h"
+#include "plasma_batch.h"
 #include "plasma_descriptor.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
@@ -61,6 +62,24 @@ void plasma_core_cgetrf(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
                  volatile int *max_idx, volatile plasma_complex32_t *max_val,
                  volatile int *info, plasma_barrier_t *barrier);
 
+void plasma_core_cgetrf_recursive(plasma_desc_t A, int *ipiv, int ib,
+                 int rank, int size,
+                 volatile int *max_idx, volatile plasma_complex32_t *max_val,
+                 volatile int *info, plasma_barrier_t *barrier);
+
+int plasma_core_cgetrf_tntpiv(int m, int n,
+                 plasma_complex32_t *A, int lda, int *idx);
+
+int plasma_core_cgetrf_tntpiv_diag(int mp, int m, int n, int ib, int k,
+                 const int *idx,
+                 plasma_complex32_t *W, int ldw, int *ipiv,
+                 plasma_complex32_t *A, int lda, int *info);
+
+void plasma_core_cgetrf_tntpiv_apply(int m, int n, int m0, int k,
+                 const int *idx,
+                 const plasma_complex32_t *W, int ldw,
+                 plasma_complex32_t *A, int lda);
+
 int plasma_core_chegst(int itype, plasma_enum_t uplo,
                 int n,
                 plasma_complex32_t *A, int lda,
@@ -88,11 +107,54 @@ void plasma_core_chessq(plasma_enum_t uplo,
                  const plasma_complex32_t *A, int lda,
                  float *scale, float *sumsq);
 
+void plasma_core_chier_gemm(plasma_enum_t transa, plasma_enum_t transb,
+                            plasma_complex32_t alpha, plasma_desc_t A,
+                                                      plasma_desc_t B,
+                            plasma_complex32_t beta,  plasma_desc_t C);
+
+int plasma_core_chier_potrf(plasma_enum_t uplo, plasma_desc_t A);
+
+void plasma_core_chier_syrk(plasma_enum_t uplo, plasma_enum_t trans,
+                            plasma_complex32_t alpha, plasma_desc_t A,
+                            plasma_complex32_t beta,  plasma_desc_t C);
+
+void plasma_core_chier_trsm(plasma_enum_t side, plasma_enum_t uplo,
+                            plasma_enum_t transa, plasma_enum_t diag,
+                            plasma_complex32_t alpha, plasma_desc_t A,
+                                                      plasma_desc_t B);
+
+void plasma_core_cnested_geqrt(int m, int n, int ib,
+                               plasma_complex32_t *A, int lda,
+                               plasma_complex32_t *T, int ldt,
+                               plasma_complex32_t *tau,
+                               plasma_complex32_t *work,
+                               int num_tasks);
+
+int plasma_core_cnested_potrf(plasma_enum_t uplo,
+                              int n,
+                              plasma_complex32_t *A, int lda,
+                              int ib, int num_tasks);
+
+void plasma_core_cnested_trsm(plasma_enum_t side, plasma_enum_t uplo,
+                              plasma_enum_t transa, plasma_enum_t diag,
+                              int m, int n,
+                              plasma_complex32_t alpha,
+                              const plasma_complex32_t *A, int lda,
+                                    plasma_complex32_t *B, int ldb,
+                              int num_tasks);
+
+int plasma_core_cnested_trtri(plasma_enum_t uplo, plasma_enum_t diag,
+                              int n,
+                              plasma_complex32_t *A, int lda,
+                              int ib, int num_tasks);
+
 void plasma_core_csyssq(plasma_enum_t uplo,
                  int n,
                  const plasma_complex32_t *A, int lda,
                  float *scale, float *sumsq);
 
+int plasma_core_cgetmi(int m, int n, int mb, plasma_complex32_t *A);
+
 void plasma_core_clacpy(plasma_enum_t uplo, plasma_enum_t transa,
                  int m, int n,
                  const plasma_complex32_t *A, int lda,
@@ -180,6 +242,17 @@ int plasma_core_cpotrf(plasma_enum_t uplo,
                 int n,
                 plasma_complex32_t *A, int lda);
 
+int plasma_core_cpotrf_update(plasma_enum_t uplo, float sigma,
+                              int n, int k,
+                              plasma_complex32_t *A, int lda,
+                              plasma_complex32_t *V, int ldv);
+
+void plasma_core_cpotrf_update_apply(plasma_enum_t uplo, float sigma,
+                                     int m, int n, int k,
+                                           plasma_complex32_t *A, int lda,
+                                     const plasma_complex32_t *Vj, int ldvj,
+                                           plasma_complex32_t *Vi, int ldvi);
+
 void plasma_core_csymm(plasma_enum_t side, plasma_enum_t uplo,
                 int m, int n,
                 plasma_complex32_t alpha, const plasma_complex32_t *A, int lda,
@@ -324,6 +397,12 @@ void plasma_core_omp_cgemm(
     plasma_complex32_t beta,        plasma_complex32_t *C, int ldc,
     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_core_omp_cgemm_batch(
+    plasma_enum_t transa, plasma_enum_t transb,
+    plasma_complex32_t alpha, const plasma_batch_t *batch,
+    plasma_complex32_t beta,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_core_omp_cgeqrt(int m, int n, int ib,
                      plasma_complex32_t *A, int lda,
                      plasma_complex32_t *T, int ldt,
@@ -375,6 +454,69 @@ void plasma_core_omp_chessq(plasma_enum_t uplo,
                      float *scale, float *sumsq,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_core_omp_chier_gemm(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k,
+    plasma_complex32_t alpha, const plasma_complex32_t *A, int lda,
+                              const plasma_complex32_t *B, int ldb,
+    plasma_complex32_t beta,        plasma_complex32_t *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_core_omp_chier_potrf(plasma_enum_t uplo,
+                                 int n,
+                                 plasma_complex32_t *A, int lda,
+                                 int iinfo,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request);
+
+void plasma_core_omp_chier_syrk(
+    plasma_enum_t uplo, plasma_enum_t trans,
+    int n, int k,
+    plasma_complex32_t alpha, const plasma_complex32_t *A, int lda,
+    plasma_complex32_t beta,        plasma_complex32_t *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_core_omp_chier_trsm(
+    plasma_enum_t side, plasma_enum_t uplo,
+    plasma_enum_t transa, plasma_enum_t diag,
+    int m, int n,
+    plasma_complex32_t alpha, const plasma_complex32_t *A, int lda,
+                                    plasma_complex32_t *B, int ldb,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_core_omp_cnested_geqrt(int m, int n, int ib,
+                                   plasma_complex32_t *A, int lda,
+                                   plasma_complex32_t *T, int ldt,
+                                   plasma_workspace_t work,
+                                   int num_tasks,
+                                   plasma_sequence_t *sequence,
+                                   plasma_request_t *request);
+
+void plasma_core_omp_cnested_potrf(plasma_enum_t uplo,
+                                   int n,
+                                   plasma_complex32_t *A, int lda,
+                                   int ib, int num_tasks,
+                                   int iinfo,
+                                   plasma_sequence_t *sequence,
+                                   plasma_request_t *request);
+
+void plasma_core_omp_cnested_trsm(
+    plasma_enum_t side, plasma_enum_t uplo,
+    plasma_enum_t transa, plasma_enum_t diag,
+    int m, int n,
+    plasma_complex32_t alpha, const plasma_complex32_t *A, int lda,
+                                    plasma_complex32_t *B, int ldb,
+    int num_tasks,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_core_omp_cnested_trtri(plasma_enum_t uplo, plasma_enum_t diag,
+                                   int n,
+                                   plasma_complex32_t *A, int lda,
+                                   int ib, int num_tasks,
+                                   int iinfo,
+                                   plasma_sequence_t *sequence,
+                                   plasma_request_t *request);
+
 void plasma_core_omp_csyssq(plasma_enum_t uplo,
                      int n,
                      const plasma_complex32_t *A, int lda,
@@ -387,6 +529,12 @@ void plasma_core_omp_csyssq_aux(int m, int n,
                          plasma_sequence_t *sequence,
                          plasma_request_t *request);
 
+void plasma_core_omp_cgetmi(int m, int n, int mb, plasma_complex32_t *A,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
+void plasma_core_omp_cgetmi_always(int m, int n, int mb, plasma_complex32_t *A);
+
 void plasma_core_omp_clacpy(plasma_enum_t uplo, plasma_enum_t transa,
                      int m, int n,
                      const plasma_complex32_t *A, int lda,
@@ -482,6 +630,22 @@ void plasma_core_omp_cpotrf(plasma_enum_t uplo,
                      int iinfo,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_core_omp_cpotrf_update(plasma_enum_t uplo, float sigma,
+                                   int n, int k,
+                                   plasma_complex32_t *A, int lda,
+                                   plasma_complex32_t *V, int ldv,
+                                   int iinfo,
+                                   plasma_sequence_t *sequence,
+                                   plasma_request_t *request);
+
+void plasma_core_omp_cpotrf_update_apply(
+    plasma_enum_t uplo, float sigma,
+    int m, int n, int k,
+          plasma_complex32_t *A, int lda,
+    const plasma_complex32_t *Vj, int ldvj,
+          plasma_complex32_t *Vi, int ldvi,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_core_omp_csymm(
     plasma_enum_t side, plasma_enum_t uplo,
     int m, int n,
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/include/plasma_core_blas_z.h, normal z -> d, Fri Sep 28 17:38:01 2018
+ * @generated from include/plasma_core_blas_z.h, normal z -> d, Sat Oct 17 04:31:32 2026
  *
  **/
 #ifndef PLASMA_CORE_BLAS_D_H
@@ -14,6 +14,7 @@
 
 #include "plasma_async.h"
 #include "plasma_barrier.h"
+#include "plasma_batch.h"
 #include "plasma_descriptor.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
@@ -61,6 +62,24 @@ void plasma_core_dgetrf(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
                  volatile int *max_idx, volatile double *max_val,
                  volatile int *info, plasma_barrier_t *barrier);
 
+void plasma_core_dgetrf_recursive(plasma_desc_t A, int *ipiv, int ib,
+                 int rank, int size,
+                 volatile int *max_idx, volatile double *max_val,
+                 volatile int *info, plasma_barrier_t *barrier);
+
+int plasma_core_dgetrf_tntpiv(int m, int n,
+                 double *A, int lda, int *idx);
+
+int plasma_core_dgetrf_tntpiv_diag(int mp, int m, int n, int ib, int k,
+                 const int *idx,
+                 double *W, int ldw, int *ipiv,
+                 double *A, int lda, int *info);
+
+void plasma_core_dgetrf_tntpiv_apply(int m, int n, int m0, int k,
+                 const int *idx,
+                 const double *W, int ldw,
+                 double *A, int lda);
+
 int plasma_core_dsygst(int itype, plasma_enum_t uplo,
                 int n,
                 double *A, int lda,
@@ -88,11 +107,54 @@ void plasma_core_dsyssq(plasma_enum_t uplo,
                  const double *A, int lda,
                  double *scale, double *sumsq);
 
+void plasma_core_dhier_gemm(plasma_enum_t transa, plasma_enum_t transb,
+                            double alpha, plasma_desc_t A,
+                                                      plasma_desc_t B,
+                            double beta,  plasma_desc_t C);
+
+int plasma_core_dhier_potrf(plasma_enum_t uplo, plasma_desc_t A);
+
+void plasma_core_dhier_syrk(plasma_enum_t uplo, plasma_enum_t trans,
+                            double alpha, plasma_desc_t A,
+                            double beta,  plasma_desc_t C);
+
+void plasma_core_dhier_trsm(plasma_enum_t side, plasma_enum_t uplo,
+                            plasma_enum_t transa, plasma_enum_t diag,
+                            double alpha, plasma_desc_t A,
+                                                      plasma_desc_t B);
+
+void plasma_core_dnested_geqrt(int m, int n, int ib,
+                               double *A, int lda,
+                               double *T, int ldt,
+                               double *tau,
+                               double *work,
+                               int num_tasks);
+
+int plasma_core_dnested_potrf(plasma_enum_t uplo,
+                              int n,
+                              double *A, int lda,
+                              int ib, int num_tasks);
+
+void plasma_core_dnested_trsm(plasma_enum_t side, plasma_enum_t uplo,
+                              plasma_enum_t transa, plasma_enum_t diag,
+                              int m, int n,
+                              double alpha,
+                              const double *A, int lda,
+                                    double *B, int ldb,
+                              int num_tasks);
+
+int plasma_core_dnested_trtri(plasma_enum_t uplo, plasma_enum_t diag,
+                              int n,
+                              double *A, int lda,
+                              int ib, int num_tasks);
+
 void plasma_core_dsyssq(plasma_enum_t uplo,
                  int n,
                  const double *A, int lda,
                  double *scale, double *sumsq);
 
+int plasma_core_dgetmi(int m, int n, int mb, double *A);
+
 void plasma_core_dlacpy(plasma_enum_t uplo, plasma_enum_t transa,
                  int m, int n,
                  const double *A, int lda,
@@ -180,6 +242,17 @@ int plasma_core_dpotrf(plasma_enum_t uplo,
                 int n,
                 double *A, int lda);
 
+int plasma_core_dpotrf_update(plasma_enum_t uplo, double sigma,
+                              int n, int k,
+                              double *A, int lda,
+                              double *V, int ldv);
+
+void plasma_core_dpotrf_update_apply(plasma_enum_t uplo, double sigma,
+                                     int m, int n, int k,
+                                           double *A, int lda,
+                                     const double *Vj, int ldvj,
+                                           double *Vi, int ldvi);
+
 void plasma_core_dsymm(plasma_enum_t side, plasma_enum_t uplo,
                 int m, int n,
                 double alpha, const double *A, int lda,
@@ -324,6 +397,12 @@ void plasma_core_omp_dgemm(
     double beta,        double *C, int ldc,
     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_core_omp_dgemm_batch(
+    plasma_enum_t transa, plasma_enum_t transb,
+    double alpha, const plasma_batch_t *batch,
+    double beta,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_core_omp_dgeqrt(int m, int n, int ib,
                      double *A, int lda,
                      double *T, int ldt,
@@ -375,6 +454,69 @@ void plasma_core_omp_dsyssq(plasma_enum_t uplo,
                      double *scale, double *sumsq,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_core_omp_dhier_gemm(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k,
+    double alpha, const double *A, int lda,
+                              const double *B, int ldb,
+    double beta,        double *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_core_omp_dhier_potrf(plasma_enum_t uplo,
+                                 int n,
+                                 double *A, int lda,
+                                 int iinfo,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request);
+
+void plasma_core_omp_dhier_syrk(
+    plasma_enum_t uplo, plasma_enum_t trans,
+    int n, int k,
+    double alpha, const double *A, int lda,
+    double beta,        double *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_core_omp_dhier_trsm(
+    plasma_enum_t side, plasma_enum_t uplo,
+    plasma_enum_t transa, plasma_enum_t diag,
+    int m, int n,
+    double alpha, const double *A, int lda,
+                                    double *B, int ldb,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_core_omp_dnested_geqrt(int m, int n, int ib,
+                                   double *A, int lda,
+                                   double *T, int ldt,
+                                   plasma_workspace_t work,
+                                   int num_tasks,
+                                   plasma_sequence_t *sequence,
+                                   plasma_request_t *request);
+
+void plasma_core_omp_dnested_potrf(plasma_enum_t uplo,
+                                   int n,
+                                   double *A, int lda,
+                                   int ib, int num_tasks,
+                                   int iinfo,
+                                   plasma_sequence_t *sequence,
+                                   plasma_request_t *request);
+
+void plasma_core_omp_dnested_trsm(
+    plasma_enum_t side, plasma_enum_t uplo,
+    plasma_enum_t transa, plasma_enum_t diag,
+    int m, int n,
+    double alpha, const double *A, int lda,
+                                    double *B, int ldb,
+    int num_tasks,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_core_omp_dnested_trtri(plasma_enum_t uplo, plasma_enum_t diag,
+                                   int n,
+                                   double *A, int lda,
+                                   int ib, int num_tasks,
+                                   int iinfo,
+                                   plasma_sequence_t *sequence,
+                                   plasma_request_t *request);
+
 void plasma_core_omp_dsyssq(plasma_enum_t uplo,
                      int n,
                      const double *A, int lda,
@@ -387,6 +529,12 @@ void plasma_core_omp_dsyssq_aux(int m, int n,
                          plasma_sequence_t *sequence,
                          plasma_request_t *request);
 
+void plasma_core_omp_dgetmi(int m, int n, int mb, double *A,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
+void plasma_core_omp_dgetmi_always(int m, int n, int mb, double *A);
+
 void plasma_core_omp_dlacpy(plasma_enum_t uplo, plasma_enum_t transa,
                      int m, int n,
                      const double *A, int lda,
@@ -482,6 +630,22 @@ void plasma_core_omp_dpotrf(plasma_enum_t uplo,
                      int iinfo,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_core_omp_dpotrf_update(plasma_enum_t uplo, double sigma,
+                                   int n, int k,
+                                   double *A, int lda,
+                                   double *V, int ldv,
+                                   int iinfo,
+                                   plasma_sequence_t *sequence,
+                                   plasma_request_t *request);
+
+void plasma_core_omp_dpotrf_update_apply(
+    plasma_enum_t uplo, double sigma,
+    int m, int n, int k,
+          double *A, int lda,
+    const double *Vj, int ldvj,
+          double *Vi, int ldvi,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_core_omp_dsymm(
     plasma_enum_t side, plasma_enum_t uplo,
     int m, int n,
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/include/plasma_core_blas_z.h, normal z -> s, Fri Sep 28 17:38:01 2018
+ * @generated from include/plasma_core_blas_z.h, normal z -> s, Sat Oct 17 04:31:32 2026
  *
  **/
 #ifndef PLASMA_CORE_BLAS_S_H
@@ -14,6 +14,7 @@
 
 #include "plasma_async.h"
 #include "plasma_barrier.h"
+#include "plasma_batch.h"
 #include "plasma_descriptor.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
@@ -61,6 +62,24 @@ void plasma_core_sgetrf(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
                  volatile int *max_idx, volatile float *max_val,
                  volatile int *info, plasma_barrier_t *barrier);
 
+void plasma_core_sgetrf_recursive(plasma_desc_t A, int *ipiv, int ib,
+                 int rank, int size,
+                 volatile int *max_idx, volatile float *max_val,
+                 volatile int *info, plasma_barrier_t *barrier);
+
+int plasma_core_sgetrf_tntpiv(int m, int n,
+                 float *A, int lda, int *idx);
+
+int plasma_core_sgetrf_tntpiv_diag(int mp, int m, int n, int ib, int k,
+                 const int *idx,
+                 float *W, int ldw, int *ipiv,
+                 float *A, int lda, int *info);
+
+void plasma_core_sgetrf_tntpiv_apply(int m, int n, int m0, int k,
+                 const int *idx,
+                 const float *W, int ldw,
+                 float *A, int lda);
+
 int plasma_core_ssygst(int itype, plasma_enum_t uplo,
                 int n,
                 float *A, int lda,
@@ -88,11 +107,54 @@ void plasma_core_ssyssq(plasma_enum_t uplo,
                  const float *A, int lda,
                  float *scale, float *sumsq);
 
+void plasma_core_shier_gemm(plasma_enum_t transa, plasma_enum_t transb,
+                            float alpha, plasma_desc_t A,
+                                                      plasma_desc_t B,
+                            float beta,  plasma_desc_t C);
+
+int plasma_core_shier_potrf(plasma_enum_t uplo, plasma_desc_t A);
+
+void plasma_core_shier_syrk(plasma_enum_t uplo, plasma_enum_t trans,
+                            float alpha, plasma_desc_t A,
+                            float beta,  plasma_desc_t C);
+
+void plasma_core_shier_trsm(plasma_enum_t side, plasma_enum_t uplo,
+                            plasma_enum_t transa, plasma_enum_t diag,
+                            float alpha, plasma_desc_t A,
+                                                      plasma_desc_t B);
+
+void plasma_core_snested_geqrt(int m, int n, int ib,
+                               float *A, int lda,
+                               float *T, int ldt,
+                               float *tau,
+                               float *work,
+                               int num_tasks);
+
+int plasma_core_snested_potrf(plasma_enum_t uplo,
+                              int n,
+                              float *A, int lda,
+                              int ib, int num_tasks);
+
+void plasma_core_snested_trsm(plasma_enum_t side, plasma_enum_t uplo,
+                              plasma_enum_t transa, plasma_enum_t diag,
+                              int m, int n,
+                              float alpha,
+                              const float *A, int lda,
+                                    float *B, int ldb,
+                              int num_tasks);
+
+int plasma_core_snested_trtri(plasma_enum_t uplo, plasma_enum_t diag,
+                              int n,
+                              float *A, int lda,
+                              int ib, int num_tasks);
+
 void plasma_core_ssyssq(plasma_enum_t uplo,
                  int n,
                  const float *A, int lda,
                  float *scale, float *sumsq);
 
+int plasma_core_sgetmi(int m, int n, int mb, float *A);
+
 void plasma_core_slacpy(plasma_enum_t uplo, plasma_enum_t transa,
                  int m, int n,
                  const float *A, int lda,
@@ -180,6 +242,17 @@ int plasma_core_spotrf(plasma_enum_t uplo,
                 int n,
                 float *A, int lda);
 
+int plasma_core_spotrf_update(plasma_enum_t uplo, float sigma,
+                              int n, int k,
+                              float *A, int lda,
+                              float *V, int ldv);
+
+void plasma_core_spotrf_update_apply(plasma_enum_t uplo, float sigma,
+                                     int m, int n, int k,
+                                           float *A, int lda,
+                                     const float *Vj, int ldvj,
+                                           float *Vi, int ldvi);
+
 void plasma_core_ssymm(plasma_enum_t side, plasma_enum_t uplo,
                 int m, int n,
                 float alpha, const float *A, int lda,
@@ -324,6 +397,12 @@ void plasma_core_omp_sgemm(
     float beta,        float *C, int ldc,
     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_core_omp_sgemm_batch(
+    plasma_enum_t transa, plasma_enum_t transb,
+    float alpha, const plasma_batch_t *batch,
+    float beta,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_core_omp_sgeqrt(int m, int n, int ib,
                      float *A, int lda,
                      float *T, int ldt,
@@ -375,6 +454,69 @@ void plasma_core_omp_ssyssq(plasma_enum_t uplo,
                      float *scale, float *sumsq,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_core_omp_shier_gemm(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k,
+    float alpha, const float *A, int lda,
+                              const float *B, int ldb,
+    float beta,        float *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_core_omp_shier_potrf(plasma_enum_t uplo,
+                                 int n,
+                                 float *A, int lda,
+                                 int iinfo,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request);
+
+void plasma_core_omp_shier_syrk(
+    plasma_enum_t uplo, plasma_enum_t trans,
+    int n, int k,
+    float alpha, const float *A, int lda,
+    float beta,        float *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_core_omp_shier_trsm(
+    plasma_enum_t side, plasma_enum_t uplo,
+    plasma_enum_t transa, plasma_enum_t diag,
+    int m, int n,
+    float alpha, const float *A, int lda,
+                                    float *B, int ldb,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_core_omp_snested_geqrt(int m, int n, int ib,
+                                   float *A, int lda,
+                                   float *T, int ldt,
+                                   plasma_workspace_t work,
+                                   int num_tasks,
+                                   plasma_sequence_t *sequence,
+                                   plasma_request_t *request);
+
+void plasma_core_omp_snested_potrf(plasma_enum_t uplo,
+                                   int n,
+                                   float *A, int lda,
+                                   int ib, int num_tasks,
+                                   int iinfo,
+                                   plasma_sequence_t *sequence,
+                                   plasma_request_t *request);
+
+void plasma_core_omp_snested_trsm(
+    plasma_enum_t side, plasma_enum_t uplo,
+    plasma_enum_t transa, plasma_enum_t diag,
+    int m, int n,
+    float alpha, const float *A, int lda,
+                                    float *B, int ldb,
+    int num_tasks,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_core_omp_snested_trtri(plasma_enum_t uplo, plasma_enum_t diag,
+                                   int n,
+                                   float *A, int lda,
+                                   int ib, int num_tasks,
+                                   int iinfo,
+                                   plasma_sequence_t *sequence,
+                                   plasma_request_t *request);
+
 void plasma_core_omp_ssyssq(plasma_enum_t uplo,
                      int n,
                      const float *A, int lda,
@@ -387,6 +529,12 @@ void plasma_core_omp_ssyssq_aux(int m, int n,
                          plasma_sequence_t *sequence,
                          plasma_request_t *request);
 
+void plasma_core_omp_sgetmi(int m, int n, int mb, float *A,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
+void plasma_core_omp_sgetmi_always(int m, int n, int mb, float *A);
+
 void plasma_core_omp_slacpy(plasma_enum_t uplo, plasma_enum_t transa,
                      int m, int n,
                      const float *A, int lda,
@@ -482,6 +630,22 @@ void plasma_core_omp_spotrf(plasma_enum_t uplo,
                      int iinfo,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_core_omp_spotrf_update(plasma_enum_t uplo, float sigma,
+                                   int n, int k,
+                                   float *A, int lda,
+                                   float *V, int ldv,
+                                   int iinfo,
+                                   plasma_sequence_t *sequence,
+                                   plasma_request_t *request);
+
+void plasma_core_omp_spotrf_update_apply(
+    plasma_enum_t uplo, float sigma,
+    int m, int n, int k,
+          float *A, int lda,
+    const float *Vj, int ldvj,
+          float *Vi, int ldvi,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_core_omp_ssymm(
     plasma_enum_t side, plasma_enum_t uplo,
     int m, int n,
@@ -14,6 +14,7 @@
 
 #include "plasma_async.h"
 #include "plasma_barrier.h"
+#include "plasma_batch.h"
 #include "plasma_descriptor.h"
 #include "plasma_types.h"
 #include "plasma_workspace.h"
@@ -61,6 +62,24 @@ void plasma_core_zgetrf(plasma_desc_t A, int *ipiv, int ib, int rank, int size,
                  volatile int *max_idx, volatile plasma_complex64_t *max_val,
                  volatile int *info, plasma_barrier_t *barrier);
 
+void plasma_core_zgetrf_recursive(plasma_desc_t A, int *ipiv, int ib,
+                 int rank, int size,
+                 volatile int *max_idx, volatile plasma_complex64_t *max_val,
+                 volatile int *info, plasma_barrier_t *barrier);
+
+int plasma_core_zgetrf_tntpiv(int m, int n,
+                 plasma_complex64_t *A, int lda, int *idx);
+
+int plasma_core_zgetrf_tntpiv_diag(int mp, int m, int n, int ib, int k,
+                 const int *idx,
+                 plasma_complex64_t *W, int ldw, int *ipiv,
+                 plasma_complex64_t *A, int lda, int *info);
+
+void plasma_core_zgetrf_tntpiv_apply(int m, int n, int m0, int k,
+                 const int *idx,
+                 const plasma_complex64_t *W, int ldw,
+                 plasma_complex64_t *A, int lda);
+
 int plasma_core_zhegst(int itype, plasma_enum_t uplo,
                 int n,
                 plasma_complex64_t *A, int lda,
@@ -88,11 +107,54 @@ void plasma_core_zhessq(plasma_enum_t uplo,
                  const plasma_complex64_t *A, int lda,
                  double *scale, double *sumsq);
 
+void plasma_core_zhier_gemm(plasma_enum_t transa, plasma_enum_t transb,
+                            plasma_complex64_t alpha, plasma_desc_t A,
+                                                      plasma_desc_t B,
+                            plasma_complex64_t beta,  plasma_desc_t C);
+
+int plasma_core_zhier_potrf(plasma_enum_t uplo, plasma_desc_t A);
+
+void plasma_core_zhier_syrk(plasma_enum_t uplo, plasma_enum_t trans,
+                            plasma_complex64_t alpha, plasma_desc_t A,
+                            plasma_complex64_t beta,  plasma_desc_t C);
+
+void plasma_core_zhier_trsm(plasma_enum_t side, plasma_enum_t uplo,
+                            plasma_enum_t transa, plasma_enum_t diag,
+                            plasma_complex64_t alpha, plasma_desc_t A,
+                                                      plasma_desc_t B);
+
+void plasma_core_znested_geqrt(int m, int n, int ib,
+                               plasma_complex64_t *A, int lda,
+                               plasma_complex64_t *T, int ldt,
+                               plasma_complex64_t *tau,
+                               plasma_complex64_t *work,
+                               int num_tasks);
+
+int plasma_core_znested_potrf(plasma_enum_t uplo,
+                              int n,
+                              plasma_complex64_t *A, int lda,
+                              int ib, int num_tasks);
+
+void plasma_core_znested_trsm(plasma_enum_t side, plasma_enum_t uplo,
+                              plasma_enum_t transa, plasma_enum_t diag,
+                              int m, int n,
+                              plasma_complex64_t alpha,
+                              const plasma_complex64_t *A, int lda,
+                                    plasma_complex64_t *B, int ldb,
+                              int num_tasks);
+
+int plasma_core_znested_trtri(plasma_enum_t uplo, plasma_enum_t diag,
+                              int n,
+                              plasma_complex64_t *A, int lda,
+                              int ib, int num_tasks);
+
 void plasma_core_zsyssq(plasma_enum_t uplo,
                  int n,
                  const plasma_complex64_t *A, int lda,
                  double *scale, double *sumsq);
 
+int plasma_core_zgetmi(int m, int n, int mb, plasma_complex64_t *A);
+
 void plasma_core_zlacpy(plasma_enum_t uplo, plasma_enum_t transa,
                  int m, int n,
                  const plasma_complex64_t *A, int lda,
@@ -180,6 +242,17 @@ int plasma_core_zpotrf(plasma_enum_t uplo,
                 int n,
                 plasma_complex64_t *A, int lda);
 
+int plasma_core_zpotrf_update(plasma_enum_t uplo, double sigma,
+                              int n, int k,
+                              plasma_complex64_t *A, int lda,
+                              plasma_complex64_t *V, int ldv);
+
+void plasma_core_zpotrf_update_apply(plasma_enum_t uplo, double sigma,
+                                     int m, int n, int k,
+                                           plasma_complex64_t *A, int lda,
+                                     const plasma_complex64_t *Vj, int ldvj,
+                                           plasma_complex64_t *Vi, int ldvi);
+
 void plasma_core_zsymm(plasma_enum_t side, plasma_enum_t uplo,
                 int m, int n,
                 plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
@@ -324,6 +397,12 @@ void plasma_core_omp_zgemm(
     plasma_complex64_t beta,        plasma_complex64_t *C, int ldc,
     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_core_omp_zgemm_batch(
+    plasma_enum_t transa, plasma_enum_t transb,
+    plasma_complex64_t alpha, const plasma_batch_t *batch,
+    plasma_complex64_t beta,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_core_omp_zgeqrt(int m, int n, int ib,
                      plasma_complex64_t *A, int lda,
                      plasma_complex64_t *T, int ldt,
@@ -375,6 +454,69 @@ void plasma_core_omp_zhessq(plasma_enum_t uplo,
                      double *scale, double *sumsq,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_core_omp_zhier_gemm(
+    plasma_enum_t transa, plasma_enum_t transb,
+    int m, int n, int k,
+    plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
+                              const plasma_complex64_t *B, int ldb,
+    plasma_complex64_t beta,        plasma_complex64_t *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_core_omp_zhier_potrf(plasma_enum_t uplo,
+                                 int n,
+                                 plasma_complex64_t *A, int lda,
+                                 int iinfo,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request);
+
+void plasma_core_omp_zhier_syrk(
+    plasma_enum_t uplo, plasma_enum_t trans,
+    int n, int k,
+    plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
+    plasma_complex64_t beta,        plasma_complex64_t *C, int ldc,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_core_omp_zhier_trsm(
+    plasma_enum_t side, plasma_enum_t uplo,
+    plasma_enum_t transa, plasma_enum_t diag,
+    int m, int n,
+    plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
+                                    plasma_complex64_t *B, int ldb,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_core_omp_znested_geqrt(int m, int n, int ib,
+                                   plasma_complex64_t *A, int lda,
+                                   plasma_complex64_t *T, int ldt,
+                                   plasma_workspace_t work,
+                                   int num_tasks,
+                                   plasma_sequence_t *sequence,
+                                   plasma_request_t *request);
+
+void plasma_core_omp_znested_potrf(plasma_enum_t uplo,
+                                   int n,
+                                   plasma_complex64_t *A, int lda,
+                                   int ib, int num_tasks,
+                                   int iinfo,
+                                   plasma_sequence_t *sequence,
+                                   plasma_request_t *request);
+
+void plasma_core_omp_znested_trsm(
+    plasma_enum_t side, plasma_enum_t uplo,
+    plasma_enum_t transa, plasma_enum_t diag,
+    int m, int n,
+    plasma_complex64_t alpha, const plasma_complex64_t *A, int lda,
+                                    plasma_complex64_t *B, int ldb,
+    int num_tasks,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
+void plasma_core_omp_znested_trtri(plasma_enum_t uplo, plasma_enum_t diag,
+                                   int n,
+                                   plasma_complex64_t *A, int lda,
+                                   int ib, int num_tasks,
+                                   int iinfo,
+                                   plasma_sequence_t *sequence,
+                                   plasma_request_t *request);
+
 void plasma_core_omp_zsyssq(plasma_enum_t uplo,
                      int n,
                      const plasma_complex64_t *A, int lda,
@@ -387,6 +529,12 @@ void plasma_core_omp_zsyssq_aux(int m, int n,
                          plasma_sequence_t *sequence,
                          plasma_request_t *request);
 
+void plasma_core_omp_zgetmi(int m, int n, int mb, plasma_complex64_t *A,
+                            plasma_sequence_t *sequence,
+                            plasma_request_t *request);
+
+void plasma_core_omp_zgetmi_always(int m, int n, int mb, plasma_complex64_t *A);
+
 void plasma_core_omp_zlacpy(plasma_enum_t uplo, plasma_enum_t transa,
                      int m, int n,
                      const plasma_complex64_t *A, int lda,
@@ -482,6 +630,22 @@ void plasma_core_omp_zpotrf(plasma_enum_t uplo,
                      int iinfo,
                      plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_core_omp_zpotrf_update(plasma_enum_t uplo, double sigma,
+                                   int n, int k,
+                                   plasma_complex64_t *A, int lda,
+                                   plasma_complex64_t *V, int ldv,
+                                   int iinfo,
+                                   plasma_sequence_t *sequence,
+                                   plasma_request_t *request);
+
+void plasma_core_omp_zpotrf_update_apply(
+    plasma_enum_t uplo, double sigma,
+    int m, int n, int k,
+          plasma_complex64_t *A, int lda,
+    const plasma_complex64_t *Vj, int ldvj,
+          plasma_complex64_t *Vi, int ldvi,
+    plasma_sequence_t *sequence, plasma_request_t *request);
+
 void plasma_core_omp_zsymm(
     plasma_enum_t side, plasma_enum_t uplo,
     int m, int n,
@@ -0,0 +1,42 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef PLASMA_CORE_SIMD_H
+#define PLASMA_CORE_SIMD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ *  In-tree SIMD micro-kernels of the double precision tile kernels.
+ *
+ *  When PLASMA is built with -DPLASMA_WITH_SIMD (CMake option PLASMA_SIMD,
+ *  or simd = 1 in make.inc), core_blas/core_dsimd.c overrides the weak
+ *  plasma_core_dgemm(), plasma_core_dsyrk() and plasma_core_dtrsm() with
+ *  register-blocked AVX2 and AVX-512 kernels working directly on the
+ *  column-major tiles. The instruction set is detected with CPUID on first
+ *  use, and the kernels fall back to CBLAS when neither is available.
+ *  The environment variable PLASMA_SIMD (none, avx2 or avx512) caps it.
+ **/
+enum {
+    PlasmaSimdNone   = 0, ///< vendor CBLAS
+    PlasmaSimdAvx2   = 1, ///< AVX2 and FMA, 8-by-6 micro-tiles
+    PlasmaSimdAvx512 = 2  ///< AVX-512F, 16-by-8 micro-tiles
+};
+
+/******************************************************************************/
+int plasma_core_simd_isa();
+void plasma_core_simd_set_isa(int isa);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // PLASMA_CORE_SIMD_H
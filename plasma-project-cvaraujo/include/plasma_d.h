@@ -7,7 +7,7 @@
  *  Univ. of Manchester, Univ. of California Berkeley and
  *  Univ. of Colorado Denver.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/include/plasma_z.h, normal z -> d, Fri Sep 28 17:38:00 2018
+ * @generated from include/plasma_z.h, normal z -> d, Sat Oct 17 03:35:11 2026
  *
  **/
 #ifndef PLASMA_D_H
@@ -203,6 +203,16 @@ int plasma_dpotrf(plasma_enum_t uplo,
                   int n,
                   double *pA, int lda);
 
+int plasma_dpotrf_update(plasma_enum_t uplo,
+                         int n, int k,
+                         double *pA, int lda,
+                         double *pV, int ldv);
+
+int plasma_dpotrf_downdate(plasma_enum_t uplo,
+                           int n, int k,
+                           double *pA, int lda,
+                           double *pV, int ldv);
+
 int plasma_dpotri(plasma_enum_t uplo,
                   int n,
                   double *pA, int lda);
@@ -293,6 +303,10 @@ void plasma_omp_ddesc2ge(plasma_desc_t A,
                          plasma_sequence_t *sequence,
                          plasma_request_t *request);
 
+void plasma_omp_ddesc2ge_inplace(plasma_desc_t A,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request);
+
 void plasma_omp_ddesc2pb(plasma_desc_t A,
                          double *pA, int lda,
                          plasma_sequence_t *sequence,
@@ -308,6 +322,10 @@ void plasma_omp_dge2desc(double *pA, int lda,
                          plasma_sequence_t *sequence,
                          plasma_request_t *request);
 
+void plasma_omp_dge2desc_inplace(plasma_desc_t A,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request);
+
 void plasma_omp_dgeadd(plasma_enum_t transa,
                        double alpha, plasma_desc_t A,
                        double beta,  plasma_desc_t B,
@@ -470,6 +488,16 @@ void plasma_omp_dposv(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B,
 void plasma_omp_dpotrf(plasma_enum_t uplo, plasma_desc_t A,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_dpotrf_update(plasma_enum_t uplo,
+                              plasma_desc_t A, plasma_desc_t V,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
+void plasma_omp_dpotrf_downdate(plasma_enum_t uplo,
+                                plasma_desc_t A, plasma_desc_t V,
+                                plasma_sequence_t *sequence,
+                                plasma_request_t *request);
+
 void plasma_omp_dpotri(plasma_enum_t uplo, plasma_desc_t A,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
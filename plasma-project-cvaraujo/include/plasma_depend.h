@@ -0,0 +1,68 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef PLASMA_DEPEND_H
+#define PLASMA_DEPEND_H
+
+#include "plasma_descriptor.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ *  Dependencies of a task on ranges of tiles or chunks.
+ *
+ *  Tasks depend on the first element of a tile, so a task accessing a whole
+ *  panel would have to be joined to the tasks accessing its individual
+ *  tiles. With OpenMP 5.0 depend iterators, PLASMA_DEPEND_TILES() adds to a
+ *  task pragma a dependency of type (in, out or inout) on each tile (m, n)
+ *  of A with m in [m_start, m_end) and n in [n_start, n_end), and
+ *  PLASMA_DEPEND_CHUNKS() one on each element x[i*stride], i in [start, end).
+ *  Without iterators, both expand to nothing and the dependencies are
+ *  gathered onto, or scattered from, a single element by the empty tasks
+ *  of plasma_omp_desc_gather(), plasma_omp_desc_scatter() and
+ *  plasma_omp_chunks_gather().
+ **/
+#if (defined(_OPENMP) && _OPENMP >= 201811) || \
+    (defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 9)
+#define PLASMA_DEPEND_ITERATOR
+
+#define PLASMA_DEPEND_TILES(type, A, m_start, m_end, n_start, n_end) \
+    depend(iterator(int plasma_n_ = n_start:n_end, \
+                    int plasma_m_ = m_start:m_end), \
+           type:((char*)plasma_tile_addr(A, plasma_m_, plasma_n_))[0])
+
+#define PLASMA_DEPEND_CHUNKS(type, x, start, end, stride) \
+    depend(iterator(int plasma_i_ = start:end), \
+           type:(x)[(size_t)plasma_i_*(stride)])
+#else
+#define PLASMA_DEPEND_TILES(type, A, m_start, m_end, n_start, n_end)
+#define PLASMA_DEPEND_CHUNKS(type, x, start, end, stride)
+#endif
+
+/******************************************************************************/
+void plasma_omp_desc_gather(plasma_desc_t A,
+                            int m_start, int m_end, int n_start, int n_end,
+                            const void *whole);
+void plasma_omp_desc_scatter(plasma_desc_t A,
+                             int m_start, int m_end, int n_start, int n_end,
+                             const void *whole);
+void plasma_omp_chunks_gather(const void *x, int count, size_t stride);
+
+/******************************************************************************/
+void plasma_omp_desc_fence_column(plasma_desc_t A, int n);
+void plasma_omp_desc_fence_columns(plasma_desc_t A);
+void plasma_omp_desc_fence(plasma_desc_t A);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // PLASMA_DEPEND_H
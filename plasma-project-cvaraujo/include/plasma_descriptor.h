@@ -48,6 +48,20 @@ typedef struct {
     size_t A21;   ///< pointer to the beginning of A21
     size_t A12;   ///< pointer to the beginning of A12
     size_t A22;   ///< pointer to the beginning of A22
+    int ld;       ///< leading dimension of a strided matrix
+
+    // tile table, built by plasma_desc_*_create()
+    void **tiles; ///< addresses of the tiles of the submatrix, or NULL
+    int *tile_ld; ///< leading dimensions of the tile rows, or NULL
+
+    // distribution of the tiles across NUMA domains
+    plasma_enum_t distribution; ///< PlasmaDistribution
+    int dist_p;                 ///< number of rows in the grid of domains
+    int dist_q;                 ///< number of columns in the grid of domains
+
+    // distribution of the tiles across devices, see plasma_tile_device()
+    int dev_p; ///< number of rows in the grid of devices, 0 if not distributed
+    int dev_q; ///< number of columns in the grid of devices
 
     // tile parameters
     int mb; ///< number of rows in a tile
@@ -150,6 +164,22 @@ static inline void *plasma_tile_addr_triangle(plasma_desc_t A, int m, int n)
     return (void*)((char*)A.matrix + (offset*eltsize));
 }
 
+/***************************************************************************//**
+ *
+ *  Returns the address of a tile of a strided matrix, i.e., of a sub-block
+ *  of a column-major array with the leading dimension A.ld.
+ *
+ */
+static inline void *plasma_tile_addr_strided(plasma_desc_t A, int m, int n)
+{
+    size_t mm = m + A.i/A.mb;
+    size_t nn = n + A.j/A.nb;
+    size_t eltsize = plasma_element_size(A.precision);
+    size_t offset = A.mb*mm + (size_t)A.ld*A.nb*nn;
+
+    return (void*)((char*)A.matrix + (offset*eltsize));
+}
+
 /******************************************************************************/
 static inline void *plasma_tile_addr_general_band(plasma_desc_t A, int m, int n)
 {
@@ -159,6 +189,12 @@ static inline void *plasma_tile_addr_general_band(plasma_desc_t A, int m, int n)
 /******************************************************************************/
 static inline void *plasma_tile_addr(plasma_desc_t A, int m, int n)
 {
+    if (A.tiles != NULL) {
+        if (A.type == PlasmaGeneralBand)
+            return A.tiles[(A.kut-1)+m-n + (size_t)A.gmt*n];
+        else
+            return A.tiles[m + (size_t)A.gmt*n];
+    }
     if (A.type == PlasmaGeneral) {
         return plasma_tile_addr_general(A, m, n);
     }
@@ -168,6 +204,9 @@ static inline void *plasma_tile_addr(plasma_desc_t A, int m, int n)
     else if (A.type == PlasmaUpper || A.type == PlasmaLower) {
         return plasma_tile_addr_triangle(A, m, n);
     }
+    else if (A.type == PlasmaGeneralStrided) {
+        return plasma_tile_addr_strided(A, m, n);
+    }
     else {
         plasma_fatal_error("invalid matrix type");
         return NULL;
@@ -177,6 +216,8 @@ static inline void *plasma_tile_addr(plasma_desc_t A, int m, int n)
 /***************************************************************************//**
  *
  *  Returns the height of the tile with vertical position k.
+ *  This is the leading dimension of the tile, which for a strided matrix
+ *  is the leading dimension of the whole array.
  *
  */
 static inline int plasma_tile_mmain(plasma_desc_t A, int k)
@@ -184,6 +225,12 @@ static inline int plasma_tile_mmain(plasma_desc_t A, int k)
     if (A.type == PlasmaGeneralBand) {
         return A.mb;
     }
+    else if (A.type == PlasmaGeneralStrided) {
+        return A.ld;
+    }
+    else if (A.tile_ld != NULL) {
+        return A.tile_ld[k];
+    }
     else {
         if (A.i/A.mb+k < A.gm/A.mb)
             return A.mb;
@@ -239,6 +286,39 @@ static inline int plasma_tile_nview(plasma_desc_t A, int k)
             return (A.j+A.n)%A.nb;
 }
 
+/***************************************************************************//**
+ *
+ *  Returns the home NUMA domain of the tile at position (m, n),
+ *  or -1 if the tiles of A are not distributed.
+ *
+ */
+static inline int plasma_tile_home(plasma_desc_t A, int m, int n)
+{
+    if (A.distribution != PlasmaDistributionBlockCyclic)
+        return -1;
+
+    int mm = m + A.i/A.mb;
+    int nn = n + A.j/A.nb;
+    return (mm%A.dist_p)*A.dist_q + nn%A.dist_q;
+}
+
+/***************************************************************************//**
+ *
+ *  Returns the device owning the tile at position (m, n), on which the
+ *  offloaded tasks writing the tile run, or -1 if the tiles of A are not
+ *  distributed across devices.
+ *
+ */
+static inline int plasma_tile_device(plasma_desc_t A, int m, int n)
+{
+    if (A.dev_p == 0)
+        return -1;
+
+    int mm = m + A.i/A.mb;
+    int nn = n + A.j/A.nb;
+    return (mm%A.dev_p)*A.dev_q + nn%A.dev_q;
+}
+
 /******************************************************************************/
 static inline int plasma_tile_mmain_band(plasma_desc_t A, int m, int n)
 {
@@ -274,6 +354,14 @@ int plasma_desc_triangular_init(plasma_enum_t precision, plasma_enum_t uplo, voi
                                 int mb, int nb, int lm, int ln, int i, int j,
                                 int m, int n, plasma_desc_t *A);
 
+int plasma_desc_general_strided_init(plasma_enum_t precision, void *pA, int lda,
+                                     int mb, int nb, int m, int n,
+                                     plasma_desc_t *A);
+
+int plasma_desc_general_inplace_init(plasma_enum_t precision, void *pA, int lda,
+                                     int mb, int nb, int m, int n,
+                                     plasma_desc_t *A);
+
 int plasma_desc_check(plasma_desc_t A);
 int plasma_desc_general_check(plasma_desc_t A);
 int plasma_desc_general_band_check(plasma_desc_t A);
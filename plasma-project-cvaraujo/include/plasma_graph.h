@@ -0,0 +1,62 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef PLASMA_GRAPH_H
+#define PLASMA_GRAPH_H
+
+#include "plasma_async.h"
+#include "plasma_descriptor.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ *  Recorded task graph.
+ *
+ *  While a graph is captured, the plasma_core_omp_* kernels record
+ *  their arguments and the tiles they access instead of submitting tasks.
+ *  The tiles are recorded by their indices in the captured descriptors,
+ *  so that the graph is replayed on any matrices of the same shape.
+ *  The dependencies are resolved once, at the end of the capture,
+ *  into the lists of successors of each task.
+ **/
+typedef struct plasma_graph_s plasma_graph_t;
+
+// Executes a recorded task on its tiles.
+typedef void (*plasma_graph_kernel_t)(const void *args, void **tiles,
+                                      plasma_sequence_t *sequence,
+                                      plasma_request_t *request);
+
+/******************************************************************************/
+int plasma_graph_capturing();
+void plasma_graph_record(plasma_graph_kernel_t kernel,
+                         const void *args, size_t size,
+                         int num_tiles, const void *const *tiles,
+                         const int *write);
+
+void plasma_graph_capture_begin(const plasma_desc_t *desc, int num_desc);
+plasma_graph_t *plasma_graph_capture_end(plasma_graph_t **cache,
+                                         const char *name,
+                                         const void *key, size_t size);
+
+plasma_graph_t *plasma_graph_find(plasma_graph_t *cache, const char *name,
+                                  const void *key, size_t size);
+void plasma_graph_replay(plasma_graph_t *graph, const plasma_desc_t *desc,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request);
+void plasma_graph_cache_clear(plasma_graph_t **cache);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // PLASMA_GRAPH_H
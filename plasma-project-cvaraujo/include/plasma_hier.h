@@ -0,0 +1,100 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef PLASMA_HIER_H
+#define PLASMA_HIER_H
+
+#include "plasma_descriptor.h"
+#include "plasma_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+// Size of the inner tiles of an offloaded outer tile.
+#define PLASMA_HIER_NB 128
+
+/***************************************************************************//**
+ *
+ *  Two-level tiling for OmpCluster: the outer tiles of the PLASMA
+ *  descriptors are distributed between the workers by offloading their tasks,
+ *  and each worker splits its outer tile into inner tiles scheduled with
+ *  node-local tasks by the plasma_core_?hier_* kernels.
+ *
+ *  Returns a strided descriptor viewing the m-by-n outer tile A, with the
+ *  leading dimension lda, as nb-by-nb inner tiles addressed in place.
+ *  Unlike plasma_desc_general_strided_init(), it needs neither the PLASMA
+ *  context nor the library, so it works inside target regions.
+ *
+ */
+static inline plasma_desc_t plasma_hier_view(plasma_enum_t precision,
+                                             void *A, int lda,
+                                             int m, int n, int nb)
+{
+    plasma_desc_t T;
+    T.type = PlasmaGeneralStrided;
+    T.uplo = PlasmaGeneral;
+    T.precision = precision;
+
+    T.matrix = A;
+    T.A21 = 0;
+    T.A12 = 0;
+    T.A22 = 0;
+    T.ld = lda;
+    T.tiles = NULL;
+    T.tile_ld = NULL;
+    T.distribution = PlasmaDistributionNone;
+    T.dist_p = 1;
+    T.dist_q = 1;
+    T.dev_p = 0;
+    T.dev_q = 0;
+
+    T.mb = nb;
+    T.nb = nb;
+    T.gm = m;
+    T.gn = n;
+    T.gmt = (m+nb-1)/nb;
+    T.gnt = (n+nb-1)/nb;
+
+    T.i = 0;
+    T.j = 0;
+    T.m = m;
+    T.n = n;
+    T.mt = T.gmt;
+    T.nt = T.gnt;
+
+    T.kl = m-1;
+    T.ku = n-1;
+    T.klt = T.mt;
+    T.kut = T.nt;
+    return T;
+}
+
+/***************************************************************************//**
+ *
+ *  Returns nonzero if the task on an m-by-n outer tile is offloaded to an
+ *  OmpCluster worker and split into inner tiles, i.e., in builds with
+ *  offloading, for tiles larger than half an inner tile in both dimensions.
+ *
+ */
+static inline int plasma_hier_offload(int m, int n)
+{
+#if defined(USE_OFFLOAD)
+    return m > PLASMA_HIER_NB/2 && n > PLASMA_HIER_NB/2;
+#else
+    return 0;
+#endif
+}
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // PLASMA_HIER_H
@@ -14,6 +14,11 @@
   #define priority(p)
 #endif
 
+// The affinity clause of OpenMP 5.0 is not recognized before GCC 11.
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ < 11)
+  #define affinity(p)
+#endif
+
 #include <stdio.h>
 #include <stdlib.h>
 
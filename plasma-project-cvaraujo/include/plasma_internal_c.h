@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/include/plasma_internal_z.h, normal z -> c, Fri Sep 28 17:38:00 2018
+ * @generated from include/plasma_internal_z.h, normal z -> c, Sat Oct 17 03:35:11 2026
  *
  **/
 #ifndef PLASMA_INTERNAL_C_H
@@ -34,6 +34,10 @@ void plasma_pcdesc2ge(plasma_desc_t A,
                       plasma_sequence_t *sequence,
                       plasma_request_t *request);
 
+void plasma_pcdesc2ge_inplace(plasma_desc_t A,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
 void plasma_pcdesc2pb(plasma_desc_t A,
                       plasma_complex32_t *pA, int lda,
                       plasma_sequence_t *sequence,
@@ -49,6 +53,10 @@ void plasma_pcge2desc(plasma_complex32_t *pA, int lda,
                       plasma_sequence_t *sequence,
                       plasma_request_t *request);
 
+void plasma_pcge2desc_inplace(plasma_desc_t A,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
 void plasma_pcgeadd(plasma_enum_t transa,
                     plasma_complex32_t alpha,  plasma_desc_t A,
                     plasma_complex32_t beta,   plasma_desc_t B,
@@ -84,6 +92,10 @@ void plasma_pcgetri_aux(plasma_desc_t A, plasma_desc_t W,
 void plasma_pcgetrf(plasma_desc_t A, int *ipiv,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pcgetrf_calu(plasma_desc_t A, int *ipiv,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request);
+
 void plasma_pchemm(plasma_enum_t side, plasma_enum_t uplo,
                    plasma_complex32_t alpha, plasma_desc_t A,
                                              plasma_desc_t B,
@@ -163,6 +175,11 @@ void plasma_pcpbtrf(plasma_enum_t uplo, plasma_desc_t A,
 void plasma_pcpotrf(plasma_enum_t uplo, plasma_desc_t A,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pcpotrf_update(plasma_enum_t uplo, float sigma,
+                           plasma_desc_t A, plasma_desc_t V,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
 void plasma_pcsymm(plasma_enum_t side, plasma_enum_t uplo,
                    plasma_complex32_t alpha, plasma_desc_t A,
                                              plasma_desc_t B,
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/include/plasma_internal_z.h, normal z -> d, Fri Sep 28 17:38:00 2018
+ * @generated from include/plasma_internal_z.h, normal z -> d, Sat Oct 17 03:35:11 2026
  *
  **/
 #ifndef PLASMA_INTERNAL_D_H
@@ -34,6 +34,10 @@ void plasma_pddesc2ge(plasma_desc_t A,
                       plasma_sequence_t *sequence,
                       plasma_request_t *request);
 
+void plasma_pddesc2ge_inplace(plasma_desc_t A,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
 void plasma_pddesc2pb(plasma_desc_t A,
                       double *pA, int lda,
                       plasma_sequence_t *sequence,
@@ -49,6 +53,10 @@ void plasma_pdge2desc(double *pA, int lda,
                       plasma_sequence_t *sequence,
                       plasma_request_t *request);
 
+void plasma_pdge2desc_inplace(plasma_desc_t A,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
 void plasma_pdgeadd(plasma_enum_t transa,
                     double alpha,  plasma_desc_t A,
                     double beta,   plasma_desc_t B,
@@ -84,6 +92,10 @@ void plasma_pdgetri_aux(plasma_desc_t A, plasma_desc_t W,
 void plasma_pdgetrf(plasma_desc_t A, int *ipiv,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pdgetrf_calu(plasma_desc_t A, int *ipiv,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request);
+
 void plasma_pdsymm(plasma_enum_t side, plasma_enum_t uplo,
                    double alpha, plasma_desc_t A,
                                              plasma_desc_t B,
@@ -163,6 +175,11 @@ void plasma_pdpbtrf(plasma_enum_t uplo, plasma_desc_t A,
 void plasma_pdpotrf(plasma_enum_t uplo, plasma_desc_t A,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pdpotrf_update(plasma_enum_t uplo, double sigma,
+                           plasma_desc_t A, plasma_desc_t V,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
 void plasma_pdsymm(plasma_enum_t side, plasma_enum_t uplo,
                    double alpha, plasma_desc_t A,
                                              plasma_desc_t B,
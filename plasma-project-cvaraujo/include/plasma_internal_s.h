@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/include/plasma_internal_z.h, normal z -> s, Fri Sep 28 17:38:00 2018
+ * @generated from include/plasma_internal_z.h, normal z -> s, Sat Oct 17 03:35:11 2026
  *
  **/
 #ifndef PLASMA_INTERNAL_S_H
@@ -34,6 +34,10 @@ void plasma_psdesc2ge(plasma_desc_t A,
                       plasma_sequence_t *sequence,
                       plasma_request_t *request);
 
+void plasma_psdesc2ge_inplace(plasma_desc_t A,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
 void plasma_psdesc2pb(plasma_desc_t A,
                       float *pA, int lda,
                       plasma_sequence_t *sequence,
@@ -49,6 +53,10 @@ void plasma_psge2desc(float *pA, int lda,
                       plasma_sequence_t *sequence,
                       plasma_request_t *request);
 
+void plasma_psge2desc_inplace(plasma_desc_t A,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
 void plasma_psgeadd(plasma_enum_t transa,
                     float alpha,  plasma_desc_t A,
                     float beta,   plasma_desc_t B,
@@ -84,6 +92,10 @@ void plasma_psgetri_aux(plasma_desc_t A, plasma_desc_t W,
 void plasma_psgetrf(plasma_desc_t A, int *ipiv,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_psgetrf_calu(plasma_desc_t A, int *ipiv,
+                         plasma_sequence_t *sequence,
+                         plasma_request_t *request);
+
 void plasma_pssymm(plasma_enum_t side, plasma_enum_t uplo,
                    float alpha, plasma_desc_t A,
                                              plasma_desc_t B,
@@ -163,6 +175,11 @@ void plasma_pspbtrf(plasma_enum_t uplo, plasma_desc_t A,
 void plasma_pspotrf(plasma_enum_t uplo, plasma_desc_t A,
                     plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_pspotrf_update(plasma_enum_t uplo, float sigma,
+                           plasma_desc_t A, plasma_desc_t V,
+                           plasma_sequence_t *sequence,
+                           plasma_request_t *request);
+
 void plasma_pssymm(plasma_enum_t side, plasma_enum_t uplo,
                    float alpha, plasma_desc_t A,
                                              plasma_desc_t B,
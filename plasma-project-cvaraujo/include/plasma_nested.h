@@ -0,0 +1,53 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef PLASMA_NESTED_H
+#define PLASMA_NESTED_H
+
+#include "plasma_context.h"
+#include "plasma_internal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+// Smallest tile size whose critical-path kernels are split automatically.
+#define PLASMA_NESTED_NB 256
+
+/***************************************************************************//**
+ *
+ *  Returns the number of nested tasks to split each of count concurrent
+ *  critical-path kernels on nb-by-nb tiles into, e.g., the diagonal potrf
+ *  or the trsm of a tile column. ready_estimate is the caller's estimate of
+ *  the other tasks able to run alongside them, typically the tasks of the
+ *  previous step still in flight, some of which may not be ready yet.
+ *  By default, the kernels are split among the threads left idle by these
+ *  tasks, for large tiles only. Set by PLASMA_NESTED if nonzero in the
+ *  context.
+ *
+ */
+static inline int plasma_nested_tasks(plasma_context_t *plasma,
+                                      int nb, int ready_estimate, int count)
+{
+    if (plasma->nested_tasks > 0)
+        return plasma->nested_tasks;
+
+    if (nb < PLASMA_NESTED_NB || count < 1)
+        return 1;
+
+    int idle = plasma->max_threads-ready_estimate;
+    return imax(1, idle/count);
+}
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // PLASMA_NESTED_H
@@ -0,0 +1,72 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef PLASMA_POOL_H
+#define PLASMA_POOL_H
+
+#include <stddef.h>
+#include <pthread.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+// Size classes: four per power of two, from 4 KiB up to 2^40 bytes.
+// Smaller requests are rounded up to the smallest class,
+// larger requests bypass the pool.
+#define PLASMA_POOL_MIN_SHIFT     12
+#define PLASMA_POOL_MAX_SHIFT     40
+#define PLASMA_POOL_STEPS          4
+#define PLASMA_POOL_NUM_CLASSES \
+    ((PLASMA_POOL_MAX_SHIFT-PLASMA_POOL_MIN_SHIFT)*PLASMA_POOL_STEPS+1)
+
+// Alignment of pooled memory, also the size of the block header.
+#define PLASMA_POOL_ALIGNMENT     64
+
+// Size of a huge page. Blocks of at least this size are backed by
+// huge pages when enabled, and start on a huge page boundary.
+#define PLASMA_POOL_HUGE_PAGE_SIZE ((size_t)2 << 20)
+
+/******************************************************************************/
+typedef struct {
+    unsigned long hits;     ///< requests served from the pool
+    unsigned long misses;   ///< requests that allocated new memory
+    size_t bytes_in_use;    ///< bytes handed out and not yet released
+    size_t bytes_cached;    ///< bytes held in the pool for reuse
+    size_t peak_bytes;      ///< peak of bytes_in_use + bytes_cached
+} plasma_pool_stats_t;
+
+typedef struct {
+    void *free[PLASMA_POOL_NUM_CLASSES]; ///< free list of each size class
+    plasma_pool_stats_t stats;           ///< usage statistics
+    int huge_pages;                      ///< PlasmaHugePages
+    pthread_mutex_t lock;                ///< protects the free lists
+} plasma_pool_t;
+
+/******************************************************************************/
+void plasma_pool_init(plasma_pool_t *pool);
+void plasma_pool_finalize(plasma_pool_t *pool);
+void plasma_pool_release_all(plasma_pool_t *pool);
+
+void *plasma_pool_malloc(plasma_pool_t *pool, size_t size);
+void *plasma_pool_calloc(plasma_pool_t *pool, size_t size);
+void *plasma_pool_malloc_fresh(plasma_pool_t *pool, size_t size);
+void plasma_pool_free(plasma_pool_t *pool, void *ptr);
+
+int plasma_pool_reserve(size_t size, int count);
+int plasma_pool_release();
+int plasma_pool_stats(plasma_pool_stats_t *stats);
+int plasma_pool_stats_reset();
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // PLASMA_POOL_H
@@ -7,7 +7,7 @@
  *  Univ. of Manchester, Univ. of California Berkeley and
  *  Univ. of Colorado Denver.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/include/plasma_z.h, normal z -> s, Fri Sep 28 17:38:00 2018
+ * @generated from include/plasma_z.h, normal z -> s, Sat Oct 17 03:35:11 2026
  *
  **/
 #ifndef PLASMA_S_H
@@ -203,6 +203,16 @@ int plasma_spotrf(plasma_enum_t uplo,
                   int n,
                   float *pA, int lda);
 
+int plasma_spotrf_update(plasma_enum_t uplo,
+                         int n, int k,
+                         float *pA, int lda,
+                         float *pV, int ldv);
+
+int plasma_spotrf_downdate(plasma_enum_t uplo,
+                           int n, int k,
+                           float *pA, int lda,
+                           float *pV, int ldv);
+
 int plasma_spotri(plasma_enum_t uplo,
                   int n,
                   float *pA, int lda);
@@ -293,6 +303,10 @@ void plasma_omp_sdesc2ge(plasma_desc_t A,
                          plasma_sequence_t *sequence,
                          plasma_request_t *request);
 
+void plasma_omp_sdesc2ge_inplace(plasma_desc_t A,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request);
+
 void plasma_omp_sdesc2pb(plasma_desc_t A,
                          float *pA, int lda,
                          plasma_sequence_t *sequence,
@@ -308,6 +322,10 @@ void plasma_omp_sge2desc(float *pA, int lda,
                          plasma_sequence_t *sequence,
                          plasma_request_t *request);
 
+void plasma_omp_sge2desc_inplace(plasma_desc_t A,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request);
+
 void plasma_omp_sgeadd(plasma_enum_t transa,
                        float alpha, plasma_desc_t A,
                        float beta,  plasma_desc_t B,
@@ -470,6 +488,16 @@ void plasma_omp_sposv(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B,
 void plasma_omp_spotrf(plasma_enum_t uplo, plasma_desc_t A,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_spotrf_update(plasma_enum_t uplo,
+                              plasma_desc_t A, plasma_desc_t V,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
+void plasma_omp_spotrf_downdate(plasma_enum_t uplo,
+                                plasma_desc_t A, plasma_desc_t V,
+                                plasma_sequence_t *sequence,
+                                plasma_request_t *request);
+
 void plasma_omp_spotri(plasma_enum_t uplo, plasma_desc_t A,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
@@ -0,0 +1,63 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef PLASMA_STATS_H
+#define PLASMA_STATS_H
+
+#include "plasma_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+// Kernel types, all precisions together.
+enum {
+    PlasmaStatsGemm,        ///< gemm
+    PlasmaStatsSymm,        ///< symm, hemm
+    PlasmaStatsSyrk,        ///< syrk, herk
+    PlasmaStatsSyr2k,       ///< syr2k, her2k
+    PlasmaStatsTrmm,        ///< trmm
+    PlasmaStatsTrsm,        ///< trsm
+    PlasmaStatsPotrf,       ///< potrf
+    PlasmaStatsPotrfUpdate, ///< potrf_update, potrf_update_apply
+    PlasmaStatsGetrf,       ///< LU panels
+    PlasmaStatsGeqrt,       ///< geqrt, gelqt
+    PlasmaStatsTsqrt,       ///< tsqrt, ttqrt, tslqt, ttlqt
+    PlasmaStatsUnmqr,       ///< unmqr, unmlq
+    PlasmaStatsTsmqr,       ///< tsmqr, ttmqr, tsmlq, ttmlq
+    PlasmaStatsTrtri,       ///< trtri, lauum
+    PlasmaStatsHegst,       ///< hegst
+    PlasmaStatsNorm,        ///< lange, lanhe, lansy, lantr and the ssq kernels
+    PlasmaStatsAux,         ///< copies, conversions, scaling and additions
+    PlasmaStatsNumKernels
+};
+
+/******************************************************************************/
+typedef struct {
+    unsigned long count; ///< number of calls
+    double time;         ///< total execution time in seconds
+    double max_time;     ///< longest call in seconds
+    double flops;        ///< floating-point operations, leading order
+    double bytes;        ///< bytes of the tiles read and written
+} plasma_stats_t;
+
+/******************************************************************************/
+int plasma_stats_get(plasma_enum_t kernel, plasma_stats_t *stats);
+void plasma_stats_reset();
+
+plasma_time_t plasma_stats_start();
+void plasma_stats_stop(plasma_enum_t kernel, plasma_enum_t precision,
+                       plasma_time_t start, double flops, double elements);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // PLASMA_STATS_H
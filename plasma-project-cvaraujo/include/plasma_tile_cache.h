@@ -0,0 +1,73 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef PLASMA_TILE_CACHE_H
+#define PLASMA_TILE_CACHE_H
+
+#include "plasma_descriptor.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************************************************************//**
+ *  Device placement and residency of the tiles.
+ *
+ *  Between plasma_tile_cache_begin() and plasma_tile_cache_end(), the tasks
+ *  offloaded by the plasma_core_omp_?hier_* kernels run on the device owning
+ *  the tile they write, as set by the device grid of its descriptor,
+ *  see plasma_tile_device().
+ *
+ *  If the scope is resident, the tiles also stay mapped on the devices.
+ *  The submitting thread tracks which devices hold a valid copy of each tile,
+ *  and only transfers stale copies, with target data tasks depending on the
+ *  tiles. The kernels running on the host within the scope call
+ *  plasma_tile_cache_host() on their tiles. The end of the outermost
+ *  resident scope copies the tiles written on the devices back to the host,
+ *  and unmaps all the tiles.
+ *
+ *  The scopes and the residency of the tiles belong to the thread calling
+ *  plasma_tile_cache_begin(), and only cover the kernels it submits itself,
+ *  since the transfers are only ordered with its own tasks. The kernels
+ *  submitted from within a task, e.g., on a worker thread, are outside of
+ *  the scopes: they run on the host, and the task submitting them must
+ *  itself be a host task whose tiles were made valid on the host by
+ *  plasma_tile_cache_host(), as the nested kernels do.
+ **/
+
+/******************************************************************************/
+void plasma_tile_cache_begin(const plasma_desc_t *desc, int num_desc,
+                             int resident);
+void plasma_tile_cache_end();
+
+int plasma_tile_cache_device(const void *tile);
+void plasma_tile_cache_acquire(const void *tile, size_t size,
+                               int device, int write);
+
+/***************************************************************************//**
+ *
+ *  Makes the host copy of a tile of size bytes valid before a host task
+ *  reads it, or before a host task writes it if write is nonzero.
+ *
+ */
+static inline void plasma_tile_cache_host(const void *tile, size_t size,
+                                          int write)
+{
+#if defined(USE_OFFLOAD)
+    plasma_tile_cache_acquire(tile, size, -1, write);
+#endif
+}
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // PLASMA_TILE_CACHE_H
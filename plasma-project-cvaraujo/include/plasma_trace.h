@@ -0,0 +1,39 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ **/
+#ifndef PLASMA_TRACE_H
+#define PLASMA_TRACE_H
+
+#include "plasma_descriptor.h"
+#include "plasma_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************/
+// Maximum number of tiles recorded for a task.
+#define PLASMA_TRACE_MAX_TILES 4
+
+/******************************************************************************/
+int plasma_trace_start();
+int plasma_trace_stop(const char *filename);
+
+void plasma_trace_tiles(const char *mode, const void *const *tiles);
+void plasma_trace_record(plasma_enum_t kernel, plasma_enum_t precision,
+                         plasma_time_t start, plasma_time_t stop);
+
+void plasma_trace_desc_create(const plasma_desc_t *A);
+void plasma_trace_desc_destroy(const plasma_desc_t *A);
+
+#ifdef __cplusplus
+}  // extern "C"
+#endif
+
+#endif // PLASMA_TRACE_H
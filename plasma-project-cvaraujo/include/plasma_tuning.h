@@ -16,6 +16,49 @@
 extern "C" {
 #endif
 
+/******************************************************************************/
+// Routines of the tuning table, in the order of their names.
+enum {
+    PlasmaTuneGbtrf,
+    PlasmaTuneGeadd,
+    PlasmaTuneGeinv,
+    PlasmaTuneGelqf,
+    PlasmaTuneGemm,
+    PlasmaTuneGeqrf,
+    PlasmaTuneGeswp,
+    PlasmaTuneGetrf,
+    PlasmaTuneHetrf,
+    PlasmaTuneLacpy,
+    PlasmaTuneLag2c,
+    PlasmaTuneLange,
+    PlasmaTuneLansy,
+    PlasmaTuneLantr,
+    PlasmaTuneLascl,
+    PlasmaTuneLaset,
+    PlasmaTuneLauum,
+    PlasmaTunePbtrf,
+    PlasmaTunePoinv,
+    PlasmaTunePotrf,
+    PlasmaTuneSymm,
+    PlasmaTuneSyr2k,
+    PlasmaTuneSyrk,
+    PlasmaTuneTradd,
+    PlasmaTuneTrmm,
+    PlasmaTuneTrsm,
+    PlasmaTuneTrtri,
+    PlasmaTuneNumRoutines
+};
+
+typedef struct plasma_tuning_table_s plasma_tuning_table_t;
+
+/******************************************************************************/
+plasma_tuning_table_t *plasma_tuning_table_load(const char *filename);
+void plasma_tuning_table_free(plasma_tuning_table_t *table);
+int plasma_tuning_table_lookup(const plasma_tuning_table_t *table,
+                               int routine, plasma_enum_t dtyp,
+                               int num_threads, double size,
+                               int *nb, int *ib, int *max_panel_threads);
+
 /******************************************************************************/
 void plasma_tuning_init(plasma_context_t *plasma);
 void plasma_tuning_finalize(plasma_context_t *plasma);
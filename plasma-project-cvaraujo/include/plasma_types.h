@@ -78,6 +78,7 @@ enum {
     PlasmaLower         = 122,
     PlasmaGeneral       = 123,
     PlasmaGeneralBand   = 124,
+    PlasmaGeneralStrided = 125,
 
     PlasmaNonUnit       = 131,
     PlasmaUnit          = 132,
@@ -127,6 +128,24 @@ enum {
     PlasmaTreeHouseholder
 };
 
+enum {
+    PlasmaDistributionNone,
+    PlasmaDistributionBlockCyclic
+};
+
+// Nonzero, to be returned by the tuning functions.
+enum {
+    PlasmaPanelIterative = 1,
+    PlasmaPanelRecursive = 2,
+    PlasmaPanelTournament = 3
+};
+
+enum {
+    PlasmaHugePagesNone,
+    PlasmaHugePagesTransparent,
+    PlasmaHugePagesExplicit
+};
+
 enum {
     PlasmaDisabled = 0,
     PlasmaEnabled = 1
@@ -138,12 +157,22 @@ enum {
     PlasmaIb,
     PlasmaInplaceOutplace,
     PlasmaNumPanelThreads,
-    PlasmaHouseholderMode
+    PlasmaHouseholderMode,
+    PlasmaFusedDriver,
+    PlasmaDistribution,
+    PlasmaHugePages,
+    PlasmaGetrfPanel,
+    PlasmaLookahead,
+    PlasmaGraphCache,
+    PlasmaNestedTasks
 };
 
 /******************************************************************************/
 typedef int plasma_enum_t;
 
+// hiding double from precision translation when used for taking time
+typedef double plasma_time_t;
+
 typedef float  _Complex plasma_complex32_t;
 typedef double _Complex plasma_complex64_t;
 
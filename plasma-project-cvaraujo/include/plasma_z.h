@@ -203,6 +203,16 @@ int plasma_zpotrf(plasma_enum_t uplo,
                   int n,
                   plasma_complex64_t *pA, int lda);
 
+int plasma_zpotrf_update(plasma_enum_t uplo,
+                         int n, int k,
+                         plasma_complex64_t *pA, int lda,
+                         plasma_complex64_t *pV, int ldv);
+
+int plasma_zpotrf_downdate(plasma_enum_t uplo,
+                           int n, int k,
+                           plasma_complex64_t *pA, int lda,
+                           plasma_complex64_t *pV, int ldv);
+
 int plasma_zpotri(plasma_enum_t uplo,
                   int n,
                   plasma_complex64_t *pA, int lda);
@@ -293,6 +303,10 @@ void plasma_omp_zdesc2ge(plasma_desc_t A,
                          plasma_sequence_t *sequence,
                          plasma_request_t *request);
 
+void plasma_omp_zdesc2ge_inplace(plasma_desc_t A,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request);
+
 void plasma_omp_zdesc2pb(plasma_desc_t A,
                          plasma_complex64_t *pA, int lda,
                          plasma_sequence_t *sequence,
@@ -308,6 +322,10 @@ void plasma_omp_zge2desc(plasma_complex64_t *pA, int lda,
                          plasma_sequence_t *sequence,
                          plasma_request_t *request);
 
+void plasma_omp_zge2desc_inplace(plasma_desc_t A,
+                                 plasma_sequence_t *sequence,
+                                 plasma_request_t *request);
+
 void plasma_omp_zgeadd(plasma_enum_t transa,
                        plasma_complex64_t alpha, plasma_desc_t A,
                        plasma_complex64_t beta,  plasma_desc_t B,
@@ -470,6 +488,16 @@ void plasma_omp_zposv(plasma_enum_t uplo, plasma_desc_t A, plasma_desc_t B,
 void plasma_omp_zpotrf(plasma_enum_t uplo, plasma_desc_t A,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
+void plasma_omp_zpotrf_update(plasma_enum_t uplo,
+                              plasma_desc_t A, plasma_desc_t V,
+                              plasma_sequence_t *sequence,
+                              plasma_request_t *request);
+
+void plasma_omp_zpotrf_downdate(plasma_enum_t uplo,
+                                plasma_desc_t A, plasma_desc_t V,
+                                plasma_sequence_t *sequence,
+                                plasma_request_t *request);
+
 void plasma_omp_zpotri(plasma_enum_t uplo, plasma_desc_t A,
                        plasma_sequence_t *sequence, plasma_request_t *request);
 
@@ -344,6 +344,25 @@ static double  flops_dpotrf(double n)
 static double  flops_spotrf(double n)
     { return    fmuls_potrf(n) +    fadds_potrf(n); }
 
+//------------------------------------------------------------ potrf_update
+static double fmuls_potrf_update(double n, double k)
+    { return 2.*n*n*k; }
+
+static double fadds_potrf_update(double n, double k)
+    { return n*n*k; }
+
+static double  flops_zpotrf_update(double n, double k)
+    { return 6.*fmuls_potrf_update(n, k) + 2.*fadds_potrf_update(n, k); }
+
+static double  flops_cpotrf_update(double n, double k)
+    { return 6.*fmuls_potrf_update(n, k) + 2.*fadds_potrf_update(n, k); }
+
+static double  flops_dpotrf_update(double n, double k)
+    { return    fmuls_potrf_update(n, k) +    fadds_potrf_update(n, k); }
+
+static double  flops_spotrf_update(double n, double k)
+    { return    fmuls_potrf_update(n, k) +    fadds_potrf_update(n, k); }
+
 //------------------------------------------------------------ potri
 static double fmuls_potri(double n)
     { return 1./3.*n*n*n + n*n + 2./3.*n; }
@@ -7,6 +7,9 @@
  *  University of Manchester, UK.
  *
  **/
+// syscall() is not in C99.
+#define _GNU_SOURCE
+
 #include "test.h"
 #include "plasma.h"
 
@@ -15,6 +18,14 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include <unistd.h>
+#include <omp.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#endif
 
 /******************************************************************************/
 typedef void (*test_func_ptr)(param_value_t param[], bool run);
@@ -227,6 +238,14 @@ struct routines_t routines[] =
     { "dpotrf", test_dpotrf },
     { "cpotrf", test_cpotrf },
     { "spotrf", test_spotrf },
+    { "zpotrf_update", test_zpotrf_update },
+    { "dpotrf_update", test_dpotrf_update },
+    { "cpotrf_update", test_cpotrf_update },
+    { "spotrf_update", test_spotrf_update },
+    { "zpotrf_downdate", test_zpotrf_downdate },
+    { "dpotrf_downdate", test_dpotrf_downdate },
+    { "cpotrf_downdate", test_cpotrf_downdate },
+    { "spotrf_downdate", test_spotrf_downdate },
 
     { "zpotri", test_zpotri },
     { "dpotri", test_dpotri },
@@ -324,6 +343,9 @@ static param_desc_t ParamDesc[] = {
     {"itersv",             "IterSv",       9,     false,
      "iterations to solution"},
 
+    {"tlb",                "dTLB miss%",   10,    false,
+     "percentage of data TLB loads that missed"},
+
     //------------------------------------------------------
     // tester parameters
     //------------------------------------------------------
@@ -374,6 +396,15 @@ static param_desc_t ParamDesc[] = {
     {"--hmode=[f|t]",      "House. mode",  11,    true,
      "Householder mode for QR/LQ - flat or tree [default: f]"},
 
+    {"--huge=[n|t|e]",     "huge",         4,     true,
+     "huge pages - none, transparent or explicit [default: n]"},
+
+    {"--panel=[i|r|t]",    "panel",        5,     true,
+     "LU panel - iterative, recursive or tournament pivoting [default: i]"},
+
+    {"--inplace=[n|y]",    "inplace",      7,     true,
+     "translate LAPACK layout to tiles in place [default: n]"},
+
     {"--dim=",             "Dimensions",   6,     true,
      "M x N x K dimensions [default: 1000 x 1000 x 1000]\n"
      INDENT "M, N, K can each be a single value or a range.\n"
@@ -395,6 +426,12 @@ static param_desc_t ParamDesc[] = {
     {"--ib=",              "ib",           4,     true,
      "IB inner blocking size [default: 64]"},
 
+    {"--lookahead=",       "lookahead",    9,     true,
+     "lookahead depth of the factorizations [default: 1]"},
+
+    {"--nested=",          "nested",       6,     true,
+     "nested tasks per critical-path kernel, 0 if automatic [default: 0]"},
+
     {"--alpha=",           "alpha",        14,    true,
      "scalar alpha"},
 
@@ -543,6 +580,7 @@ void print_routine_usage(const char *program_name, const char *name, param_value
             case PARAM_TIME:
             case PARAM_GFLOPS:
             case PARAM_ITERSV:
+            case PARAM_TLB:
                 break;
 
             default:
@@ -648,6 +686,9 @@ int test_routine(const char *name, param_value_t pval[], bool test)
             case PARAM_COLROW:
             case PARAM_NORM:
             case PARAM_HMODE:
+            case PARAM_HUGE:
+            case PARAM_PANEL:
+            case PARAM_INPLACE:
                 printf("  %*c", ParamDesc[i].width, pval[i].c);
                 break;
 
@@ -667,6 +708,8 @@ int test_routine(const char *name, param_value_t pval[], bool test)
             case PARAM_NRHS:
             case PARAM_NB:
             case PARAM_IB:
+            case PARAM_LOOKAHEAD:
+            case PARAM_NESTED:
             case PARAM_PADA:
             case PARAM_PADB:
             case PARAM_PADC:
@@ -683,6 +726,14 @@ int test_routine(const char *name, param_value_t pval[], bool test)
                 printf("  %*.4f", ParamDesc[i].width, pval[i].d);
                 break;
 
+            // rates, negative if not measured
+            case PARAM_TLB:
+                if (pval[i].d >= 0.0)
+                    printf("  %*.3f", ParamDesc[i].width, pval[i].d);
+                else
+                    printf("  %*s", ParamDesc[i].width, "--");
+                break;
+
             // complex parameters
             case PARAM_ALPHA:
             case PARAM_BETA:
@@ -816,6 +867,13 @@ void param_read(int argc, char **argv, param_t param[])
 
         else if (param_starts_with(argv[i], "--hmode="))
             err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_HMODE]);
+        else if (param_starts_with(argv[i], "--huge="))
+            err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_HUGE]);
+        else if (param_starts_with(argv[i], "--panel="))
+            err = param_scan_char(strchr(argv[i], '=')+1, &param[PARAM_PANEL]);
+        else if (param_starts_with(argv[i], "--inplace="))
+            err = param_scan_char(strchr(argv[i], '=')+1,
+                                  &param[PARAM_INPLACE]);
 
         //--------------------------------------------------
         // Scan integer parameters.
@@ -840,6 +898,12 @@ void param_read(int argc, char **argv, param_t param[])
             err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_NB]);
         else if (param_starts_with(argv[i], "--ib="))
             err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_IB]);
+        else if (param_starts_with(argv[i], "--lookahead="))
+            err = param_scan_int(strchr(argv[i], '=')+1,
+                                 &param[PARAM_LOOKAHEAD]);
+        else if (param_starts_with(argv[i], "--nested="))
+            err = param_scan_int(strchr(argv[i], '=')+1,
+                                 &param[PARAM_NESTED]);
 
         else if (param_starts_with(argv[i], "--pada="))
             err = param_scan_int(strchr(argv[i], '=')+1, &param[PARAM_PADA]);
@@ -917,6 +981,12 @@ void param_read(int argc, char **argv, param_t param[])
         param_add_char('o', &param[PARAM_NORM]);
     if (param[PARAM_HMODE].num == 0)
         param_add_char('f', &param[PARAM_HMODE]);
+    if (param[PARAM_HUGE].num == 0)
+        param_add_char('n', &param[PARAM_HUGE]);
+    if (param[PARAM_PANEL].num == 0)
+        param_add_char('i', &param[PARAM_PANEL]);
+    if (param[PARAM_INPLACE].num == 0)
+        param_add_char('n', &param[PARAM_INPLACE]);
 
     //--------------------------------------------------
     // Set integer parameters.
@@ -936,6 +1006,10 @@ void param_read(int argc, char **argv, param_t param[])
         param_add_int(256, &param[PARAM_NB]);
     if (param[PARAM_IB].num == 0)
         param_add_int(64, &param[PARAM_IB]);
+    if (param[PARAM_LOOKAHEAD].num == 0)
+        param_add_int(1, &param[PARAM_LOOKAHEAD]);
+    if (param[PARAM_NESTED].num == 0)
+        param_add_int(0, &param[PARAM_NESTED]);
 
     if (param[PARAM_PADA].num == 0)
         param_add_int(0, &param[PARAM_PADA]);
@@ -1481,3 +1555,124 @@ int param_snap(param_t param[], param_value_t pval[])
     }
     return 0;
 }
+
+/***************************************************************************//**
+ *
+ * @brief Converts the --huge option to the PlasmaHugePages value.
+ *
+ ******************************************************************************/
+plasma_enum_t huge_pages_const(char c)
+{
+    switch (c) {
+    case 't': return PlasmaHugePagesTransparent;
+    case 'e': return PlasmaHugePagesExplicit;
+    default:  return PlasmaHugePagesNone;
+    }
+}
+
+/***************************************************************************//**
+ *
+ * @brief Converts the --panel option to the PlasmaGetrfPanel value.
+ *
+ ******************************************************************************/
+plasma_enum_t getrf_panel_const(char c)
+{
+    switch (c) {
+    case 'r': return PlasmaPanelRecursive;
+    case 't': return PlasmaPanelTournament;
+    default:  return PlasmaPanelIterative;
+    }
+}
+
+//==============================================================================
+// Data TLB counters of the OpenMP threads, opened by tlb_start().
+static int *tlb_fd = NULL;
+static int tlb_nthreads = 0;
+
+#ifdef __linux__
+/******************************************************************************/
+static int tlb_open(int result)
+{
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.config = PERF_COUNT_HW_CACHE_DTLB |
+                  (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                  (result << 16);
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+}
+#endif
+
+/***************************************************************************//**
+ *
+ * @brief Starts counting the data TLB loads and misses of the OpenMP threads.
+ *        Each thread of a parallel region opens its own counters,
+ *        which count the tasks it runs until tlb_stop().
+ *
+ ******************************************************************************/
+void tlb_start()
+{
+    tlb_nthreads = omp_get_max_threads();
+    tlb_fd = (int*)malloc(2*tlb_nthreads*sizeof(int));
+    assert(tlb_fd != NULL);
+    for (int i = 0; i < 2*tlb_nthreads; i++)
+        tlb_fd[i] = -1;
+
+#ifdef __linux__
+    #pragma omp parallel
+    {
+        int t = omp_get_thread_num();
+        tlb_fd[2*t]   = tlb_open(PERF_COUNT_HW_CACHE_RESULT_ACCESS);
+        tlb_fd[2*t+1] = tlb_open(PERF_COUNT_HW_CACHE_RESULT_MISS);
+        for (int i = 2*t; i <= 2*t+1; i++) {
+            if (tlb_fd[i] >= 0) {
+                ioctl(tlb_fd[i], PERF_EVENT_IOC_RESET, 0);
+                ioctl(tlb_fd[i], PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+    }
+#endif
+}
+
+/***************************************************************************//**
+ *
+ * @brief Stops the counters started by tlb_start().
+ *
+ * @retval percentage of the data TLB loads that missed,
+ *         or -1 if the counters are not available
+ *
+ ******************************************************************************/
+double tlb_stop()
+{
+    long long loads = 0;
+    long long misses = 0;
+    bool available = true;
+
+    #pragma omp parallel reduction(+:loads, misses) reduction(&&:available)
+    {
+        int t = imin(omp_get_thread_num(), tlb_nthreads-1);
+        for (int i = 2*t; i <= 2*t+1; i++) {
+            long long count = 0;
+            if (tlb_fd[i] < 0 ||
+                read(tlb_fd[i], &count, sizeof(count)) != sizeof(count)) {
+                available = false;
+            }
+            if (tlb_fd[i] >= 0)
+                close(tlb_fd[i]);
+            if (i == 2*t)
+                loads += count;
+            else
+                misses += count;
+        }
+    }
+    free(tlb_fd);
+    tlb_fd = NULL;
+
+    if (! available || loads == 0)
+        return -1.0;
+    return 100.0*misses/loads;
+}
@@ -28,6 +28,7 @@ typedef enum {
     PARAM_TIME,    // time to solution
     PARAM_GFLOPS,  // GFLOPS rate
     PARAM_ITERSV,  // iterations to solution
+    PARAM_TLB,     // data TLB miss rate
 
     //------------------------------------------------------
     // tester parameters
@@ -51,6 +52,9 @@ typedef enum {
     PARAM_UPLO,    // general rectangular or upper or lower triangular
     PARAM_DIAG,    // non-unit or unit diagonal
     PARAM_HMODE,   // Householder mode - tree or flat
+    PARAM_HUGE,    // huge pages - none, transparent or explicit
+    PARAM_PANEL,   // LU panel - iterative, recursive or tournament
+    PARAM_INPLACE, // in-place translation from LAPACK layout - y or n
 
     // numeric params
     PARAM_DIM,     // M, N, K dimensions
@@ -59,6 +63,8 @@ typedef enum {
     PARAM_NRHS,    // number of RHS
     PARAM_NB,      // tile size NBxNB
     PARAM_IB,      // inner blocking size
+    PARAM_LOOKAHEAD, // lookahead depth
+    PARAM_NESTED,  // nested tasks per critical-path kernel, 0 if automatic
     PARAM_ALPHA,   // scalar alpha
     PARAM_BETA,    // scalar beta
     PARAM_PADA,    // padding of A
@@ -107,9 +113,6 @@ typedef struct {
     param_value_t *val; // array of values for a parameter
 } param_t;
 
-// hiding double from precision translation when used for taking time
-typedef double plasma_time_t;
-
 // initial size of values array
 static const int InitValArraySize = 1024;
 
@@ -149,6 +152,10 @@ void param_add_complex(plasma_complex64_t zval, param_t *param);
 int  param_step_inner(param_t param[]);
 int  param_step_outer(param_t param[], int idx);
 int  param_snap(param_t param[], param_value_t value[]);
+plasma_enum_t huge_pages_const(char c);
+plasma_enum_t getrf_panel_const(char c);
+void tlb_start();
+double tlb_stop();
 
 //==============================================================================
 static inline int imin(int a, int b)
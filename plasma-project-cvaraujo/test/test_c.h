@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/test/test_z.h, normal z -> c, Fri Sep 28 17:38:26 2018
+ * @generated from test/test_z.h, normal z -> c, Sat Oct 17 03:36:10 2026
  *
  **/
 #ifndef TEST_C_H
@@ -54,6 +54,8 @@ void test_cpbtrf(param_value_t param[], bool run);
 void test_cpoinv(param_value_t param[], bool run);
 void test_cposv(param_value_t param[], bool run);
 void test_cpotrf(param_value_t param[], bool run);
+void test_cpotrf_update(param_value_t param[], bool run);
+void test_cpotrf_downdate(param_value_t param[], bool run);
 void test_cpotri(param_value_t param[], bool run);
 void test_cpotrs(param_value_t param[], bool run);
 void test_csymm(param_value_t param[], bool run);
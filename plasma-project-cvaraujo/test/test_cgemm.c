@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/test/test_zgemm.c, normal z -> c, Fri Sep 28 17:38:27 2018
+ * @generated from test/test_zgemm.c, normal z -> c, Sat Oct 17 02:05:46 2026
  *
  **/
 #include "test.h"
@@ -49,6 +49,8 @@ void test_cgemm(param_value_t param[], bool run)
     param[PARAM_PADB   ].used = true;
     param[PARAM_PADC   ].used = true;
     param[PARAM_NB     ].used = true;
+    param[PARAM_HUGE   ].used = true;
+    param[PARAM_TLB    ].used = true;
     if (! run)
         return;
 
@@ -105,6 +107,7 @@ void test_cgemm(param_value_t param[], bool run)
     //================================================================
     plasma_set(PlasmaTuning, PlasmaDisabled);
     plasma_set(PlasmaNb, param[PARAM_NB].i);
+    plasma_set(PlasmaHugePages, huge_pages_const(param[PARAM_HUGE].c));
 
     //================================================================
     // Allocate and initialize arrays.
@@ -144,6 +147,7 @@ void test_cgemm(param_value_t param[], bool run)
     //================================================================
     // Run and time PLASMA.
     //================================================================
+    tlb_start();
     plasma_time_t start = omp_get_wtime();
 
     plasma_cgemm(
@@ -155,6 +159,7 @@ void test_cgemm(param_value_t param[], bool run)
 
     plasma_time_t stop = omp_get_wtime();
     plasma_time_t time = stop-start;
+    param[PARAM_TLB].d = tlb_stop();
 
     param[PARAM_TIME].d = time;
     param[PARAM_GFLOPS].d = flops_cgemm(m, n, k) / time / 1e9;
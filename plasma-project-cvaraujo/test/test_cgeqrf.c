@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/test/test_zgeqrf.c, normal z -> c, Fri Sep 28 17:38:28 2018
+ * @generated from test/test_zgeqrf.c, normal z -> c, Sat Oct 17 04:04:33 2026
  *
  **/
 
@@ -43,8 +43,10 @@ void test_cgeqrf(param_value_t param[], bool run)
     param[PARAM_DIM    ].used = PARAM_USE_M | PARAM_USE_N;
     param[PARAM_PADA   ].used = true;
     param[PARAM_NB     ].used = true;
+    param[PARAM_LOOKAHEAD].used = true;
     param[PARAM_IB     ].used = true;
     param[PARAM_HMODE  ].used = true;
+    param[PARAM_NESTED ].used = true;
     if (! run)
         return;
 
@@ -65,6 +67,8 @@ void test_cgeqrf(param_value_t param[], bool run)
     plasma_set(PlasmaTuning, PlasmaDisabled);
     plasma_set(PlasmaNb, param[PARAM_NB].i);
     plasma_set(PlasmaIb, param[PARAM_IB].i);
+    plasma_set(PlasmaLookahead, param[PARAM_LOOKAHEAD].i);
+    plasma_set(PlasmaNestedTasks, param[PARAM_NESTED].i);
     if (param[PARAM_HMODE].c == 't')
         plasma_set(PlasmaHouseholderMode, PlasmaTreeHouseholder);
     else
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/test/test_zgetrf.c, normal z -> c, Fri Sep 28 17:38:28 2018
+ * @generated from test/test_zgetrf.c, normal z -> c, Sat Oct 17 04:01:43 2026
  *
  **/
 #include "test.h"
@@ -44,9 +44,12 @@ void test_cgetrf(param_value_t param[], bool run)
     param[PARAM_DIM    ].used = PARAM_USE_M | PARAM_USE_N;
     param[PARAM_PADA   ].used = true;
     param[PARAM_NB     ].used = true;
+    param[PARAM_LOOKAHEAD].used = true;
     param[PARAM_IB     ].used = true;
     param[PARAM_MTPF   ].used = true;
     param[PARAM_ZEROCOL].used = true;
+    param[PARAM_PANEL  ].used = true;
+    param[PARAM_NESTED ].used = true;
     if (! run)
         return;
 
@@ -68,6 +71,9 @@ void test_cgetrf(param_value_t param[], bool run)
     plasma_set(PlasmaNb, param[PARAM_NB].i);
     plasma_set(PlasmaIb, param[PARAM_IB].i);
     plasma_set(PlasmaNumPanelThreads, param[PARAM_MTPF].i);
+    plasma_set(PlasmaLookahead, param[PARAM_LOOKAHEAD].i);
+    plasma_set(PlasmaGetrfPanel, getrf_panel_const(param[PARAM_PANEL].c));
+    plasma_set(PlasmaNestedTasks, param[PARAM_NESTED].i);
 
     //================================================================
     // Allocate and initialize arrays.
@@ -0,0 +1,170 @@
+/**
+ *
+ * @file
+ *
+ *  PLASMA is a software package provided by:
+ *  University of Tennessee, US,
+ *  University of Manchester, UK.
+ *
+ * @generated from test/test_zpotrf_downdate.c, normal z -> c, Sat Oct 17 03:36:10 2026
+ *
+ **/
+#include "test.h"
+#include "flops.h"
+#include "plasma.h"
+#include <plasma_core_blas.h>
+#include "core_lapack.h"
+
+#include <assert.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <omp.h>
+
+#define COMPLEX
+
+#define A(i_, j_) A[(i_) + (size_t)lda*(j_)]
+
+/***************************************************************************//**
+ *
+ * @brief Tests CPOTRF_DOWNDATE.
+ *
+ * @param[in,out] param - array of parameters
+ * @param[in]     run - whether to run test
+ *
+ * Sets flags in param indicating which parameters are used.
+ * If run is true, also runs test and stores output parameters.
+ ******************************************************************************/
+void test_cpotrf_downdate(param_value_t param[], bool run)
+{
+    //================================================================
+    // Mark which parameters are used.
+    //================================================================
+    param[PARAM_UPLO   ].used = true;
+    param[PARAM_DIM    ].used = PARAM_USE_N | PARAM_USE_K;
+    param[PARAM_PADA   ].used = true;
+    param[PARAM_PADB   ].used = true;
+    param[PARAM_NB     ].used = true;
+    if (! run)
+        return;
+
+    //================================================================
+    // Set parameters.
+    //================================================================
+    plasma_enum_t uplo = plasma_uplo_const(param[PARAM_UPLO].c);
+
+    int n = param[PARAM_DIM].dim.n;
+    int k = param[PARAM_DIM].dim.k;
+
+    int lda = imax(1, n + param[PARAM_PADA].i);
+    int ldv = imax(1, n + param[PARAM_PADB].i);
+
+    int test = param[PARAM_TEST].c == 'y';
+    float tol = param[PARAM_TOL].d * LAPACKE_slamch('E');
+
+    //================================================================
+    // Set tuning parameters.
+    //================================================================
+    plasma_set(PlasmaTuning, PlasmaDisabled);
+    plasma_set(PlasmaNb, param[PARAM_NB].i);
+
+    //================================================================
+    // Allocate and initialize arrays.
+    //================================================================
+    plasma_complex32_t *A =
+        (plasma_complex32_t*)malloc((size_t)lda*n*sizeof(plasma_complex32_t));
+    assert(A != NULL);
+
+    plasma_complex32_t *V =
+        (plasma_complex32_t*)malloc((size_t)ldv*k*sizeof(plasma_complex32_t));
+    assert(V != NULL);
+
+    int seed[] = {0, 0, 0, 1};
+    lapack_int retval;
+    retval = LAPACKE_clarnv(1, seed, (size_t)lda*n, A);
+    assert(retval == 0);
+
+    retval = LAPACKE_clarnv(1, seed, (size_t)ldv*k, V);
+    assert(retval == 0);
+
+    //================================================================
+    // Make the A matrix symmetric/Hermitian positive definite.
+    // It increases diagonal by n, and makes it real.
+    // It sets Aji = conjf( Aij ) for j < i, that is, copy lower
+    // triangle to upper triangle.
+    //================================================================
+    for (int i = 0; i < n; i++) {
+        A(i, i) = creal(A(i, i)) + n;
+        for (int j = 0; j < i; j++) {
+            A(j, i) = conjf(A(i, j));
+        }
+    }
+
+    plasma_complex32_t *Aref = NULL;
+    if (test) {
+        Aref = (plasma_complex32_t*)malloc(
+            (size_t)lda*n*sizeof(plasma_complex32_t));
+        assert(Aref != NULL);
+
+        memcpy(Aref, A, (size_t)lda*n*sizeof(plasma_complex32_t));
+    }
+
+    // Factor A + V*V^H, so that the downdate is positive definite.
+    cblas_cherk(CblasColMajor,
+                (CBLAS_UPLO)uplo, CblasNoTrans,
+                n, k,
+                1.0, V, ldv,
+                1.0, A, lda);
+    retval = LAPACKE_cpotrf(LAPACK_COL_MAJOR, lapack_const(uplo), n, A, lda);
+    assert(retval == 0);
+
+    //================================================================
+    // Run and time PLASMA.
+    //================================================================
+    plasma_time_t start = omp_get_wtime();
+    int plainfo = plasma_cpotrf_downdate(uplo, n, k, A, lda, V, ldv);
+    plasma_time_t stop = omp_get_wtime();
+    plasma_time_t time = stop-start;
+
+    param[PARAM_TIME].d = time;
+    param[PARAM_GFLOPS].d = flops_cpotrf_update(n, k) / time / 1e9;
+
+    //================================================================
+    // Test results by comparing to the factorization of A.
+    //================================================================
+    if (test) {
+        int lapinfo = LAPACKE_cpotrf(LAPACK_COL_MAJOR,
+                                     lapack_const(uplo), n,
+                                     Aref, lda);
+        if (plainfo == 0 && lapinfo == 0) {
+            plasma_complex32_t zmone = -1.0;
+            cblas_caxpy((size_t)lda*n, CBLAS_SADDR(zmone), Aref, 1, A, 1);
+
+            float work[1];
+            float Anorm = LAPACKE_clanhe_work(
+                LAPACK_COL_MAJOR, 'F', lapack_const(uplo), n, Aref, lda, work);
+            float error = LAPACKE_clange_work(
+                LAPACK_COL_MAJOR, 'F', n, n, A, lda, work);
+            if (Anorm != 0)
+                error /= Anorm;
+
+            param[PARAM_ERROR].d = error;
+            param[PARAM_SUCCESS].i = error < tol;
+        }
+        else {
+            param[PARAM_ERROR].d = INFINITY;
+            param[PARAM_SUCCESS].i = 0;
+        }
+    }
+
+    //================================================================
+    // Free arrays.
+    //================================================================
+    free(A);
+    free(V);
+    if (test)
+        free(Aref);
+}
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/test/test_ztrsm.c, normal z -> c, Fri Sep 28 17:38:32 2018
+ * @generated from test/test_ztrsm.c, normal z -> c, Sat Oct 17 02:05:46 2026
  *
  **/
 #include "test.h"
@@ -51,6 +51,8 @@ void test_ctrsm(param_value_t param[], bool run)
     param[PARAM_PADA   ].used = true;
     param[PARAM_PADB   ].used = true;
     param[PARAM_NB     ].used = true;
+    param[PARAM_HUGE   ].used = true;
+    param[PARAM_TLB    ].used = true;
     if (! run)
         return;
 
@@ -90,6 +92,7 @@ void test_ctrsm(param_value_t param[], bool run)
     //================================================================
     plasma_set(PlasmaTuning, PlasmaDisabled);
     plasma_set(PlasmaNb, param[PARAM_NB].i);
+    plasma_set(PlasmaHugePages, huge_pages_const(param[PARAM_HUGE].c));
 
     //================================================================
     // Allocate and initialize arrays.
@@ -155,6 +158,7 @@ void test_ctrsm(param_value_t param[], bool run)
     //================================================================
     // Run and time PLASMA.
     //================================================================
+    tlb_start();
     plasma_time_t start = omp_get_wtime();
 
     plasma_ctrsm(
@@ -166,6 +170,7 @@ void test_ctrsm(param_value_t param[], bool run)
 
     plasma_time_t stop = omp_get_wtime();
     plasma_time_t time = stop-start;
+    param[PARAM_TLB].d = tlb_stop();
 
     param[PARAM_TIME].d = time;
     param[PARAM_GFLOPS].d = flops_ctrsm(side, m, n) / time / 1e9;
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/test/test_ztrtri.c, normal z -> c, Fri Sep 28 17:38:33 2018
+ * @generated from test/test_ztrtri.c, normal z -> c, Sat Oct 17 04:06:00 2026
  *
  **/
 #include "test.h"
@@ -48,6 +48,8 @@ void test_ctrtri(param_value_t param[], bool run)
     param[PARAM_DIM    ].used = PARAM_USE_N;
     param[PARAM_PADA   ].used = true;
     param[PARAM_NB     ].used = true;
+    param[PARAM_IB     ].used = true;
+    param[PARAM_NESTED ].used = true;
     if (! run)
         return;
 
@@ -69,6 +71,8 @@ void test_ctrtri(param_value_t param[], bool run)
     //================================================================
     plasma_set(PlasmaTuning, PlasmaDisabled);
     plasma_set(PlasmaNb, param[PARAM_NB].i);
+    plasma_set(PlasmaIb, param[PARAM_IB].i);
+    plasma_set(PlasmaNestedTasks, param[PARAM_NESTED].i);
 
     //================================================================
     // Allocate and initialize arrays.
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/test/test_z.h, normal z -> d, Fri Sep 28 17:38:26 2018
+ * @generated from test/test_z.h, normal z -> d, Sat Oct 17 03:36:10 2026
  *
  **/
 #ifndef TEST_D_H
@@ -54,6 +54,8 @@ void test_dpbtrf(param_value_t param[], bool run);
 void test_dpoinv(param_value_t param[], bool run);
 void test_dposv(param_value_t param[], bool run);
 void test_dpotrf(param_value_t param[], bool run);
+void test_dpotrf_update(param_value_t param[], bool run);
+void test_dpotrf_downdate(param_value_t param[], bool run);
 void test_dpotri(param_value_t param[], bool run);
 void test_dpotrs(param_value_t param[], bool run);
 void test_dsymm(param_value_t param[], bool run);
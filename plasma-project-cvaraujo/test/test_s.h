@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/test/test_z.h, normal z -> s, Fri Sep 28 17:38:26 2018
+ * @generated from test/test_z.h, normal z -> s, Sat Oct 17 03:36:10 2026
  *
  **/
 #ifndef TEST_S_H
@@ -54,6 +54,8 @@ void test_spbtrf(param_value_t param[], bool run);
 void test_spoinv(param_value_t param[], bool run);
 void test_sposv(param_value_t param[], bool run);
 void test_spotrf(param_value_t param[], bool run);
+void test_spotrf_update(param_value_t param[], bool run);
+void test_spotrf_downdate(param_value_t param[], bool run);
 void test_spotri(param_value_t param[], bool run);
 void test_spotrs(param_value_t param[], bool run);
 void test_ssymm(param_value_t param[], bool run);
@@ -6,7 +6,7 @@
  *  University of Tennessee, US,
  *  University of Manchester, UK.
  *
- * @generated from /home/luszczek/workspace/plasma/bitbucket/plasma/test/test_zpotrf.c, normal z -> s, Fri Sep 28 17:38:31 2018
+ * @generated from test/test_zpotrf.c, normal z -> s, Sat Oct 17 04:31:51 2026
  *
  **/
 #include "test.h"
@@ -47,7 +47,10 @@ void test_spotrf(param_value_t param[], bool run)
     param[PARAM_DIM    ].used = PARAM_USE_N;
     param[PARAM_PADA   ].used = true;
     param[PARAM_NB     ].used = true;
+    param[PARAM_LOOKAHEAD].used = true;
+    param[PARAM_NESTED ].used = true;
     param[PARAM_ZEROCOL].used = true;
+    param[PARAM_INPLACE].used = true;
     if (! run)
         return;
 
@@ -68,6 +71,10 @@ void test_spotrf(param_value_t param[], bool run)
     //================================================================
     plasma_set(PlasmaTuning, PlasmaDisabled);
     plasma_set(PlasmaNb, param[PARAM_NB].i);
+    plasma_set(PlasmaLookahead, param[PARAM_LOOKAHEAD].i);
+    plasma_set(PlasmaNestedTasks, param[PARAM_NESTED].i);
+    plasma_set(PlasmaInplaceOutplace,
+               param[PARAM_INPLACE].c == 'y' ? PlasmaInplace : PlasmaOutplace);
 
     //================================================================
     // Allocate and initialize arrays.
@@ -141,7 +148,19 @@ void test_spotrf(param_value_t param[], bool run)
             param[PARAM_SUCCESS].i = error < tol;
         }
         else {
-            if (plainfo == lapinfo) {
+            // The factorization failed, and the array must still be in
+            // LAPACK layout, with the other triangle and the padding
+            // untouched.
+            bool untouched = true;
+            for (int j = 0; j < n; j++) {
+                for (int i = 0; i < lda; i++) {
+                    bool other = uplo == PlasmaLower ? i < j : i > j;
+                    if ((other || i >= n) &&
+                        A(i, j) != Aref[i + (size_t)lda*j])
+                        untouched = false;
+                }
+            }
+            if (plainfo == lapinfo && untouched) {
                 param[PARAM_ERROR].d = 0.0;
                 param[PARAM_SUCCESS].i = 1;
             }
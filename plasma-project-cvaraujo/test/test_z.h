@@ -54,6 +54,8 @@ void test_zpbtrf(param_value_t param[], bool run);
 void test_zpoinv(param_value_t param[], bool run);
 void test_zposv(param_value_t param[], bool run);
 void test_zpotrf(param_value_t param[], bool run);
+void test_zpotrf_update(param_value_t param[], bool run);
+void test_zpotrf_downdate(param_value_t param[], bool run);
 void test_zpotri(param_value_t param[], bool run);
 void test_zpotrs(param_value_t param[], bool run);
 void test_zsymm(param_value_t param[], bool run);
@@ -0,0 +1,96 @@
+// Microbenchmark of the barrier of the multithreaded panel kernels.
+//
+// Compares plasma_barrier_wait() with the previous barrier, which spins
+// on a counter without pausing and never sleeps. Each team of threads
+// passes the barrier a number of times and the average time per barrier
+// is printed, for teams of 2 to 64 threads by default. Teams larger than
+// the number of cores show the cost of spinning while oversubscribed.
+//
+// Build it with CMake (target plasma_barrier_bench) or with:
+//
+//     make barrier_bench
+//
+// Usage:
+//
+//     tools/barrier_bench [min_threads [max_threads [iterations]]]
+
+#include "plasma_barrier.h"
+
+#include <omp.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+//==============================================================================
+// Barrier used before plasma_barrier_wait() was made sense-reversing.
+typedef struct {
+    int count;
+    volatile int passed;
+} spin_barrier_t;
+
+static void spin_barrier_wait(spin_barrier_t *barrier, int size)
+{
+    int passed_old = barrier->passed;
+
+    __sync_fetch_and_add(&barrier->count, 1);
+    if (__sync_bool_compare_and_swap(&barrier->count, size, 0))
+        barrier->passed++;
+    else
+        while (barrier->passed == passed_old);
+}
+
+//==============================================================================
+static double time_spin(int nthreads, int iterations)
+{
+    spin_barrier_t barrier = { 0, 0 };
+    double start = omp_get_wtime();
+    #pragma omp parallel num_threads(nthreads)
+    {
+        for (int i = 0; i < iterations; i++)
+            spin_barrier_wait(&barrier, nthreads);
+    }
+    return (omp_get_wtime()-start)/iterations;
+}
+
+//==============================================================================
+static double time_plasma(int nthreads, int iterations)
+{
+    plasma_barrier_t barrier;
+    plasma_barrier_init(&barrier);
+    double start = omp_get_wtime();
+    #pragma omp parallel num_threads(nthreads)
+    {
+        for (int i = 0; i < iterations; i++)
+            plasma_barrier_wait(&barrier, nthreads);
+    }
+    return (omp_get_wtime()-start)/iterations;
+}
+
+//==============================================================================
+int main(int argc, char **argv)
+{
+    int min_threads = argc > 1 ? atoi(argv[1]) : 2;
+    int max_threads = argc > 2 ? atoi(argv[2]) : 64;
+    int iterations  = argc > 3 ? atoi(argv[3]) : 10000;
+    if (min_threads < 1 || max_threads < min_threads || iterations < 1) {
+        fprintf(stderr,
+                "usage: %s [min_threads [max_threads [iterations]]]\n",
+                argv[0]);
+        return EXIT_FAILURE;
+    }
+    // Keep the requested team sizes.
+    omp_set_dynamic(0);
+
+    printf("cores: %d\n\n", omp_get_num_procs());
+    printf("%8s  %14s  %14s  %8s\n",
+           "threads", "spin [us]", "plasma [us]", "speedup");
+    for (int nthreads = min_threads; nthreads <= max_threads; nthreads *= 2) {
+        // Warm up the team.
+        time_plasma(nthreads, 10);
+
+        double spin = time_spin(nthreads, iterations);
+        double plasma = time_plasma(nthreads, iterations);
+        printf("%8d  %14.3f  %14.3f  %8.2f\n",
+               nthreads, 1e6*spin, 1e6*plasma, spin/plasma);
+    }
+    return EXIT_SUCCESS;
+}
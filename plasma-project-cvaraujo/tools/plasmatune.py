@@ -0,0 +1,401 @@
+#!/usr/bin/env python3
+#
+# Tunes PLASMA for this machine and writes a Lua tuning file, e.g.:
+#
+#     ./tools/plasmatune.py --test ./plasmatest -o tuning.lua
+#     PLASMA_TUNING_FILENAME=tuning.lua ./my_program
+#
+# For each routine, precision, number of threads and matrix size, sweeps the
+# tile size nb, then the inner blocking ib, then the number of panel threads,
+# each with the best of the previous ones, timing the routines with the
+# tester (--test=n). The tuning file is tuning/default.lua followed by
+# functions returning the settings measured for the nearest number of threads
+# and size; routines and precisions not tuned keep the defaults.
+#
+# With --table, the settings are also written as a plain-text table, which
+# PLASMA loads once, without Lua, when PLASMA_TUNING_FILENAME does not end
+# in .lua.
+#
+# Measurements are cached in a JSON file (--cache, default plasmatune.json),
+# written after each run of the tester. Re-running reuses them, so an
+# interrupted run resumes, and extending the grid measures only the new points.
+#
+# Tested with python 2.7 and 3.8.
+
+from __future__ import print_function
+
+import argparse
+import json
+import multiprocessing
+import os
+import re
+import socket
+import subprocess
+import sys
+import time
+
+# ------------------------------------------------------------------------------
+# For each routine tuned by control/tuning.c:
+# Lua arguments after type and num_threads, Lua expression of the size, and
+# settings it reads. The tester runs with square matrices of the size.
+routines = {
+    'gbtrf': ('n, bw',   'n',                  ['nb', 'ib', 'max_panel_threads']),
+    'geadd': ('m, n',    'math.sqrt(m*n)',     ['nb']),
+    'geinv': ('m, n',    'math.sqrt(m*n)',     ['nb', 'ib', 'max_panel_threads']),
+    'gelqf': ('m, n',    'math.sqrt(m*n)',     ['nb', 'ib']),
+    'gemm':  ('m, n, k', '(m*n*k)^(1/3)',      ['nb']),
+    'geqrf': ('m, n',    'math.sqrt(m*n)',     ['nb', 'ib']),
+    'geswp': ('m, n',    'math.sqrt(m*n)',     ['nb']),
+    'getrf': ('m, n',    'math.sqrt(m*n)',     ['nb', 'ib', 'max_panel_threads']),
+    'hetrf': ('n',       'n',                  ['nb']),
+    'lacpy': ('m, n',    'math.sqrt(m*n)',     ['nb']),
+    'lag2c': ('m, n',    'math.sqrt(m*n)',     ['nb']),
+    'lange': ('m, n',    'math.sqrt(m*n)',     ['nb']),
+    'lansy': ('n',       'n',                  ['nb']),
+    'lantr': ('m, n',    'math.sqrt(m*n)',     ['nb']),
+    'lascl': ('m, n',    'math.sqrt(m*n)',     ['nb']),
+    'laset': ('m, n',    'math.sqrt(m*n)',     ['nb']),
+    'lauum': ('n',       'n',                  ['nb']),
+    'pbtrf': ('n',       'n',                  ['nb']),
+    'poinv': ('n',       'n',                  ['nb']),
+    'potrf': ('n',       'n',                  ['nb']),
+    'symm':  ('m, n',    'math.sqrt(m*n)',     ['nb']),
+    'syr2k': ('n, k',    'math.sqrt(n*k)',     ['nb']),
+    'syrk':  ('n, k',    'math.sqrt(n*k)',     ['nb']),
+    'tradd': ('m, n',    'math.sqrt(m*n)',     ['nb']),
+    'trmm':  ('m, n',    'math.sqrt(m*n)',     ['nb']),
+    'trsm':  ('m, n',    'math.sqrt(m*n)',     ['nb']),
+    'trtri': ('n',       'n',                  ['nb']),
+}
+
+# tester names differing from the precision letter and the routine name
+tester_names = {
+    ('d', 'hetrf'): 'dsytrf',
+    ('s', 'hetrf'): 'ssytrf',
+    ('d', 'lag2c'): 'dlag2s',
+    ('s', 'lag2c'): None,
+    ('c', 'lag2c'): None,
+}
+
+# tester option of each setting and its default
+options = {
+    'nb':                ('--nb',   256),
+    'ib':                ('--ib',   64),
+    'max_panel_threads': ('--mtpf', 1),
+}
+
+# ------------------------------------------------------------------------------
+def int_list( s ):
+    return [int( x ) for x in s.split( ',' )]
+
+num_cores = multiprocessing.cpu_count()
+
+parser = argparse.ArgumentParser(
+    description='Tunes PLASMA and writes a Lua tuning file.' )
+parser.add_argument( '--test', default='./plasmatest',
+                     help='tester executable [default: ./plasmatest]' )
+parser.add_argument( '--routines', default='gemm,potrf,getrf,geqrf,gelqf,gbtrf',
+                     help='routines to tune [default: %(default)s]' )
+parser.add_argument( '--precisions', default='d',
+                     help='precisions to tune, among s,d,c,z [default: d]' )
+parser.add_argument( '--dims', type=int_list, default=[1000, 2000, 4000],
+                     help='matrix sizes [default: 1000,2000,4000]' )
+parser.add_argument( '--threads', type=int_list,
+                     default=sorted( set( [max( num_cores//4, 1 ),
+                                           max( num_cores//2, 1 ),
+                                           num_cores] ) ),
+                     help='numbers of threads [default: all, half and a '
+                          'quarter of the cores]' )
+parser.add_argument( '--nb', type=int_list,
+                     default=[128, 160, 192, 224, 256, 320, 384, 448, 512],
+                     help='tile sizes [default: %(default)s]' )
+parser.add_argument( '--ib', type=int_list, default=[16, 32, 48, 64, 96, 128],
+                     help='inner blocking sizes [default: %(default)s]' )
+parser.add_argument( '--mtpf', type=int_list, default=[1, 2, 4, 8, 16],
+                     help='numbers of panel threads [default: %(default)s]' )
+parser.add_argument( '--iter', type=int, default=3,
+                     help='runs per measurement, the median is kept '
+                          '[default: 3]' )
+parser.add_argument( '--cache', default='plasmatune.json',
+                     help='measurement cache [default: %(default)s]' )
+parser.add_argument( '--default', default=None,
+                     help='tuning file to start from '
+                          '[default: tuning/default.lua]' )
+parser.add_argument( '-o', '--output', default='tuning.lua',
+                     help='tuning file written [default: %(default)s]' )
+parser.add_argument( '--table', default=None,
+                     help='also writes the settings as a table, loaded '
+                          'without Lua when PLASMA_TUNING_FILENAME names it' )
+opts = parser.parse_args()
+
+if (opts.default is None):
+    opts.default = os.path.join( os.path.dirname( os.path.abspath( __file__ ) ),
+                                 '..', 'tuning', 'default.lua' )
+
+# ------------------------------------------------------------------------------
+def load_cache():
+    if (os.path.exists( opts.cache )):
+        with open( opts.cache ) as f:
+            return json.load( f )
+    return {}
+# end
+
+def save_cache( cache ):
+    tmp = opts.cache + '.tmp'
+    with open( tmp, 'w' ) as f:
+        json.dump( cache, f, indent=0, sort_keys=True )
+    os.rename( tmp, opts.cache )
+# end
+
+def key( name, threads, dim, settings ):
+    return '%s threads=%d dim=%d %s' % (
+        name, threads, dim,
+        ' '.join( '%s=%d' % (s, settings[s]) for s in sorted( settings ) ))
+# end
+
+# ------------------------------------------------------------------------------
+def parse( output ):
+    '''
+    Returns the rows of the tester output as dictionaries from column header
+    to value. Multi-word headers and complex values are joined first.
+    '''
+    rows = []
+    header = None
+    for line in output.splitlines():
+        line = line.replace( 'Orth. error', 'Orth.error' )
+        line = line.replace( 'House. mode', 'House.mode' )
+        line = line.replace( 'dTLB miss%', 'dTLB_miss%' )
+        line = re.sub( r'(\S+) \+ +(\S+i)\b', r'\1+\2', line )
+        tokens = line.split()
+        if ('Gflop/s' in tokens):
+            header = tokens
+        elif (header and len( tokens ) == len( header )):
+            rows.append( dict( zip( header, tokens ) ) )
+    return rows
+# end
+
+# ------------------------------------------------------------------------------
+def run( name, threads, dim, setting, values, fixed ):
+    '''
+    Runs the tester for all values of a setting at once and returns the
+    Gflop/s of each value, or None if the tester does not have the routine.
+    '''
+    (option, default) = options[setting]
+    cmd = [opts.test, name, '--test=n', '--iter=%d' % opts.iter,
+           '--dim=%d' % dim,
+           '%s=%s' % (option, ','.join( str( v ) for v in values ))]
+    for s in sorted( fixed ):
+        cmd.append( '%s=%d' % (options[s][0], fixed[s]) )
+    env = dict( os.environ )
+    env['OMP_NUM_THREADS'] = str( threads )
+    env.pop( 'PLASMA_TUNING_FILENAME', None )
+    print( 'OMP_NUM_THREADS=%d' % threads, ' '.join( cmd ) )
+    sys.stdout.flush()
+    proc = subprocess.Popen( cmd, env=env, stdout=subprocess.PIPE,
+                             stderr=subprocess.STDOUT,
+                             universal_newlines=True )
+    output = proc.communicate()[0]
+    if ('unknown routine' in output):
+        return None
+    if (proc.returncode != 0):
+        print( output )
+        raise Exception( 'tester failed: ' + ' '.join( cmd ) )
+
+    # The column header of a setting is the tester option without dashes.
+    column = option[2:]
+    gflops = {}
+    for row in parse( output ):
+        if (column in row):
+            gflops.setdefault( int( row[column] ), [] ).append(
+                float( row['Gflop/s'] ) )
+    return gflops
+# end
+
+# ------------------------------------------------------------------------------
+def measure( cache, name, threads, dim, setting, values, fixed ):
+    '''
+    Returns the median Gflop/s of each value of a setting, running the tester
+    only for values not in the cache, or None if the routine is not tested.
+    '''
+    def k( v ):
+        settings = dict( fixed )
+        settings[setting] = v
+        return key( name, threads, dim, settings )
+
+    missing = [v for v in values if k( v ) not in cache]
+    if (missing):
+        gflops = run( name, threads, dim, setting, missing, fixed )
+        if (gflops is None):
+            return None
+        for v in missing:
+            cache[k( v )] = gflops.get( v, [] )
+        save_cache( cache )
+
+    result = {}
+    for v in values:
+        g = sorted( cache[k( v )] )
+        if (g):
+            result[v] = g[len( g )//2]
+    return result
+# end
+
+# ------------------------------------------------------------------------------
+def tune( cache, name, routine, threads, dim ):
+    '''
+    Returns the best settings of a routine, tuning one setting at a time,
+    or None if the tester does not have the routine.
+    '''
+    settings = {}
+    for setting in routines[routine][2]:
+        if (setting == 'nb'):
+            values = opts.nb
+        elif (setting == 'ib'):
+            values = [ib for ib in opts.ib if ib <= settings['nb']]
+        else:
+            values = [t for t in opts.mtpf if t <= threads]
+        fixed = dict( settings )
+        for s in routines[routine][2]:
+            if (s not in fixed and s != setting):
+                fixed[s] = min( options[s][1], settings.get( 'nb', 256 ) )
+        gflops = measure( cache, name, threads, dim, setting, values, fixed )
+        if (gflops is None):
+            return None
+        if (not gflops):
+            raise Exception( 'no measurement of %s for %s' % (setting, name) )
+        settings[setting] = max( gflops, key=lambda v: gflops[v] )
+        print( '    %s %s = %d (%.2f Gflop/s)' % (
+               name, setting, settings[setting], gflops[settings[setting]] ) )
+    return settings
+# end
+
+# ------------------------------------------------------------------------------
+def lua( tuned ):
+    '''
+    Returns the Lua functions returning the tuned settings.
+    '''
+    with open( opts.default ) as f:
+        default = f.read()
+    defined = set( re.findall( r'^function\s+(\w+)', default, re.M ) )
+
+    out = [default.rstrip( '\n' ), '', '',
+           '-' * 80,
+           '-- Generated by tools/plasmatune.py on %s, %s.' % (
+               socket.gethostname(), time.strftime( '%Y-%m-%d %H:%M' ) ),
+           '-- Settings measured for {num_threads, size}; the nearest number',
+           '-- of threads, then the nearest size, are used.',
+           'local tuned = {']
+    for routine in sorted( tuned ):
+        out.append( '    %s = {' % routine )
+        for prec in sorted( tuned[routine] ):
+            out.append( '        %s = {' % prec.upper() )
+            for (threads, dim, settings) in tuned[routine][prec]:
+                out.append( '            { %d, %d, %s },' % (
+                    threads, dim, ', '.join(
+                        '%s = %d' % (s, settings[s])
+                        for s in routines[routine][2] ) ) )
+            out.append( '        },' )
+        out.append( '    },' )
+    out += ['}',
+            '',
+            'local function nearest (routine, setting, type, num_threads, size)',
+            '    local points = tuned[routine] and tuned[routine][type]',
+            '    if points == nil then',
+            '        return nil',
+            '    end',
+            '    local function distance (a, b)',
+            '        return math.abs(math.log(math.max(a, 1) / math.max(b, 1)))',
+            '    end',
+            '    local threads = points[1][1]',
+            '    for _, p in ipairs(points) do',
+            '        if distance(p[1], num_threads) < distance(threads, num_threads) then',
+            '            threads = p[1]',
+            '        end',
+            '    end',
+            '    local best = nil',
+            '    for _, p in ipairs(points) do',
+            '        if p[1] == threads and',
+            '           (best == nil or distance(p[2], size) < distance(best[2], size)) then',
+            '            best = p',
+            '        end',
+            '    end',
+            '    return best[setting]',
+            'end']
+
+    for routine in sorted( tuned ):
+        (args, size, settings) = routines[routine]
+        for setting in settings:
+            func = '%s_%s' % (routine, setting)
+            if (func in defined):
+                fallback = 'default_%s(type, num_threads, %s)' % (func, args)
+                out += ['', 'local default_%s = %s' % (func, func)]
+            else:
+                fallback = str( options[setting][1] )
+                out.append( '' )
+            out += ['function %s (type, num_threads, %s)' % (func, args),
+                    '        return nearest("%s", "%s", type, num_threads, %s)'
+                    % (routine, setting, size),
+                    '            or %s' % fallback,
+                    'end']
+    return '\n'.join( out ) + '\n'
+# end
+
+# ------------------------------------------------------------------------------
+def table( tuned ):
+    '''
+    Returns the tuned settings as a table read by control/tuning_table.c,
+    with 0 for settings not tuned.
+    '''
+    out = ['# Generated by tools/plasmatune.py on %s, %s.' % (
+               socket.gethostname(), time.strftime( '%Y-%m-%d %H:%M' ) ),
+           '# routine type threads size nb ib max_panel_threads']
+    for routine in sorted( tuned ):
+        for prec in sorted( tuned[routine] ):
+            for (threads, dim, settings) in tuned[routine][prec]:
+                out.append( '%-6s %s %5d %7d %4d %4d %4d' % (
+                    routine, prec.upper(), threads, dim,
+                    settings.get( 'nb', 0 ), settings.get( 'ib', 0 ),
+                    settings.get( 'max_panel_threads', 0 ) ) )
+    return '\n'.join( out ) + '\n'
+# end
+
+# ------------------------------------------------------------------------------
+def main():
+    cache = load_cache()
+    tuned = {}
+    for routine in opts.routines.split( ',' ):
+        if (routine not in routines):
+            print( 'unknown routine:', routine )
+            return 1
+        for prec in opts.precisions.split( ',' ):
+            name = tester_names.get( (prec, routine), prec + routine )
+            if (name is None):
+                continue
+            points = []
+            for threads in opts.threads:
+                for dim in opts.dims:
+                    print( 'tuning %s, %d threads, size %d' % (
+                           name, threads, dim ) )
+                    settings = tune( cache, name, routine, threads, dim )
+                    if (settings is None):
+                        break
+                    points.append( (threads, dim, settings) )
+                if (settings is None):
+                    print( '    %s not in the tester, skipped' % name )
+                    break
+            if (points):
+                tuned.setdefault( routine, {} )[prec] = points
+
+    with open( opts.output, 'w' ) as f:
+        f.write( lua( tuned ) )
+    print( '\nwrote %s; use it with PLASMA_TUNING_FILENAME=%s' % (
+           opts.output, os.path.abspath( opts.output ) ) )
+    if (opts.table):
+        with open( opts.table, 'w' ) as f:
+            f.write( table( tuned ) )
+        print( 'wrote %s; use it with PLASMA_TUNING_FILENAME=%s' % (
+               opts.table, os.path.abspath( opts.table ) ) )
+    return 0
+# end
+
+if (__name__ == '__main__'):
+    sys.exit( main() )
@@ -0,0 +1,251 @@
+// Benchmark of the SIMD micro-kernels of the tile kernels.
+//
+// Compares plasma_core_dgemm(), plasma_core_dsyrk() and plasma_core_dtrsm()
+// from core_blas/core_dsimd.c with the vendor CBLAS they override, in all
+// the transpose, uplo, side and diag variants, on tiles of nb = 64 to 256
+// by default. The tiles are nb+1-by-nb-3, with an inner dimension of nb+5
+// for gemm and syrk, so that they do not divide into micro-tiles, and their
+// leading dimensions exceed their rows. For each instruction set supported by this CPU,
+// the rate in Gflop/s and the largest difference from CBLAS, including
+// in the rows past the tiles, are printed.
+//
+// Build it with CMake (target plasma_simd_bench, with PLASMA_SIMD=ON)
+// or with:
+//
+//     make simd_bench
+//
+// Usage:
+//
+//     tools/simd_bench [min_nb [max_nb [step]]]
+
+#include "plasma_core_blas.h"
+#include "plasma_core_simd.h"
+#include "plasma_types.h"
+#include "core_lapack.h"
+
+#include <math.h>
+#include <omp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//==============================================================================
+enum { Gemm, Syrk, Trsm };
+
+// Kernel and its parameters; those not used by the kernel are ignored.
+typedef struct {
+    int kernel;
+    plasma_enum_t side;
+    plasma_enum_t uplo;
+    plasma_enum_t transa;
+    plasma_enum_t transb;
+    plasma_enum_t diag;
+} variant_t;
+
+#define MaxVariants 24
+
+//==============================================================================
+// Lists the variants overridden by the SIMD kernels, returns their number.
+static int variants(variant_t *variant)
+{
+    static const plasma_enum_t trans[] = { PlasmaNoTrans, PlasmaTrans };
+    static const plasma_enum_t uplo[]  = { PlasmaLower, PlasmaUpper };
+    static const plasma_enum_t side[]  = { PlasmaLeft, PlasmaRight };
+    static const plasma_enum_t diag[]  = { PlasmaNonUnit, PlasmaUnit };
+
+    int count = 0;
+    for (int a = 0; a < 2; a++)
+        for (int b = 0; b < 2; b++)
+            variant[count++] = (variant_t){ Gemm, PlasmaLeft, PlasmaGeneral,
+                                            trans[a], trans[b], PlasmaNonUnit };
+    for (int u = 0; u < 2; u++)
+        for (int a = 0; a < 2; a++)
+            variant[count++] = (variant_t){ Syrk, PlasmaLeft, uplo[u],
+                                            trans[a], PlasmaNoTrans,
+                                            PlasmaNonUnit };
+    for (int s = 0; s < 2; s++)
+        for (int u = 0; u < 2; u++)
+            for (int a = 0; a < 2; a++)
+                for (int d = 0; d < 2; d++)
+                    variant[count++] = (variant_t){ Trsm, side[s], uplo[u],
+                                                    trans[a], PlasmaNoTrans,
+                                                    diag[d] };
+    return count;
+}
+
+//==============================================================================
+// Writes the name of a variant, e.g., "gemm NT", "syrk LN" or "trsm RLTN".
+static void variant_name(const variant_t *v, char *name)
+{
+    switch (v->kernel) {
+    case Gemm:
+        sprintf(name, "gemm %c%c",
+                lapack_const(v->transa), lapack_const(v->transb));
+        break;
+    case Syrk:
+        sprintf(name, "syrk %c%c",
+                lapack_const(v->uplo), lapack_const(v->transa));
+        break;
+    default:
+        sprintf(name, "trsm %c%c%c%c",
+                lapack_const(v->side), lapack_const(v->uplo),
+                lapack_const(v->transa), lapack_const(v->diag));
+        break;
+    }
+}
+
+//==============================================================================
+// Returns the flops of a variant on the m-by-n tile C, with inner dimension k.
+static double flops(const variant_t *v, int m, int n, int k)
+{
+    switch (v->kernel) {
+        case Gemm: return 2.0*m*n*k;
+        case Syrk: return 1.0*n*(n+1.0)*k;
+        default:   return v->side == PlasmaLeft ? 1.0*m*m*n : 1.0*m*n*n;
+    }
+}
+
+//==============================================================================
+// Runs a variant on the m-by-n tile C, with inner dimension k, on tiles
+// of leading dimension ld, with CBLAS if vendor is nonzero.
+// syrk writes the n-by-n tile C.
+static void run(const variant_t *v, int vendor, int m, int n, int k, int ld,
+                const double *A, const double *B, double *C)
+{
+    switch (v->kernel) {
+    case Gemm:
+        if (vendor)
+            cblas_dgemm(CblasColMajor,
+                        (CBLAS_TRANSPOSE)v->transa, (CBLAS_TRANSPOSE)v->transb,
+                        m, n, k, -1.0, A, ld, B, ld, 1.0, C, ld);
+        else
+            plasma_core_dgemm(v->transa, v->transb,
+                              m, n, k, -1.0, A, ld, B, ld, 1.0, C, ld);
+        break;
+    case Syrk:
+        if (vendor)
+            cblas_dsyrk(CblasColMajor,
+                        (CBLAS_UPLO)v->uplo, (CBLAS_TRANSPOSE)v->transa,
+                        n, k, -1.0, A, ld, 1.0, C, ld);
+        else
+            plasma_core_dsyrk(v->uplo, v->transa,
+                              n, k, -1.0, A, ld, 1.0, C, ld);
+        break;
+    default:
+        if (vendor)
+            cblas_dtrsm(CblasColMajor,
+                        (CBLAS_SIDE)v->side, (CBLAS_UPLO)v->uplo,
+                        (CBLAS_TRANSPOSE)v->transa, (CBLAS_DIAG)v->diag,
+                        m, n, 1.0, A, ld, C, ld);
+        else
+            plasma_core_dtrsm(v->side, v->uplo,
+                              v->transa, v->diag,
+                              m, n, 1.0, A, ld, C, ld);
+        break;
+    }
+}
+
+//==============================================================================
+// Returns the time of a call, on fresh copies of C0 so trsm stays stable.
+static double time_kernel(const variant_t *v, int vendor,
+                          int m, int n, int k, int ld,
+                          const double *A, const double *B,
+                          const double *C0, double *C, size_t size)
+{
+    int iterations = 1 + (int)(1e9/flops(v, m, n, k));
+    double time = 0.0;
+    for (int i = 0; i < iterations; i++) {
+        memcpy(C, C0, sizeof(double)*size);
+        double start = omp_get_wtime();
+        run(v, vendor, m, n, k, ld, A, B, C);
+        time += omp_get_wtime()-start;
+    }
+    return time/iterations;
+}
+
+//==============================================================================
+int main(int argc, char **argv)
+{
+    int min_nb = argc > 1 ? atoi(argv[1]) : 64;
+    int max_nb = argc > 2 ? atoi(argv[2]) : 256;
+    int step   = argc > 3 ? atoi(argv[3]) : 32;
+    if (min_nb < 4 || max_nb < min_nb || step < 1) {
+        fprintf(stderr, "usage: %s [min_nb [max_nb [step]]], min_nb >= 4\n",
+                argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    static const char *isa_name[] = { "none", "avx2", "avx512" };
+    plasma_core_simd_set_isa(PlasmaSimdAvx512);
+    int max_isa = plasma_core_simd_isa();
+    printf("instruction set: %s\n\n", isa_name[max_isa]);
+
+    printf("%-10s %5s %5s %5s  %12s", "kernel", "m", "n", "k", "cblas [Gf/s]");
+    for (int isa = PlasmaSimdAvx2; isa <= max_isa; isa++)
+        printf("  %7s [Gf/s]  %9s", isa_name[isa], "error");
+    printf("\n");
+
+    variant_t variant[MaxVariants];
+    int num_variants = variants(variant);
+    for (int i = 0; i < num_variants; i++) {
+        variant_t *v = &variant[i];
+        char name[16];
+        variant_name(v, name);
+
+        for (int nb = min_nb; nb <= max_nb; nb += step) {
+            int m = nb+1;
+            int n = nb-3;
+            int k = nb+5;
+            int ld = k+3;
+            size_t size = (size_t)ld*k;
+            double *A  = (double*)malloc(sizeof(double)*size);
+            double *B  = (double*)malloc(sizeof(double)*size);
+            double *C0 = (double*)malloc(sizeof(double)*size);
+            double *C  = (double*)malloc(sizeof(double)*size);
+            double *Cv = (double*)malloc(sizeof(double)*size);
+            if (A == NULL || B == NULL || C0 == NULL || C == NULL ||
+                Cv == NULL) {
+                fprintf(stderr, "malloc() failed\n");
+                return EXIT_FAILURE;
+            }
+            // Make the triangular factors well conditioned,
+            // with a unit diagonal or not.
+            for (size_t j = 0; j < size; j++) {
+                A[j]  = ((double)rand()/RAND_MAX - 0.5)/k;
+                B[j]  = (double)rand()/RAND_MAX - 0.5;
+                C0[j] = (double)rand()/RAND_MAX - 0.5;
+            }
+            for (int j = 0; j < k; j++)
+                A[j+(size_t)j*ld] += 1.0;
+
+            double vendor = time_kernel(v, 1, m, n, k, ld,
+                                        A, B, C0, Cv, size);
+            // Dimensions of the tile C, and inner dimension.
+            int mc = v->kernel == Syrk ? n : m;
+            int kc = v->kernel != Trsm ? k : v->side == PlasmaLeft ? m : n;
+            printf("%-10s %5d %5d %5d  %12.2f", name, mc, n, kc,
+                   1e-9*flops(v, m, n, k)/vendor);
+
+            for (int isa = PlasmaSimdAvx2; isa <= max_isa; isa++) {
+                plasma_core_simd_set_isa(isa);
+                double simd = time_kernel(v, 0, m, n, k, ld,
+                                          A, B, C0, C, size);
+
+                // All of C, so writes past the tile are caught.
+                double error = 0.0;
+                for (size_t j = 0; j < size; j++)
+                    error = fmax(error, fabs(C[j]-Cv[j]));
+                printf("  %14.2f  %9.2e",
+                       1e-9*flops(v, m, n, k)/simd, error);
+            }
+            printf("\n");
+
+            free(A);
+            free(B);
+            free(C0);
+            free(C);
+            free(Cv);
+        }
+    }
+    return EXIT_SUCCESS;
+}
@@ -217,6 +217,7 @@ lapack = [
     ('sgetrs',               'dgetrs',               'cgetrs',               'zgetrs'              ),
     ('spbtrf',               'dpbtrf',               'cpbtrf',               'zpbtrf'              ),
     ('spbtrs',               'dpbtrs',               'cpbtrs',               'zpbtrs'              ),
+    ('shier',                'dhier',                'chier',                'zhier'               ),
     ('shseqr',               'dhseqr',               'chseqr',               'zhseqr'              ),
     ('shst01',               'dhst01',               'chst01',               'zhst01'              ),
     ('slabad',               'dlabad',               'slabad',               'dlabad'              ),
@@ -265,6 +266,7 @@ lapack = [
     ('slatrs',               'dlatrs',               'clatrs',               'zlatrs'              ),
     ('slauum',               'dlauum',               'clauum',               'zlauum'              ),
     ('slavsy',               'dlavsy',               'clavhe',               'zlavhe'              ),
+    ('snested',              'dnested',              'cnested',              'znested'             ),
     ('sorg2r',               'dorg2r',               'cung2r',               'zung2r'              ),
     ('sorgbr',               'dorgbr',               'cungbr',               'zungbr'              ),
     ('sorghr',               'dorghr',               'cunghr',               'zunghr'              ),
@@ -0,0 +1,250 @@
+#!/usr/bin/env python
+#
+# Analyzes a trace written by plasma_trace_stop(), or by setting PLASMA_TRACE
+# to a file name when running a PLASMA program, e.g.:
+#
+#     PLASMA_TRACE=getrf.json ./test dgetrf --dim=4000 --nb=256
+#     ./tools/trace_analysis.py getrf.json -o getrf_analyzed.json
+#
+# The dependencies between the tasks are derived from the tiles they read
+# and write, as OpenMP does from the depend clauses: a task depends on the
+# last task writing a tile it accesses, and a task writing a tile also
+# depends on the tasks reading it since the last write.
+#
+# Prints the critical path, the idle time of each thread and the achieved
+# parallelism over time. With -o, writes the trace with the critical path
+# drawn as flow arrows and the parallelism as a counter track, for viewing
+# in chrome://tracing or https://ui.perfetto.dev.
+#
+# Tested with python 2.7 and 3.8.
+
+from __future__ import print_function
+
+import argparse
+import json
+import sys
+
+# ------------------------------------------------------------------------------
+def load( filename ):
+    '''
+    Returns the task events of a trace, sorted by start time.
+    '''
+    with open( filename ) as f:
+        trace = json.load( f )
+    if (isinstance( trace, dict )):
+        trace = trace['traceEvents']
+    tasks = [e for e in trace if e.get( 'ph' ) == 'X']
+    tasks.sort( key=lambda e: (e['ts'], e['ts'] + e['dur']) )
+    return trace, tasks
+# end
+
+# ------------------------------------------------------------------------------
+def dependencies( tasks ):
+    '''
+    Returns the list of predecessors of each task.
+    Processing the tasks by start time is enough, since a task starts
+    after all its predecessors ended.
+    '''
+    last_writer = {}
+    readers = {}
+    preds = []
+    for i, task in enumerate( tasks ):
+        p = set()
+        for tile in task.get( 'args', {} ).get( 'tiles', [] ):
+            (mode, key) = tile.split( ' ', 1 )
+            if (mode == 'r'):
+                if (key in last_writer):
+                    p.add( last_writer[key] )
+            elif (readers.get( key )):
+                p.update( readers[key] )
+            elif (key in last_writer):
+                p.add( last_writer[key] )
+        for tile in task.get( 'args', {} ).get( 'tiles', [] ):
+            (mode, key) = tile.split( ' ', 1 )
+            if (mode == 'r'):
+                readers.setdefault( key, [] ).append( i )
+            else:
+                last_writer[key] = i
+                readers[key] = []
+        p.discard( i )
+        preds.append( sorted( p ) )
+    return preds
+# end
+
+# ------------------------------------------------------------------------------
+def critical_path( tasks, preds ):
+    '''
+    Returns the longest chain of dependent tasks, weighted by their durations.
+    '''
+    length = [0.0] * len( tasks )
+    prev = [None] * len( tasks )
+    for i, task in enumerate( tasks ):
+        for p in preds[i]:
+            if (length[p] > length[i]):
+                length[i] = length[p]
+                prev[i] = p
+        length[i] += task['dur']
+    if (not tasks):
+        return []
+    i = max( range( len( tasks ) ), key=lambda k: length[k] )
+    path = []
+    while (i is not None):
+        path.append( i )
+        i = prev[i]
+    path.reverse()
+    return path
+# end
+
+# ------------------------------------------------------------------------------
+def busy_intervals( tasks ):
+    '''
+    Returns the merged busy intervals of each thread.
+    A task waiting for nested tasks overlaps the tasks its thread runs
+    meanwhile, hence the merge.
+    '''
+    threads = {}
+    for task in tasks:
+        threads.setdefault( task['tid'], [] ).append(
+            (task['ts'], task['ts'] + task['dur']) )
+    for tid in threads:
+        merged = []
+        for (start, stop) in sorted( threads[tid] ):
+            if (merged and start <= merged[-1][1]):
+                merged[-1][1] = max( merged[-1][1], stop )
+            else:
+                merged.append( [start, stop] )
+        threads[tid] = merged
+    return threads
+# end
+
+# ------------------------------------------------------------------------------
+def parallelism( threads ):
+    '''
+    Returns the number of busy threads over time, as a list of
+    (time, number of busy threads from this time on).
+    '''
+    changes = []
+    for intervals in threads.values():
+        for (start, stop) in intervals:
+            changes.append( (start, 1) )
+            changes.append( (stop, -1) )
+    changes.sort()
+    profile = []
+    busy = 0
+    for (time, delta) in changes:
+        busy += delta
+        if (profile and profile[-1][0] == time):
+            profile[-1] = (time, busy)
+        else:
+            profile.append( (time, busy) )
+    return profile
+# end
+
+# ------------------------------------------------------------------------------
+def average( profile, start, stop ):
+    '''
+    Returns the average of the parallelism profile between start and stop.
+    '''
+    total = 0.0
+    for k in range( len( profile ) - 1 ):
+        lo = max( profile[k][0], start )
+        hi = min( profile[k+1][0], stop )
+        if (hi > lo):
+            total += profile[k][1] * (hi - lo)
+    return total / (stop - start) if stop > start else 0.0
+# end
+
+# ------------------------------------------------------------------------------
+def report( tasks, preds, path, threads, profile, bins ):
+    begin = min( t['ts'] for t in tasks )
+    end   = max( t['ts'] + t['dur'] for t in tasks )
+    span  = end - begin
+    work  = sum( t['dur'] for t in tasks )
+
+    print( 'tasks              %d' % len( tasks ) )
+    print( 'dependencies       %d' % sum( len( p ) for p in preds ) )
+    print( 'span          %12.3f ms' % (span / 1e3) )
+    print( 'work          %12.3f ms' % (work / 1e3) )
+
+    length = sum( tasks[i]['dur'] for i in path )
+    print( '\ncritical path %12.3f ms, %d tasks, %.1f%% of the span'
+           % (length / 1e3, len( path ), 100. * length / span) )
+    kernels = {}
+    for i in path:
+        name = tasks[i]['name']
+        (count, time) = kernels.get( name, (0, 0.0) )
+        kernels[name] = (count + 1, time + tasks[i]['dur'])
+    for name in sorted( kernels, key=lambda n: -kernels[n][1] ):
+        (count, time) = kernels[name]
+        print( '    %-10s %6d tasks %12.3f ms' % (name, count, time / 1e3) )
+
+    print( '\nidle time per thread' )
+    for tid in sorted( threads ):
+        busy = sum( stop - start for (start, stop) in threads[tid] )
+        print( '    thread %3d %12.3f ms idle, %5.1f%%'
+               % (tid, (span - busy) / 1e3, 100. * (span - busy) / span) )
+
+    print( '\nparallelism %.2f on average, over time:' %
+           average( profile, begin, end ) )
+    num_threads = max( len( threads ), 1 )
+    for b in range( bins ):
+        lo = begin + span * b / bins
+        hi = begin + span * (b + 1) / bins
+        p = average( profile, lo, hi )
+        bar = '#' * int( round( 40. * p / num_threads ) )
+        print( '    %12.3f ms %6.2f %s' % ((lo - begin) / 1e3, p, bar) )
+# end
+
+# ------------------------------------------------------------------------------
+def write( filename, trace, tasks, path, profile ):
+    '''
+    Writes the trace with the critical path as flow events and the
+    parallelism as a counter.
+    '''
+    events = list( trace )
+    for k in range( len( path ) - 1 ):
+        a = tasks[path[k]]
+        b = tasks[path[k+1]]
+        events.append( { 'name': 'critical path', 'cat': 'critical', 'ph': 's',
+                         'id': k, 'pid': a['pid'], 'tid': a['tid'],
+                         'ts': a['ts'] + a['dur'] } )
+        events.append( { 'name': 'critical path', 'cat': 'critical', 'ph': 'f',
+                         'bp': 'e', 'id': k, 'pid': b['pid'], 'tid': b['tid'],
+                         'ts': b['ts'] } )
+    for (time, busy) in profile:
+        events.append( { 'name': 'parallelism', 'ph': 'C', 'pid': 0,
+                         'ts': time, 'args': { 'busy threads': busy } } )
+    with open( filename, 'w' ) as f:
+        json.dump( { 'displayTimeUnit': 'ms', 'traceEvents': events }, f )
+# end
+
+# ------------------------------------------------------------------------------
+def main():
+    parser = argparse.ArgumentParser(
+        description='Analyzes a PLASMA trace in the Chrome trace event format.' )
+    parser.add_argument( 'trace', help='trace written by plasma_trace_stop()' )
+    parser.add_argument( '-o', '--output',
+                         help='writes the trace with the critical path '
+                              'and the parallelism' )
+    parser.add_argument( '-b', '--bins', type=int, default=20,
+                         help='number of time intervals of the parallelism '
+                              'profile (default 20)' )
+    args = parser.parse_args()
+
+    (trace, tasks) = load( args.trace )
+    if (not tasks):
+        print( 'no tasks in', args.trace )
+        return 1
+
+    preds   = dependencies( tasks )
+    path    = critical_path( tasks, preds )
+    threads = busy_intervals( tasks )
+    profile = parallelism( threads )
+    report( tasks, preds, path, threads, profile, args.bins )
+    if (args.output):
+        write( args.output, trace, tasks, path, profile )
+    return 0
+# end
+
+if (__name__ == '__main__'):
+    sys.exit( main() )
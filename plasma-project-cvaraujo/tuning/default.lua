@@ -4,6 +4,10 @@ function gbtrf_nb (type, num_threads, n, bw)
         return 256
 end
 
+function gbtrf_ib (type, num_threads, n, bw)
+        return 64
+end
+
 function gbtrf_max_panel_threads (type, num_threads, n, bw)
         return 1
 end
@@ -48,6 +52,10 @@ function geqrf_ib (type, num_threads, m, n)
         return 64
 end
 
+function geqrf_lookahead (type, num_threads, m, n)
+        return 1
+end
+
 --------------------------------------------------------------------------------
 function geswp_nb (type, num_threads, m, n)
         return 256
@@ -66,6 +74,17 @@ function getrf_max_panel_threads (type, num_threads, m, n)
 	return 1
 end
 
+-- panel variant: 1 iterative (column by column), 2 recursive,
+-- 3 tournament pivoting (CALU)
+function getrf_panel (type, num_threads, m, n)
+	return 1
+end
+
+-- number of panels factored ahead of the trailing matrix update
+function getrf_lookahead (type, num_threads, m, n)
+	return 1
+end
+
 --------------------------------------------------------------------------------
 function hetrf_nb (type, num_threads, n)
         return 256
@@ -121,6 +140,10 @@ function potrf_nb (type, num_threads, n)
         return 256
 end
 
+function potrf_lookahead (type, num_threads, n)
+        return 1
+end
+
 --------------------------------------------------------------------------------
 function poinv_nb (type, num_threads, n)
         return 256
@@ -155,3 +178,8 @@ end
 function trsm_nb (type, num_threads, m, n)
         return 256
 end
+
+--------------------------------------------------------------------------------
+function trtri_nb (type, num_threads, n)
+        return 256
+end